@@ -0,0 +1,21 @@
+#!/bin/bash
+set -e
+set -x
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+REPO_DIR=$SCRIPT_DIR/../../
+cd $REPO_DIR
+
+./build/vowpalwabbit/core/vw_core_test --gtest_filter='search_rollout_threads_tests.*'
+# The search reference tests, rolled out on two threads. Threaded rollouts see the weights from before the example, so
+# only tests whose rollouts never consult the learned policy can match the serial reference outputs. Options that
+# --search_rollout_threads rejects are skipped.
+SEARCH_TESTS=$(python3 -c "
+import json, re
+unsupported = ['--search_metatask', '--search_task hook', '--cb', '--cs_active', '--search_use_passthrough_repr', '--sparse_weights']
+tests = json.load(open('test/core.vwtest.json'))
+print(' '.join(str(t['id']) for t in tests if '--search_task' in t.get('vw_command', '')
+    and re.search(r'--search_rollout (ref|oracle|none)\b', t['vw_command'])
+    and not any(o in t['vw_command'] for o in unsupported)))
+")
+python3 test/run_tests.py --fuzzy_compare --exit_first_fail --epsilon 0.001 --ignore_dirty --extra_options="--search_rollout_threads 2" --test $SEARCH_TESTS
@@ -0,0 +1,11 @@
+#!/bin/bash
+set -e
+set -x
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+REPO_DIR=$SCRIPT_DIR/../../
+cd $REPO_DIR
+
+./build/vowpalwabbit/core/vw_core_test --gtest_filter='simdjson_parser_tests.*'
+# The reference tests, with every JSON and DSJSON input parsed by the simdjson backend.
+python3 test/run_tests.py --fuzzy_compare --exit_first_fail --epsilon 0.001 --ignore_dirty --extra_options="--json_parser simdjson"
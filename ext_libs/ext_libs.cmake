@@ -112,3 +112,7 @@ if(VW_BUILD_LARGE_ACTION_SPACE)
     $<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}>
   )
 endif()
+
+if(VW_BUILD_SIMDJSON)
+  find_package(simdjson CONFIG REQUIRED)
+endif()
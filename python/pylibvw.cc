@@ -553,6 +553,12 @@ float my_predict(vw_ptr all, example_ptr ec)
   return ec->partial_prediction;
 }
 
+void my_predict_batch(vw_ptr& all, py::list& ec)
+{
+  multi_ex ex_coll = unwrap_example_list(ec);
+  all->predict_batch(ex_coll.data(), ex_coll.size());
+}
+
 bool my_is_multiline(vw_ptr all) { return all->l->is_multiline(); }
 
 template <bool learn>
@@ -1424,6 +1430,8 @@ BOOST_PYTHON_MODULE(pylibvw)
 
       .def("learn_multi", &my_learn_multi_ex, "given a list pyvw examples, learn (and predict) on those examples")
       .def("predict_multi", &my_predict_multi_ex, "given a list of pyvw examples, predict on that example")
+      .def("predict_batch", &my_predict_batch,
+          "given a list of independent pyvw examples, predict on each of them with a single call")
       .def("_parse", &my_parse, "Parse a string into a collection of VW examples")
       .def("_is_multiline", &my_is_multiline, "true if the base reduction is multiline")
 
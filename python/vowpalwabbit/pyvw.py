@@ -726,6 +726,48 @@ class Workspace(pylibvw.vw):
 
         return prediction
 
+    def predict_batch(
+        self,
+        examples: Union[List["Example"], List[str]],
+        prediction_type: Optional[Union[int, PredictionType]] = None,
+    ) -> List[Any]:
+        """Make predictions for a list of independent single line examples with one call into the learner stack
+
+        Args:
+            examples: Examples to get predictions for. The learner must be a single line learner. If passing strings they are parsed using :py:meth:`~vowpalwabbit.Workspace.parse` before being predicted on. If passing Example objects then they must be given to :py:meth:`~vowpalwabbit.Workspace.finish_example` at a later point.
+            prediction_type: If none, use the prediction type of the example objects. This is usually what is wanted. To request a specific type a value can be supplied here.
+
+        Returns:
+            One prediction for each example, in the same order
+        """
+        if self._is_multiline():
+            raise TypeError("Expecting a single line Learner.")
+
+        new_examples = len(examples) > 0 and isinstance(examples[0], str)
+        if new_examples:
+            examples = [self.parse(ex) for ex in examples]
+
+        for ec in examples:
+            if not isinstance(ec, Example):
+                raise TypeError(
+                    "expecting a list of strings or example objects"
+                    " as argument for predict_batch, got %s" % type(ec)
+                )
+            if not getattr(ec, "setup_done", True):
+                ec.setup_example()
+
+        pylibvw.vw.predict_batch(self, examples)
+
+        if prediction_type is None:
+            prediction_type = self.get_prediction_type()
+        predictions = [ec.get_prediction(prediction_type) for ec in examples]
+
+        if new_examples:
+            for ec in examples:
+                self.finish_example(ec)
+
+        return predictions
+
     def save(self, filename: Union[str, Path]) -> None:
         """save model to disk"""
         pylibvw.vw.save(self, str(filename))
@@ -51,4 +51,27 @@ inline std::string get_x_string_fts_multi_ex(
     ss << std::endl;
   }
   return ss.str();
-};
\ No newline at end of file
+};
+
+inline std::string get_dsjson_cb_line(size_t actions, size_t feature_size)
+{
+  std::stringstream ss;
+  ss << R"({"_label_cost":-1.0,"_label_probability":0.5,"_label_Action":1,"_labelIndex":0,)";
+  ss << R"("Timestamp":"2021-02-04T16:31:29.2460000Z","Version":"1","EventId":"13118d9b4c114f8485d9dec417e3aefe",)";
+  ss << R"("a":[)";
+  for (size_t i = 0; i < actions; i++) { ss << (i > 0 ? "," : "") << i + 1; }
+  ss << R"(],"c":{"User":{"id":"user_12345","segment":"premium","age":34},"FromUrl":[{"timeofday":"Afternoon",)";
+  ss << R"("weather":"Sunny"}],"_multi":[)";
+  for (size_t i = 0; i < actions; i++)
+  {
+    ss << (i > 0 ? "," : "") << R"({"_tag":"action_)" << i << R"(","i":{"constant":1,"id":"action_)" << i
+       << R"("},"j":[{)";
+    for (size_t j = 0; j < feature_size; j++)
+    { ss << (j > 0 ? "," : "") << "\"feature_" << j << R"(":)" << (j % 2 == 0 ? "\"value\"" : "0.75"); }
+    ss << "}]}";
+  }
+  ss << R"(]},"p":[)";
+  for (size_t i = 0; i < actions; i++) { ss << (i > 0 ? "," : "") << 1.0 / actions; }
+  ss << R"(],"VWState":{"m":"ff0744c1aa494e1ab39ba0c78d048146/550c12cbd3aa47f09fbed3387fb9c6ec"}})" << std::endl;
+  return ss.str();
+};
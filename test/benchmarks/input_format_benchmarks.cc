@@ -79,6 +79,30 @@ static void bench_text_io_buf(benchmark::State& state, ExtraArgs&&... extra_args
   VW::finish(*vw);
 }
 
+template <class... ExtraArgs>
+static void bench_dsjson_io_buf(benchmark::State& state, ExtraArgs&&... extra_args)
+{
+  std::array<std::string, sizeof...(extra_args)> res = {extra_args...};
+  auto args = res[0];
+  auto example_string = res[1];
+
+  auto* vw = VW::initialize("--dsjson --cb_explore_adf --quiet --no_stdin " + args);
+  VW::multi_ex examples;
+  io_buf buffer;
+  buffer.add_file(VW::io::create_buffer_view(example_string.data(), example_string.size()));
+  examples.push_back(&VW::get_unused_example(vw));
+
+  for (auto _ : state)
+  {
+    vw->example_parser->reader(vw, buffer, examples);
+    VW::return_multiple_example(*vw, examples);
+    examples.push_back(&VW::get_unused_example(vw));
+    buffer.reset();
+    benchmark::ClobberMemory();
+  }
+  VW::finish(*vw);
+}
+
 static void benchmark_example_reuse(benchmark::State& state)
 {
   std::string example_string =
@@ -108,4 +132,11 @@ BENCHMARK_CAPTURE(bench_text_io_buf, 120_string_fts, get_x_string_fts(120));
 BENCHMARK_CAPTURE(bench_cache_io_buf, 120_num_fts, get_x_numerical_fts(120));
 BENCHMARK_CAPTURE(bench_text_io_buf, 120_num_fts, get_x_numerical_fts(120));
 
+BENCHMARK_CAPTURE(bench_dsjson_io_buf, rapidjson_4_actions, "", get_dsjson_cb_line(4, 20));
+BENCHMARK_CAPTURE(bench_dsjson_io_buf, rapidjson_32_actions, "", get_dsjson_cb_line(32, 20));
+#ifdef VW_BUILD_SIMDJSON
+BENCHMARK_CAPTURE(bench_dsjson_io_buf, simdjson_4_actions, "--json_parser simdjson", get_dsjson_cb_line(4, 20));
+BENCHMARK_CAPTURE(bench_dsjson_io_buf, simdjson_32_actions, "--json_parser simdjson", get_dsjson_cb_line(32, 20));
+#endif
+
 BENCHMARK(benchmark_example_reuse);
@@ -277,6 +277,14 @@ BENCHMARK_CAPTURE(benchmark_multi, ccb_adf_same_char_no_interactions,
 BENCHMARK_CAPTURE(benchmark_multi, ccb_adf_same_char_interactions, gen_ccb_examples(50, 7, 3, 6, 3, 4, 14, 2, true, 3),
     "--ccb_explore_adf --quiet -q ::")
     ->MinTime(15.0);
+// --factorize_shared_features looks up the weights of the shared features once per prediction instead of once per
+// action. The shared namespace here is only used linearly, so it is not merged into the actions either.
+BENCHMARK_CAPTURE(benchmark_multi_predict, cb_adf_linear_shared_merged,
+    gen_cb_examples(100, 50, 20, 20, 3, 4, 14, 2, false), "--cb_adf --quiet -q AB")
+    ->MinTime(15.0);
+BENCHMARK_CAPTURE(benchmark_multi_predict, cb_adf_linear_shared_factorized,
+    gen_cb_examples(100, 50, 20, 20, 3, 4, 14, 2, false), "--cb_adf --quiet -q AB --factorize_shared_features")
+    ->MinTime(15.0);
 #ifdef BUILD_LARGE_ACTION_SPACE
 BENCHMARK_CAPTURE(benchmark_multi_predict, cb_las, gen_cb_examples(1, 50, 20, 311, 1, 1, 20, 10, false),
     "--cb_explore_adf --large_action_space -q :: --max_actions 20 --quiet")
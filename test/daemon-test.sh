@@ -23,6 +23,9 @@ do
         --json)
             JSON="$1 --chain_hash"
             ;;
+        --epoll)
+            SERVER="--daemon_server epoll"
+            ;;
         --port)
             PORT="$2"
             shift
@@ -74,7 +77,7 @@ else
 fi
 
 # A command (+pattern) that is unlikely to match anything but our own test
-DaemonCmd="$VW -t -i $MODEL --daemon $Foreground --num_children 1 --quiet --port $PORT $JSON"
+DaemonCmd="$VW -t -i $MODEL --daemon $Foreground --num_children 1 --quiet --port $PORT $JSON $SERVER"
 # libtool may wrap vw with '.libs/lt-vw' so we need to be flexible
 # on the exact process pattern we try to kill.
 DaemonPat=`echo $DaemonCmd | sed 's/^[^ ]*vw /.*vw /'`
@@ -32,3 +32,22 @@ BOOST_AUTO_TEST_CASE(example_move_assign_op_moves_pred)
   BOOST_CHECK_EQUAL(ex.pred.a_s.size(), 0);
   BOOST_CHECK_EQUAL(ex2.pred.a_s.size(), 1);
 }
+
+BOOST_AUTO_TEST_CASE(example_move_does_not_move_owning_pool)
+{
+  int pool = 0;
+  int other_pool = 0;
+  VW::example ex;
+  ex.owning_pool = &pool;
+
+  VW::example ex2(std::move(ex));
+  BOOST_CHECK(ex.owning_pool == nullptr);
+  BOOST_CHECK(ex2.owning_pool == nullptr);
+
+  VW::example ex3;
+  ex3.owning_pool = &other_pool;
+  ex2.owning_pool = &pool;
+  ex3 = std::move(ex2);
+  BOOST_CHECK(ex2.owning_pool == nullptr);
+  BOOST_CHECK(ex3.owning_pool == &other_pool);
+}
@@ -8,6 +8,7 @@
 #include "vw/core/constant.h"
 #include "vw/core/gd_predict.h"
 #include "vw/core/interactions_predict.h"
+#include "vw/core/interactions_simd.h"
 #include "vw/core/parse_args.h"
 #include "vw/core/reductions/gd.h"
 #include "vw/core/vw.h"
@@ -18,6 +19,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <random>
+#include <string>
 #include <vector>
 
 namespace std
@@ -545,3 +548,58 @@ BOOST_AUTO_TEST_CASE(extent_vs_char_interactions_cubic_wildcard_permutations_com
 {
   do_interaction_feature_count_test(true, true, true, false);
 }
+
+BOOST_AUTO_TEST_CASE(dense_interaction_dot_matches_scalar)
+{
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  constexpr uint64_t weight_mask = (1 << 12) - 1;
+  std::vector<float> weights(weight_mask + 1);
+  for (auto& w : weights) { w = dist(rng); }
+
+  for (size_t count : {0, 1, 7, 8, 9, 40, 123})
+  {
+    std::vector<feature_index> indices(count);
+    std::vector<feature_value> values(count);
+    for (size_t i = 0; i < count; i++)
+    {
+      indices[i] = (static_cast<uint64_t>(rng()) << 32) | rng();
+      values[i] = dist(rng);
+    }
+    const uint64_t halfhash = FNV_prime * static_cast<uint64_t>(rng());
+    const float expected = INTERACTIONS::dense_interaction_dot_scalar(
+        0.25f, weights.data(), weight_mask, indices.data(), values.data(), count, halfhash, 5, 0.5f);
+    const float actual = INTERACTIONS::dense_interaction_dot(
+        0.25f, weights.data(), weight_mask, indices.data(), values.data(), count, halfhash, 5, 0.5f);
+    BOOST_CHECK_EQUAL(expected, actual);
+  }
+}
+
+inline void reference_vec_add(float& p, float fx, float fw) { p += fw * fx; }
+
+BOOST_AUTO_TEST_CASE(batched_quadratic_and_cubic_predict_matches_per_feature)
+{
+  auto* vw = VW::initialize("--quiet --noconstant -q ab --cubic abc");
+  auto cleanup = VW::scope_exit([&]() { VW::finish(*vw); });
+
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  for (auto& w : vw->weights.dense_weights) { w = dist(rng); }
+
+  std::string line = "|a";
+  for (int i = 0; i < 30; i++) { line += " a" + std::to_string(i) + ":" + std::to_string(dist(rng)); }
+  line += " |b";
+  for (int i = 0; i < 40; i++) { line += " b" + std::to_string(i) + ":" + std::to_string(dist(rng)); }
+  line += " |c c0 c1 c2";
+  auto* ex = VW::read_example(*vw, line);
+
+  const float batched = GD::inline_predict(*vw, *ex);
+  float per_feature = 0.f;
+  size_t ignored = 0;
+  GD::foreach_feature<float, float, reference_vec_add, dense_parameters>(vw->weights.dense_weights,
+      vw->ignore_some_linear, vw->ignore_linear, *ex->interactions, *ex->extent_interactions, vw->permutations, *ex,
+      per_feature, ignored, vw->_generate_interactions_object_cache);
+  BOOST_CHECK_EQUAL(batched, per_feature);
+
+  vw->finish_example(*ex);
+}
@@ -0,0 +1,69 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/vw.h"
+
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> sample_lines(size_t count)
+{
+  std::vector<std::string> lines;
+  for (size_t i = 0; i < count; i++)
+  {
+    const bool positive = i % 3 == 0;
+    lines.push_back(std::string(positive ? "1" : "-1") + " |f a" + std::to_string(i % 17) + ":0.5 b" +
+        std::to_string(i % 5) + " c" + std::to_string(i % 11) + (positive ? " p" : " n") + std::to_string(i % 7));
+  }
+  return lines;
+}
+
+// Trains on the sample lines and returns the predictions made while learning followed by a final prediction.
+std::vector<float> train_and_predict(const std::string& args, size_t count)
+{
+  auto& vw = *VW::initialize("--quiet --ksvm --l2 1 --reprocess 2 " + args);
+  std::vector<float> predictions;
+  for (const auto& line : sample_lines(count))
+  {
+    auto& ex = *VW::read_example(vw, line);
+    vw.learn(ex);
+    predictions.push_back(ex.pred.scalar);
+    vw.finish_example(ex);
+  }
+
+  auto& test = *VW::read_example(vw, "|f a3:0.5 b3 c3 p3");
+  vw.predict(test);
+  predictions.push_back(test.pred.scalar);
+  vw.finish_example(test);
+  VW::finish(vw);
+  return predictions;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(kernel_svm_cache_eviction_does_not_change_predictions)
+{
+  const auto cached = train_and_predict("--kernel rbf", 300);
+  const auto evicted = train_and_predict("--kernel rbf --kernel_cache_mb 0", 300);
+  BOOST_REQUIRE_EQUAL(cached.size(), evicted.size());
+  for (size_t i = 0; i < cached.size(); i++) { BOOST_CHECK_EQUAL(cached[i], evicted[i]); }
+}
+
+BOOST_AUTO_TEST_CASE(kernel_svm_threaded_rows_match_single_thread)
+{
+  // Enough support vectors for kernel rows to be split over several threads.
+  const auto single = train_and_predict("--kernel poly", 2500);
+  const auto threaded = train_and_predict("--kernel poly --kernel_threads 4", 2500);
+  BOOST_REQUIRE_EQUAL(single.size(), threaded.size());
+  for (size_t i = 0; i < single.size(); i++) { BOOST_CHECK_EQUAL(single[i], threaded[i]); }
+}
+
+BOOST_AUTO_TEST_CASE(kernel_svm_rejects_zero_threads)
+{
+  BOOST_CHECK_THROW(VW::initialize("--quiet --ksvm --kernel_threads 0"), VW::vw_exception);
+}
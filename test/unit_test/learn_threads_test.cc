@@ -0,0 +1,107 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "test_common.h"
+#include "vw/common/vw_exception.h"
+#include "vw/core/learner.h"
+#include "vw/core/parser.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cfloat>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Queues the examples like the parser thread would and runs the driver on them.
+void drive(VW::workspace& vw, const std::vector<std::string>& lines)
+{
+  for (const auto& line : lines) { vw.example_parser->ready_parsed_examples.push(VW::read_example(vw, line)); }
+  vw.example_parser->ready_parsed_examples.set_done();
+  VW::LEARNER::generic_driver(vw);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(learn_threads_learns_every_example)
+{
+  auto& vw = *VW::initialize("--quiet --learn_threads 4 --example_queue_limit 4096 -q ab");
+  std::vector<std::string> lines;
+  for (int i = 0; i < 2000; i++) { lines.push_back(i % 2 == 0 ? "1 |a x |b y" : "-1 |a z |b w"); }
+  drive(vw, lines);
+
+  BOOST_CHECK_EQUAL(vw.sd->example_number, 2000);
+  BOOST_CHECK_EQUAL(vw.sd->weighted_labeled_examples, 2000.);
+
+  auto& positive = *VW::read_example(vw, "|a x |b y");
+  vw.predict(positive);
+  BOOST_CHECK_CLOSE(positive.pred.scalar, 1.f, 5.f);
+  vw.finish_example(positive);
+  VW::finish(vw);
+}
+
+BOOST_AUTO_TEST_CASE(learn_threads_save_command_sees_every_earlier_example)
+{
+  const std::string file_name = "learn_threads_save_command.model";
+  auto& vw = *VW::initialize("--quiet --learn_threads 4 --example_queue_limit 4096");
+  std::vector<std::string> lines;
+  for (int i = 0; i < 2000; i++)
+  {
+    if (i == 1000) { lines.push_back("save_" + file_name + "|"); }
+    lines.push_back(i % 2 == 0 ? "1 |a x" : "-1 |a z");
+  }
+  drive(vw, lines);
+  VW::finish(vw);
+
+  // The saved state counts exactly the examples which came before the command.
+  auto& saved = *VW::initialize("--quiet -i " + file_name);
+  BOOST_CHECK_EQUAL(saved.sd->weighted_labeled_examples, 1000.);
+  VW::finish(saved);
+  std::remove(file_name.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(learn_threads_keeps_every_update_to_the_shared_state)
+{
+  auto& vw = *VW::initialize("--quiet --learn_threads 4 --example_queue_limit 4096");
+  std::vector<std::string> lines;
+  for (int i = 0; i < 2000; i++) { lines.push_back(i % 2 == 0 ? "2 2 |a x y" : "-3 |a z"); }
+  drive(vw, lines);
+
+  // Integral weights sum exactly, so a lost update to the normalized totals would show.
+  auto& g = *static_cast<GD::gd*>(
+      vw.l->get_learner_by_name_prefix("gd")->get_internal_type_erased_data_pointer_test_use_only());
+  BOOST_CHECK_EQUAL(g.per_model_states[0].total_weight, 3000.);
+  BOOST_CHECK_EQUAL(vw.sd->min_label.load(), -3.f);
+  BOOST_CHECK_EQUAL(vw.sd->max_label.load(), 2.f);
+  BOOST_CHECK_EQUAL(vw.sd->is_more_than_two_labels_observed, false);
+  BOOST_CHECK_EQUAL(vw.sd->first_observed_label + vw.sd->second_observed_label, -1.f);
+  VW::finish(vw);
+}
+
+BOOST_AUTO_TEST_CASE(learn_threads_rejects_unsupported_setups)
+{
+  BOOST_CHECK_THROW(VW::initialize("--quiet --learn_threads 2 --sparse_weights"), VW::vw_exception);
+  BOOST_CHECK_THROW(VW::initialize("--quiet --learn_threads 2 --oaa 3"), VW::vw_exception);
+  BOOST_CHECK_THROW(VW::initialize("--quiet --learn_threads 2 --example_queue_type spsc"), VW::vw_exception);
+  BOOST_CHECK_THROW(VW::initialize("--quiet --learn_threads 2 --sgd"), VW::vw_exception);
+  BOOST_CHECK_THROW(VW::initialize("--quiet --learn_threads 2 -t --quantization_report"), VW::vw_exception);
+}
+
+BOOST_AUTO_TEST_CASE(learn_threads_predict_batch_counts_labels_on_finish)
+{
+  auto& vw = *VW::initialize("--quiet --learn_threads 2");
+  std::vector<VW::example*> batch = {VW::read_example(vw, "1 |a x"), VW::read_example(vw, "-1 |a z")};
+  vw.predict_batch(batch.data(), batch.size());
+  // Learn threads count labels when the example is finished, not when it is predicted on.
+  BOOST_CHECK_EQUAL(vw.sd->first_observed_label, FLT_MAX);
+
+  for (auto* ex : batch) { vw.finish_example(*ex); }
+  BOOST_CHECK_EQUAL(vw.sd->first_observed_label, 1.f);
+  BOOST_CHECK_EQUAL(vw.sd->second_observed_label, -1.f);
+  VW::finish(vw);
+}
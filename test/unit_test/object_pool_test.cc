@@ -6,7 +6,9 @@
 
 #include <boost/test/test_tools.hpp>
 #include <boost/test/unit_test.hpp>
+#include <future>
 #include <string>
+#include <thread>
 #include <vector>
 
 struct obj
@@ -66,3 +68,144 @@ BOOST_AUTO_TEST_CASE(object_pool_test)
 
   pool.return_object(o2);
 }
+
+BOOST_AUTO_TEST_CASE(thread_cached_object_pool_grows_and_reuses)
+{
+  VW::thread_cached_object_pool<obj> pool{0, {}, 2, 4};
+  BOOST_CHECK_EQUAL(pool.size(), 0);
+  BOOST_CHECK_EQUAL(pool.empty(), true);
+
+  auto* o1 = pool.get_object();
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+  BOOST_CHECK_EQUAL(pool.empty(), false);
+
+  auto* o2 = pool.get_object();
+  BOOST_CHECK_EQUAL(pool.empty(), true);
+  auto* o3 = pool.get_object();
+  BOOST_CHECK_EQUAL(pool.size(), 4);
+
+  obj other_obj;
+  BOOST_CHECK_EQUAL(pool.is_from_pool(o1), true);
+  BOOST_CHECK_EQUAL(pool.is_from_pool(o3), true);
+  BOOST_CHECK_EQUAL(pool.is_from_pool(&other_obj), false);
+
+  pool.return_object(o1);
+  pool.return_object(o2);
+  pool.return_object(o3);
+  BOOST_CHECK_EQUAL(pool.get_object(), o3);
+  pool.return_object(o3);
+
+  const auto stats = pool.stats();
+  BOOST_CHECK_EQUAL(stats.get_count, 4);
+  BOOST_CHECK_EQUAL(stats.cache_hits, 2);
+  BOOST_CHECK_EQUAL(stats.cache_misses, 2);
+  BOOST_CHECK_EQUAL(stats.chunk_allocations, 2);
+  BOOST_CHECK_EQUAL(stats.return_count, 4);
+}
+
+BOOST_AUTO_TEST_CASE(thread_cached_object_pool_returns_in_batches)
+{
+  VW::thread_cached_object_pool<obj> pool{32, {}, 8, 4};
+  std::vector<obj*> objects;
+  for (size_t i = 0; i < 32; i++) { objects.push_back(pool.get_object()); }
+  BOOST_CHECK_EQUAL(pool.size(), 32);
+  for (auto* o : objects) { pool.return_object(o); }
+
+  const auto stats = pool.stats();
+  BOOST_CHECK_EQUAL(stats.cache_misses, 8);
+  BOOST_CHECK_EQUAL(stats.chunk_allocations, 0);
+  // A batch goes back to the shared list every time the cache reaches two batches.
+  BOOST_CHECK_EQUAL(stats.batch_returns, 7);
+}
+
+BOOST_AUTO_TEST_CASE(thread_cached_object_pool_across_threads)
+{
+  const size_t num_objects = 10000;
+  VW::thread_cached_object_pool<obj> pool{64};
+
+  // Objects are taken on one thread and returned on another, like parsed examples.
+  std::vector<obj*> handed_over(num_objects);
+  std::thread producer(
+      [&]()
+      {
+        for (size_t i = 0; i < num_objects; i++)
+        {
+          handed_over[i] = pool.get_object();
+          handed_over[i]->i = static_cast<int>(i);
+        }
+      });
+  producer.join();
+
+  for (size_t i = 0; i < num_objects; i++)
+  {
+    BOOST_CHECK_EQUAL(handed_over[i]->i, static_cast<int>(i));
+    pool.return_object(handed_over[i]);
+  }
+
+  // The producer exited, so its counters have been folded into the pool.
+  const auto stats = pool.stats();
+  BOOST_CHECK_EQUAL(stats.get_count, num_objects);
+  BOOST_CHECK_EQUAL(stats.return_count, num_objects);
+  BOOST_CHECK_EQUAL(stats.cache_hits + stats.cache_misses, num_objects);
+}
+
+BOOST_AUTO_TEST_CASE(thread_cached_object_pool_thread_exit_returns_cached_objects)
+{
+  VW::thread_cached_object_pool<obj> pool{16, {}, 8, 4};
+  std::thread worker(
+      [&]()
+      {
+        auto* o = pool.get_object();
+        pool.return_object(o);
+      });
+  worker.join();
+
+  // Everything the worker had cached is back on the shared list, so all objects can be taken without growing.
+  std::vector<obj*> objects;
+  for (size_t i = 0; i < 16; i++) { objects.push_back(pool.get_object()); }
+  BOOST_CHECK_EQUAL(pool.size(), 16);
+  for (auto* o : objects) { pool.return_object(o); }
+}
+
+BOOST_AUTO_TEST_CASE(thread_cached_object_pool_bounds_objects_cached_by_a_thread)
+{
+  const size_t batch_size = 4;
+  VW::thread_cached_object_pool<obj> pool{64, {}, 8, batch_size};
+  std::vector<obj*> objects;
+  for (size_t i = 0; i < 64; i++) { objects.push_back(pool.get_object()); }
+
+  std::promise<void> returned;
+  std::promise<void> done;
+  std::thread worker(
+      [&]()
+      {
+        for (auto* o : objects) { pool.return_object(o); }
+        returned.set_value();
+        done.get_future().wait();
+      });
+  returned.get_future().wait();
+
+  // While the worker is alive, at most 2 * batch_size - 1 of the objects it returned are out of reach.
+  size_t available = 0;
+  std::vector<obj*> taken;
+  while (pool.size() == 64)
+  {
+    taken.push_back(pool.get_object());
+    if (pool.size() == 64) { available++; }
+  }
+  BOOST_CHECK_GE(available, 64 - (2 * batch_size - 1));
+
+  for (auto* o : taken) { pool.return_object(o); }
+  done.set_value();
+  worker.join();
+}
+
+BOOST_AUTO_TEST_CASE(thread_cached_object_pools_destroyed_on_the_same_thread)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    VW::thread_cached_object_pool<obj> pool{4};
+    auto* o = pool.get_object();
+    pool.return_object(o);
+  }
+}
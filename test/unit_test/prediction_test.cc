@@ -2,10 +2,14 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/core/learner.h"
 #include "vw/core/vw.h"
 
 #include <boost/test/test_tools.hpp>
 #include <boost/test/unit_test.hpp>
+#include <cfloat>
+#include <string>
+#include <vector>
 
 // Test case validating this issue: https://github.com/VowpalWabbit/vowpal_wabbit/issues/2166
 BOOST_AUTO_TEST_CASE(predict_modifying_state)
@@ -44,3 +48,200 @@ BOOST_AUTO_TEST_CASE(predict_modifying_state)
 
   BOOST_CHECK_EQUAL(prediction_one, prediction_two);
 }
+
+BOOST_AUTO_TEST_CASE(predict_batch_matches_predict)
+{
+  auto& vw = *VW::initialize("--quiet --link logistic -q ab --noconstant");
+  const std::vector<std::string> train = {"1 |a x:1 y:2 |b z:0.5", "-1 |a x:-1 |b w:1 z:2", "1 |a y:0.3 |b w:-1"};
+  for (int pass = 0; pass < 5; pass++)
+  {
+    for (const auto& line : train)
+    {
+      auto& ex = *VW::read_example(vw, line);
+      vw.learn(ex);
+      vw.finish_example(ex);
+    }
+  }
+
+  const std::vector<std::string> test = {"|a x:1 |b z:1", "|a y:1 |b w:1", "|a x:0.5 y:0.5 |b z:2 w:1", "|b z:1"};
+  std::vector<float> expected;
+  for (const auto& line : test)
+  {
+    auto& ex = *VW::read_example(vw, line);
+    vw.predict(ex);
+    expected.push_back(ex.pred.scalar);
+    vw.finish_example(ex);
+  }
+
+  std::vector<VW::example*> batch;
+  for (const auto& line : test) { batch.push_back(VW::read_example(vw, line)); }
+  vw.predict_batch(batch.data(), batch.size());
+  for (size_t i = 0; i < batch.size(); i++)
+  {
+    BOOST_CHECK_EQUAL(batch[i]->pred.scalar, expected[i]);
+    vw.finish_example(*batch[i]);
+  }
+  VW::finish(vw);
+}
+
+BOOST_AUTO_TEST_CASE(predict_batch_falls_back_to_predict)
+{
+  // oaa does not implement predict_batch, so every example goes through predict.
+  auto& vw = *VW::initialize("--quiet --oaa 3");
+  auto& train = *VW::read_example(vw, "2 | a b c");
+  vw.learn(train);
+  vw.finish_example(train);
+
+  auto& single = *VW::read_example(vw, "| a b");
+  vw.predict(single);
+  const auto expected = single.pred.multiclass;
+  vw.finish_example(single);
+
+  std::vector<VW::example*> batch = {VW::read_example(vw, "| a b"), VW::read_example(vw, "| a b")};
+  vw.predict_batch(batch.data(), batch.size());
+  for (auto* ex : batch)
+  {
+    BOOST_CHECK_EQUAL(ex->pred.multiclass, expected);
+    vw.finish_example(*ex);
+  }
+  VW::finish(vw);
+}
+
+namespace
+{
+VW::multi_ex parse_multiline(VW::workspace& vw, const std::vector<std::string>& lines)
+{
+  VW::multi_ex examples;
+  for (const auto& line : lines) { examples.push_back(VW::read_example(vw, line)); }
+  return examples;
+}
+
+std::vector<ACTION_SCORE::action_score> train_and_predict_cb_adf(const std::string& args)
+{
+  auto& vw = *VW::initialize(args);
+  const std::vector<std::vector<std::string>> train = {
+      {"shared |U u1 u2:0.5 |S s1 s2", "0:1:0.5 |A a1", "|A a2 s1", "|A a3"},
+      {"shared |U u2 |S s2:2", "|A a1", "1:0:0.5 |A a2", "|A a3 s2"},
+      {"shared |U u1 |S s1 s3", "|A a1", "|A a2", "2:0.2:0.5 |A a3"}};
+  for (int pass = 0; pass < 5; pass++)
+  {
+    for (const auto& lines : train)
+    {
+      auto examples = parse_multiline(vw, lines);
+      vw.learn(examples);
+      vw.finish_example(examples);
+    }
+  }
+
+  // The third action also has features in the shared namespace S.
+  auto examples =
+      parse_multiline(vw, {"shared |U u1 u2:0.3 |S s1 s2:1.7 s3", "|A a1", "|A a2 s1", "|A a3 |S s4:0.1 s2"});
+  vw.predict(examples);
+  std::vector<ACTION_SCORE::action_score> scores(examples[0]->pred.a_s.begin(), examples[0]->pred.a_s.end());
+  vw.finish_example(examples);
+  VW::finish(vw);
+  return scores;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(factorized_shared_features_match_merged)
+{
+  // Interacted shared namespaces stay merged, the weights of every shared feature are looked up once.
+  for (const std::string& args : {"--cb_adf --quiet", "--cb_adf --quiet -q UA", "--cb_adf --quiet -q UA -q SA",
+           "--cb_adf --quiet -q UA --ignore_linear S", "--cb_adf --quiet -q UA --sparse_weights"})
+  {
+    const auto expected = train_and_predict_cb_adf(args);
+    const auto actual = train_and_predict_cb_adf(args + " --factorize_shared_features");
+
+    BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+      BOOST_CHECK_EQUAL(actual[i].action, expected[i].action);
+      BOOST_CHECK_EQUAL(actual[i].score, expected[i].score);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(factorized_shared_features_rejects_unsupported_reductions)
+{
+  BOOST_CHECK_THROW(VW::initialize("--cb_explore_adf --cover 2 --quiet --factorize_shared_features"), VW::vw_exception);
+}
+
+BOOST_AUTO_TEST_CASE(csoaa_multipredict_matches_per_class_predictions)
+{
+  auto& vw = *VW::initialize("--csoaa 4 --quiet -q ab");
+  for (int i = 0; i < 20; i++)
+  {
+    auto& ex = *VW::read_example(vw, i % 2 == 0 ? "1:0 2:1 3:1 4:1 |a x |b y" : "1:1 2:1 3:0 4:1 |a z |b y");
+    vw.learn(ex);
+    vw.finish_example(ex);
+  }
+
+  // Costs for all classes are scored with multipredict, a single cost is scored on its own.
+  auto& all_classes = *VW::read_example(vw, "1 2 3 4 |a x |b y");
+  vw.predict(all_classes);
+  for (const auto& cost : all_classes.l.cs.costs)
+  {
+    auto& single_class = *VW::read_example(vw, std::to_string(cost.class_index) + " |a x |b y");
+    vw.predict(single_class);
+    BOOST_CHECK_EQUAL(single_class.l.cs.costs[0].partial_prediction, cost.partial_prediction);
+    vw.finish_example(single_class);
+  }
+  BOOST_CHECK_EQUAL(all_classes.pred.multiclass, 1);
+  vw.finish_example(all_classes);
+  VW::finish(vw);
+}
+
+BOOST_AUTO_TEST_CASE(freegrad_multipredict_matches_per_class_predictions)
+{
+  auto& vw = *VW::initialize("--csoaa 4 --freegrad --quiet -q ab");
+  for (int i = 0; i < 20; i++)
+  {
+    auto& ex = *VW::read_example(vw, i % 2 == 0 ? "1:0 2:1 3:1 4:1 |a x |b y" : "1:1 2:1 3:0 4:1 |a z |b y");
+    vw.learn(ex);
+    vw.finish_example(ex);
+  }
+
+  auto* freegrad = VW::LEARNER::as_singleline(vw.l->get_learner_by_name_prefix("freegrad"));
+  auto& ex = *VW::read_example(vw, "|a x |b y");
+  ex.l.simple = {FLT_MAX};
+  std::vector<VW::polyprediction> preds(4);
+  freegrad->multipredict(ex, 0, preds.size(), preds.data(), true);
+  for (size_t i = 0; i < preds.size(); i++)
+  {
+    freegrad->predict(ex, i);
+    BOOST_CHECK_EQUAL(ex.pred.scalar, preds[i].scalar);
+  }
+  vw.finish_example(ex);
+  VW::finish(vw);
+}
+
+BOOST_AUTO_TEST_CASE(multilabel_oaa_multipredict_matches_per_label_predictions)
+{
+  auto& vw = *VW::initialize("--multilabel_oaa 4 --probabilities --quiet -q ab");
+  for (int i = 0; i < 20; i++)
+  {
+    auto& ex = *VW::read_example(vw, i % 2 == 0 ? "0,2 |a x |b y" : "1,3 |a z |b y");
+    vw.learn(ex);
+    vw.finish_example(ex);
+  }
+
+  // Scores of all labels, computed with multipredict.
+  auto& all_labels = *VW::read_example(vw, "|a x |b y");
+  vw.predict(all_labels);
+  const std::vector<float> probabilities(all_labels.pred.scalars.begin(), all_labels.pred.scalars.end());
+  vw.finish_example(all_labels);
+  BOOST_REQUIRE_EQUAL(probabilities.size(), 4);
+
+  // Each label scored on its own, as multilabel_oaa does with its base learner when multipredict is not used.
+  auto* base = VW::LEARNER::as_singleline(vw.l->get_learner_by_name_prefix("scorer"));
+  auto& single_label = *VW::read_example(vw, "|a x |b y");
+  single_label.l.simple = {FLT_MAX};
+  for (size_t i = 0; i < probabilities.size(); i++)
+  {
+    base->predict(single_label, i);
+    BOOST_CHECK_EQUAL(single_label.pred.scalar, probabilities[i]);
+  }
+  vw.finish_example(single_label);
+  VW::finish(vw);
+}
@@ -0,0 +1,100 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/reduction_profiler.h"
+
+#include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/metric_sink.h"
+#include "vw/core/vw.h"
+
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const VW::reduction_profiler::frame_stats& find_stats(
+    const std::vector<VW::reduction_profiler::frame_stats>& stats, const std::string& name)
+{
+  for (const auto& stat : stats)
+  {
+    if (stat.name == name) { return stat; }
+  }
+  BOOST_FAIL("frame not found: " + name);
+  return stats.front();
+}
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(reduction_profiler_nested_frames)
+{
+  VW::reduction_profiler profiler("");
+  const auto* outer = profiler.get_frame("outer");
+  const auto* inner = profiler.get_frame("inner");
+  BOOST_CHECK(profiler.get_frame("outer") == outer);
+
+  for (int i = 0; i < 2; i++)
+  {
+    VW::details::profile_scope outer_scope(&profiler, outer, 4);
+    VW::details::profile_scope inner_scope(&profiler, inner);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+
+  // Calls on another thread are added to the totals but not nested in the calls of this thread.
+  std::thread other([&] { VW::details::profile_scope scope(&profiler, inner); });
+  other.join();
+
+  const auto stats = profiler.summarize();
+  BOOST_REQUIRE_EQUAL(stats.size(), 2);
+  const auto& outer_stats = find_stats(stats, "outer");
+  const auto& inner_stats = find_stats(stats, "inner");
+  BOOST_CHECK_EQUAL(outer_stats.calls, 2);
+  BOOST_CHECK_EQUAL(outer_stats.examples, 8);
+  BOOST_CHECK_EQUAL(inner_stats.calls, 3);
+  BOOST_CHECK_EQUAL(inner_stats.examples, 3);
+  BOOST_CHECK_GE(inner_stats.inclusive_ns, 4000000);
+  BOOST_CHECK_GE(outer_stats.inclusive_ns, inner_stats.inclusive_ns - inner_stats.exclusive_ns);
+  BOOST_CHECK_LT(outer_stats.exclusive_ns, outer_stats.inclusive_ns);
+
+  std::stringstream folded;
+  profiler.write_folded_stacks(folded);
+  BOOST_CHECK(folded.str().find("outer;inner ") != std::string::npos);
+
+  VW::metric_sink metrics;
+  profiler.persist_metrics(metrics);
+  BOOST_CHECK_EQUAL(metrics.get_uint("profile_inner_calls"), 3);
+  BOOST_CHECK_EQUAL(metrics.get_uint("profile_outer_examples"), 8);
+}
+
+BOOST_AUTO_TEST_CASE(reduction_profiler_records_learner_stack)
+{
+  auto& vw = *VW::initialize("--quiet --oaa 3");
+  vw.profiler = VW::make_unique<VW::reduction_profiler>("");
+  vw.l->set_profiler(*vw.profiler);
+
+  for (int i = 0; i < 5; i++)
+  {
+    auto* ex = VW::read_example(vw, std::to_string(i % 3 + 1) + " | a b c");
+    vw.learn(*ex);
+    vw.finish_example(*ex);
+  }
+
+  const auto stats = vw.profiler->summarize();
+  const auto& oaa_stats = find_stats(stats, "oaa");
+  // Each example is predicted on and then learned from.
+  BOOST_CHECK_EQUAL(oaa_stats.calls, 10);
+  BOOST_CHECK_EQUAL(oaa_stats.examples, 10);
+  // oaa predicts with one multipredict call and learns with one update call per class.
+  BOOST_CHECK_EQUAL(find_stats(stats, "scorer-identity").calls, 20);
+  BOOST_CHECK_EQUAL(find_stats(stats, "oaa.finish_example").calls, 5);
+
+  std::stringstream report;
+  vw.profiler->report(report);
+  BOOST_CHECK(report.str().find("Reduction profile:") != std::string::npos);
+  VW::finish(vw);
+}
@@ -3,11 +3,13 @@
 // license as described in the file LICENSE.
 
 #include "test_common.h"
+#include "vw/common/vw_exception.h"
 #include "vw/core/array_parameters.h"
 #include "vw/core/array_parameters_dense.h"
 
 #include <boost/mpl/vector.hpp>
 #include <boost/test/unit_test.hpp>
+#include <vector>
 
 constexpr auto LENGTH = 16;
 constexpr auto STRIDE_SHIFT = 2;
@@ -20,4 +22,90 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_default_function_weight_initialization_stride
   auto weight_initializer = [](weight* weights, uint64_t index) { weights[0] = 1.f * index; };
   w.set_default(weight_initializer);
   for (size_t i = 0; i < LENGTH; i++) { BOOST_CHECK_CLOSE(w.strided_index(i), 1.f * (i * w.stride()), FLOAT_TOL); }
-}
\ No newline at end of file
+}
+BOOST_AUTO_TEST_CASE(sparse_weights_grow_and_keep_blocks_in_place)
+{
+  constexpr size_t num_weights = 1 << 14;
+  sparse_parameters w(1 << 20, STRIDE_SHIFT);
+  w.set_default([](weight* weights, uint64_t index) { weights[1] = 1.f * index; });
+
+  std::vector<weight*> blocks;
+  for (size_t i = 0; i < num_weights; i++)
+  {
+    auto& block = w.strided_index(i * 7);
+    block = 2.f;
+    blocks.push_back(&block);
+  }
+  BOOST_CHECK_EQUAL(w.size(), num_weights);
+
+  // Growing the table must not move the weights handed out before.
+  for (size_t i = 0; i < num_weights; i++)
+  {
+    BOOST_CHECK_EQUAL(&w.strided_index(i * 7), blocks[i]);
+    BOOST_CHECK_CLOSE(blocks[i][1], 1.f * ((i * 7) << STRIDE_SHIFT), FLOAT_TOL);
+  }
+  BOOST_CHECK_EQUAL(w.size(), num_weights);
+
+  size_t visited = 0;
+  for (auto it = w.begin(); it != w.end(); ++it)
+  {
+    BOOST_CHECK_EQUAL(it.index() % (7 << STRIDE_SHIFT), 0);
+    BOOST_CHECK_CLOSE(*it, 2.f, FLOAT_TOL);
+    visited++;
+  }
+  BOOST_CHECK_EQUAL(visited, num_weights);
+
+  w.set_zero(0);
+  for (auto it = w.begin(); it != w.end(); ++it) { BOOST_CHECK_EQUAL(*it, 0.f); }
+}
+
+BOOST_AUTO_TEST_CASE(sparse_weights_shallow_copy_shares_weights)
+{
+  sparse_parameters source(LENGTH, STRIDE_SHIFT);
+  for (size_t i = 0; i < LENGTH / 2; i++) { source.strided_index(i) = 1.f * i; }
+
+  sparse_parameters copy;
+  copy.shallow_copy(source);
+  BOOST_CHECK(copy.seeded());
+  for (size_t i = 0; i < LENGTH / 2; i++) { BOOST_CHECK_EQUAL(&copy.strided_index(i), &source.strided_index(i)); }
+
+  // Blocks created by the copy are its own.
+  copy.strided_index(LENGTH - 1) = 3.f;
+  BOOST_CHECK_EQUAL(copy.size(), LENGTH / 2 + 1);
+  BOOST_CHECK_EQUAL(source.size(), LENGTH / 2);
+}
+
+BOOST_AUTO_TEST_CASE(dense_weights_with_placement_policies)
+{
+  VW::dense_allocation_options options;
+  options.huge_pages = VW::huge_page_policy::hugetlb;
+  options.numa = VW::numa_policy::interleave;
+
+  dense_parameters w(1 << 18, STRIDE_SHIFT, options);
+  BOOST_CHECK(w.not_null());
+  // The policies are best effort, what was applied is never more than what was requested.
+  BOOST_CHECK(w.allocation().numa == VW::numa_policy::interleave || w.allocation().numa == VW::numa_policy::none);
+  for (auto it = w.begin(); it != w.end(); ++it) { BOOST_CHECK_EQUAL(*it, 0.f); }
+
+  w.set_default([](weight* weights, uint64_t index) { weights[0] = 1.f * index; });
+  dense_parameters copy;
+  copy.shallow_copy(w);
+  BOOST_CHECK(copy.seeded());
+  BOOST_CHECK_EQUAL(&copy.strided_index(5), &w.strided_index(5));
+  BOOST_CHECK(copy.allocation().numa == w.allocation().numa);
+
+#if !defined(_WIN32) && !defined(DISABLE_SHARED_WEIGHTS)
+  dense_parameters shared(1 << 10, STRIDE_SHIFT, options);
+  shared.strided_index(3) = 7.f;
+  shared.share(1 << 10);
+  BOOST_CHECK_EQUAL(shared.strided_index(3), 7.f);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(dense_weight_policies_from_string)
+{
+  BOOST_CHECK(VW::huge_page_policy_from_string("transparent") == VW::huge_page_policy::transparent);
+  BOOST_CHECK(VW::numa_policy_from_string("first_touch") == VW::numa_policy::first_touch);
+  BOOST_CHECK_EQUAL(VW::to_string(VW::huge_page_policy::hugetlb), "hugetlb");
+  BOOST_CHECK_THROW(VW::numa_policy_from_string("nearest"), VW::vw_exception);
+}
@@ -56,6 +56,8 @@ int main(int argc, char* argv[])
   to_flat converter;
   driver_config.add(make_option("fb_out", converter.output_flatbuffer_name));
   driver_config.add(make_option("collection_size", converter.collection_size));
+  driver_config.add(make_option("soa", converter.struct_of_arrays)
+                        .help("Write the features of every namespace as parallel hash and value arrays"));
 
   std::vector<VW::workspace*> alls;
 
@@ -309,7 +309,26 @@ flatbuffers::Offset<VW::parsers::flatbuffer::Namespace> to_flat::create_namespac
   {
     flatbuffers::Offset<VW::parsers::flatbuffer::Namespace> namespace_offset;
     // new namespace
-    if (audit)
+    if (struct_of_arrays)
+    {
+      std::vector<uint64_t> hashes;
+      std::vector<float> values;
+      std::vector<flatbuffers::Offset<flatbuffers::String>> names;
+      std::string ns_name;
+      for (auto it = begin; it != end; ++it)
+      {
+        hashes.push_back(it.index());
+        values.push_back(it.value());
+        if (audit)
+        {
+          ns_name = it.audit()->ns;
+          names.push_back(_builder.CreateString(it.audit()->name));
+        }
+      }
+      namespace_offset = VW::parsers::flatbuffer::CreateNamespaceDirect(_builder, audit ? ns_name.c_str() : nullptr,
+          index, nullptr, hash, &hashes, &values, audit ? &names : nullptr);
+    }
+    else if (audit)
     {
       std::string ns_name;
       for (auto it = begin; it != end; ++it)
@@ -59,6 +59,7 @@ public:
   std::string output_flatbuffer_name;
   uint64_t collection_size = 0;
   bool collection = false;
+  bool struct_of_arrays = false;
   void convert_txt_to_flat(VW::workspace& all);
 
 private:
@@ -117,6 +117,25 @@ extern "C"
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Learn(VW_HANDLE handle, VW_EXAMPLE e);
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Predict(VW_HANDLE handle, VW_EXAMPLE e);
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_PredictCostSensitive(VW_HANDLE handle, VW_EXAMPLE e);
+  // Predicts count examples in one call. predictions, if not null, receives the scalar prediction of each example. Asking
+  // for predictions throws if the learner does not predict a scalar.
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_PredictBatch(
+      VW_HANDLE handle, VW_EXAMPLE* examples, size_t count, float* predictions);
+  // Builds count examples from arrays in compressed sparse row layout, learns from them in order and finishes them.
+  // Example i has the namespaces example_offsets[i] to example_offsets[i + 1] - 1, so example_offsets has count + 1
+  // entries. Namespace j is named namespaces[j] and has the features namespace_offsets[j] to
+  // namespace_offsets[j + 1] - 1, whose hashed indices (see VW_HashFeatureA) are in feature_indices and values in
+  // feature_values. feature_values may be null if every value is 1. labels holds the simple label of each example and
+  // weights, if not null, its importance weight. predictions, if not null, receives the scalar prediction of each
+  // example. Decreasing offsets, or asking for predictions from a learner which does not predict a scalar, throw before
+  // any example is built. If learning throws, the examples not learned from yet are finished too.
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_LearnBatchCSR(VW_HANDLE handle, size_t count, const size_t* example_offsets,
+      const unsigned char* namespaces, const size_t* namespace_offsets, const uint64_t* feature_indices,
+      const float* feature_values, const float* labels, const float* weights, float* predictions);
+  // Like VW_LearnBatchCSR for unlabeled examples, which are predicted in one call as with VW_PredictBatch.
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_PredictBatchCSR(VW_HANDLE handle, size_t count, const size_t* example_offsets,
+      const unsigned char* namespaces, const size_t* namespace_offsets, const uint64_t* feature_indices,
+      const float* feature_values, float* predictions);
   // deprecated. Please use either VW_ReadExample for parsing, or VW_ImportExample for example construction
   VW_DLL_PUBLIC void VW_CALLING_CONV VW_AddLabel(VW_EXAMPLE e, float label, float weight, float base);
   // deprecated. Please use either VW_ReadExample for parsing, or VW_ImportExample for example construction
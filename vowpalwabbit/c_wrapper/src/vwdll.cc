@@ -4,17 +4,24 @@
 
 #include "vw/c_wrapper/vwdll.h"
 
+#include "vw/common/vw_exception.h"
+#include "vw/core/label_type.h"
+#include "vw/core/learner.h"
 #include "vw/core/memory.h"
 #include "vw/core/parse_args.h"
 #include "vw/core/parser.h"
+#include "vw/core/prediction_type.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/simple_label.h"
 #include "vw/core/vw.h"
 #include "vw/io/io_adapter.h"
 
+#include <algorithm>
 #include <codecvt>
 #include <locale>
 #include <memory>
 #include <string>
+#include <vector>
 
 // This interface now provides "wide" functions for compatibility with .NET interop
 // The default functions assume a wide (16 bit char pointer) that is converted to a utf8-string and passed to
@@ -45,6 +52,71 @@ std::string utf16_to_utf8(const std::u16string& utf16_string)
 }
 #endif
 
+namespace
+{
+// The batch functions hand out ec.pred.scalar, which only holds the prediction of learners predicting a scalar.
+void check_scalar_predictions(const VW::workspace& all, const char* function)
+{
+  const auto pred_type = all.l->get_output_prediction_type();
+  if (pred_type != VW::prediction_type_t::scalar)
+  { THROW(function << " can only return scalar predictions, but the learner predicts " << VW::to_string(pred_type)); }
+}
+
+// Fills pooled examples with the batch given to VW_LearnBatchCSR or VW_PredictBatchCSR.
+void import_csr_examples(VW::workspace& all, size_t count, const size_t* example_offsets,
+    const unsigned char* namespaces, const size_t* namespace_offsets, const uint64_t* feature_indices,
+    const float* feature_values, const float* labels, const float* weights, std::vector<VW::example*>& examples)
+{
+  if (labels != nullptr && all.example_parser->lbl_parser.label_type != VW::label_type_t::simple)
+  { THROW("Only simple labels can be given to VW_LearnBatchCSR"); }
+  // The offsets are used as loop bounds below, so a decreasing one would read far past the end of the arrays.
+  for (size_t i = 0; i < count; i++)
+  {
+    if (example_offsets[i + 1] < example_offsets[i])
+    { THROW("example_offsets must not decrease, found " << example_offsets[i + 1] << " after " << example_offsets[i]); }
+  }
+  for (size_t ns = example_offsets[0]; ns < example_offsets[count]; ns++)
+  {
+    if (namespace_offsets[ns + 1] < namespace_offsets[ns])
+    {
+      THROW("namespace_offsets must not decrease, found " << namespace_offsets[ns + 1] << " after "
+                                                          << namespace_offsets[ns]);
+    }
+  }
+
+  examples.reserve(count);
+  // Returns the examples taken so far to the pool if one of them can not be set up.
+  auto finish_on_error = VW::scope_exit([&] {
+    for (auto* ex : examples) { VW::finish_example(all, *ex); }
+    examples.clear();
+  });
+  for (size_t i = 0; i < count; i++)
+  {
+    auto& ex = *VW::new_unused_example(all);
+    examples.push_back(&ex);
+    if (labels != nullptr)
+    {
+      ex.l.simple.label = labels[i];
+      auto& red_features = ex._reduction_features.get<simple_label_reduction_features>();
+      red_features.reset_to_default();
+      if (weights != nullptr) { red_features.weight = weights[i]; }
+    }
+
+    for (size_t ns = example_offsets[i]; ns < example_offsets[i + 1]; ns++)
+    {
+      const unsigned char index = namespaces[ns];
+      if (std::find(ex.indices.begin(), ex.indices.end(), index) == ex.indices.end()) { ex.indices.push_back(index); }
+      auto& fs = ex.feature_space[index];
+      for (size_t f = namespace_offsets[ns]; f < namespace_offsets[ns + 1]; f++)
+      { fs.push_back(feature_values != nullptr ? feature_values[f] : 1.f, feature_indices[f]); }
+    }
+
+    VW::setup_example(all, &ex);
+  }
+  finish_on_error.cancel();
+}
+}  // namespace
+
 extern "C"
 {
 #ifdef USE_CODECVT
@@ -351,6 +423,60 @@ extern "C"
     return VW::get_prediction(ex);
   }
 
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_PredictBatch(
+      VW_HANDLE handle, VW_EXAMPLE* examples, size_t count, float* predictions)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    auto** exs = reinterpret_cast<VW::example**>(examples);
+    if (predictions != nullptr) { check_scalar_predictions(*pointer, "VW_PredictBatch"); }
+    pointer->predict_batch(exs, count);
+    if (predictions != nullptr)
+    {
+      for (size_t i = 0; i < count; i++) { predictions[i] = VW::get_prediction(exs[i]); }
+    }
+  }
+
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_LearnBatchCSR(VW_HANDLE handle, size_t count, const size_t* example_offsets,
+      const unsigned char* namespaces, const size_t* namespace_offsets, const uint64_t* feature_indices,
+      const float* feature_values, const float* labels, const float* weights, float* predictions)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    if (predictions != nullptr) { check_scalar_predictions(*pointer, "VW_LearnBatchCSR"); }
+    std::vector<VW::example*> examples;
+    import_csr_examples(*pointer, count, example_offsets, namespaces, namespace_offsets, feature_indices,
+        feature_values, labels, weights, examples);
+    size_t finished = 0;
+    // Returns the examples not learned from yet to the pool if learning throws.
+    auto finish_remaining = VW::scope_exit([&] {
+      for (; finished < count; finished++) { VW::finish_example(*pointer, *examples[finished]); }
+    });
+    for (; finished < count; finished++)
+    {
+      pointer->learn(*examples[finished]);
+      if (predictions != nullptr) { predictions[finished] = VW::get_prediction(examples[finished]); }
+      VW::finish_example(*pointer, *examples[finished]);
+    }
+  }
+
+  VW_DLL_PUBLIC void VW_CALLING_CONV VW_PredictBatchCSR(VW_HANDLE handle, size_t count, const size_t* example_offsets,
+      const unsigned char* namespaces, const size_t* namespace_offsets, const uint64_t* feature_indices,
+      const float* feature_values, float* predictions)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    if (predictions != nullptr) { check_scalar_predictions(*pointer, "VW_PredictBatchCSR"); }
+    std::vector<VW::example*> examples;
+    import_csr_examples(*pointer, count, example_offsets, namespaces, namespace_offsets, feature_indices,
+        feature_values, nullptr, nullptr, examples);
+    auto finish_examples = VW::scope_exit([&] {
+      for (auto* ex : examples) { VW::finish_example(*pointer, *ex); }
+    });
+    pointer->predict_batch(examples.data(), count);
+    if (predictions != nullptr)
+    {
+      for (size_t i = 0; i < count; i++) { predictions[i] = VW::get_prediction(examples[i]); }
+    }
+  }
+
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_PredictCostSensitive(VW_HANDLE handle, VW_EXAMPLE e)
   {
     auto* pointer = static_cast<VW::workspace*>(handle);
@@ -5,11 +5,16 @@
 #include "vw/c_wrapper/vwdll.h"
 
 #include "vw/common/string_view.h"
+#include "vw/common/vw_exception.h"
+#include "vw/core/parser.h"
 #include "vw/core/vw.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 using namespace ::testing;
 
 template <class T>
@@ -79,6 +84,126 @@ TEST(vwdll_test, vw_dll_parsed_and_constructed_example_parity)
   VW_Finish(handle2);
 }
 
+TEST(vwdll_test, vw_dll_csr_batch_and_parsed_example_parity)
+{
+  const std::vector<std::string> lines = {"1 |s a b:2 |t c", "-1 |s b |t d:0.5", "1 |t c e"};
+  VW_HANDLE handle1 = VW_InitializeA("-q st --quiet");
+  VW_HANDLE handle2 = VW_InitializeA("-q st --quiet");
+
+  // the same examples in compressed sparse row layout
+  const auto shash = VW_HashSpaceA(handle2, "s");
+  const auto thash = VW_HashSpaceA(handle2, "t");
+  const std::vector<size_t> example_offsets = {0, 2, 4, 5};
+  const std::vector<unsigned char> namespaces = {'s', 't', 's', 't', 't'};
+  const std::vector<size_t> namespace_offsets = {0, 2, 3, 4, 5, 7};
+  const std::vector<uint64_t> feature_indices = {VW_HashFeatureA(handle2, "a", shash),
+      VW_HashFeatureA(handle2, "b", shash), VW_HashFeatureA(handle2, "c", thash), VW_HashFeatureA(handle2, "b", shash),
+      VW_HashFeatureA(handle2, "d", thash), VW_HashFeatureA(handle2, "c", thash), VW_HashFeatureA(handle2, "e", thash)};
+  const std::vector<float> feature_values = {1.f, 2.f, 1.f, 1.f, 0.5f, 1.f, 1.f};
+  const std::vector<float> labels = {1.f, -1.f, 1.f};
+
+  std::vector<float> parsed_predictions;
+  for (const auto& line : lines)
+  {
+    VW_EXAMPLE example = VW_ReadExampleA(handle1, line.c_str());
+    parsed_predictions.push_back(VW_Learn(handle1, example));
+    VW_FinishExample(handle1, example);
+  }
+  std::vector<float> batch_predictions(lines.size());
+  VW_LearnBatchCSR(handle2, lines.size(), example_offsets.data(), namespaces.data(), namespace_offsets.data(),
+      feature_indices.data(), feature_values.data(), labels.data(), nullptr, batch_predictions.data());
+  EXPECT_THAT(batch_predictions, Pointwise(FloatEq(), parsed_predictions));
+
+  auto vw1 = static_cast<VW::workspace*>(handle1);
+  auto vw2 = static_cast<VW::workspace*>(handle2);
+  check_weights_equal(vw1->weights.dense_weights, vw2->weights.dense_weights);
+
+  parsed_predictions.clear();
+  for (const auto& line : lines)
+  {
+    VW_EXAMPLE example = VW_ReadExampleA(handle1, line.c_str());
+    parsed_predictions.push_back(VW_Predict(handle1, example));
+    VW_FinishExample(handle1, example);
+  }
+  VW_PredictBatchCSR(handle2, lines.size(), example_offsets.data(), namespaces.data(), namespace_offsets.data(),
+      feature_indices.data(), feature_values.data(), batch_predictions.data());
+  EXPECT_THAT(batch_predictions, Pointwise(FloatEq(), parsed_predictions));
+
+  VW_Finish(handle1);
+  VW_Finish(handle2);
+}
+
+TEST(vwdll_test, vw_dll_csr_batch_rejects_decreasing_offsets)
+{
+  VW_HANDLE handle = VW_InitializeA("--quiet");
+  const std::vector<unsigned char> namespaces = {'s', 't'};
+  const std::vector<uint64_t> feature_indices = {1, 2, 3};
+  std::vector<float> predictions(2);
+
+  const std::vector<size_t> decreasing_examples = {0, 2, 1};
+  const std::vector<size_t> namespace_offsets = {0, 2, 3};
+  EXPECT_THROW(VW_PredictBatchCSR(handle, 2, decreasing_examples.data(), namespaces.data(), namespace_offsets.data(),
+                   feature_indices.data(), nullptr, predictions.data()),
+      VW::vw_exception);
+
+  const std::vector<size_t> example_offsets = {0, 1, 2};
+  const std::vector<size_t> decreasing_namespaces = {0, 3, 2};
+  EXPECT_THROW(VW_PredictBatchCSR(handle, 2, example_offsets.data(), namespaces.data(), decreasing_namespaces.data(),
+                   feature_indices.data(), nullptr, predictions.data()),
+      VW::vw_exception);
+  VW_Finish(handle);
+}
+
+TEST(vwdll_test, vw_dll_csr_batch_finishes_examples_when_learning_throws)
+{
+  // Multiline reductions throw on single examples.
+  VW_HANDLE handle = VW_InitializeA("--cb_explore_adf --quiet");
+  auto* vw = static_cast<VW::workspace*>(handle);
+  const std::vector<size_t> example_offsets = {0, 1, 2, 3};
+  const std::vector<unsigned char> namespaces = {'s', 's', 's'};
+  const std::vector<size_t> namespace_offsets = {0, 1, 2, 3};
+  const std::vector<uint64_t> feature_indices = {1, 2, 3};
+
+  const uint64_t finished = vw->example_parser->num_finished_examples;
+  EXPECT_THROW(VW_LearnBatchCSR(handle, 3, example_offsets.data(), namespaces.data(), namespace_offsets.data(),
+                   feature_indices.data(), nullptr, nullptr, nullptr, nullptr),
+      VW::vw_exception);
+  EXPECT_EQ(vw->example_parser->num_finished_examples.load(), finished + 3);
+  VW_Finish(handle);
+}
+
+TEST(vwdll_test, vw_dll_csr_batch_rejects_non_scalar_predictions)
+{
+  VW_HANDLE handle = VW_InitializeA("--oaa 3 --quiet");
+  auto* vw = static_cast<VW::workspace*>(handle);
+  const std::vector<size_t> example_offsets = {0, 1};
+  const std::vector<unsigned char> namespaces = {'s'};
+  const std::vector<size_t> namespace_offsets = {0, 1};
+  const std::vector<uint64_t> feature_indices = {1};
+  std::vector<float> predictions(1);
+
+  const uint64_t finished = vw->example_parser->num_finished_examples;
+  EXPECT_THROW(VW_PredictBatchCSR(handle, 1, example_offsets.data(), namespaces.data(), namespace_offsets.data(),
+                   feature_indices.data(), nullptr, predictions.data()),
+      VW::vw_exception);
+  EXPECT_THROW(VW_LearnBatchCSR(handle, 1, example_offsets.data(), namespaces.data(), namespace_offsets.data(),
+                   feature_indices.data(), nullptr, nullptr, nullptr, predictions.data()),
+      VW::vw_exception);
+  // Nothing was taken from the example pool.
+  EXPECT_EQ(vw->example_parser->num_finished_examples.load(), finished);
+  VW_Finish(handle);
+}
+
+TEST(vwdll_test, vw_dll_predict_batch_rejects_non_scalar_predictions)
+{
+  VW_HANDLE handle = VW_InitializeA("--oaa 3 --quiet");
+  std::vector<VW_EXAMPLE> examples = {VW_ReadExampleA(handle, "1 | a b"), VW_ReadExampleA(handle, "2 | c")};
+  std::vector<float> predictions(examples.size());
+  EXPECT_THROW(VW_PredictBatch(handle, examples.data(), examples.size(), predictions.data()), VW::vw_exception);
+  for (auto example : examples) { VW_FinishExample(handle, example); }
+  VW_Finish(handle);
+}
+
 // This test seems to have issues on the older MSVC compiler CI, but no issues in the newer.
 #if (defined(_MSC_VER) && (_MSC_VER >= 1920)) || !defined(_MSC_VER)
 
@@ -0,0 +1,174 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/common/vw_exception.h"
+#include "vw/config/cli_help_formatter.h"
+#include "vw/config/options.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/cache.h"
+#include "vw/core/example.h"
+#include "vw/core/global_data.h"
+#include "vw/core/io_buf.h"
+#include "vw/core/memory.h"
+#include "vw/core/parse_primitives.h"
+#include "vw/core/parser.h"
+#include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
+#include "vw/io/logger.h"
+
+#include <string>
+#include <vector>
+
+using namespace VW::config;
+
+void print_help(const options_cli& options)
+{
+  const auto& option_groups = options.get_all_option_group_definitions();
+
+  VW::config::cli_help_formatter formatter;
+  std::cout << R"(Usage: vw-cache-convert [options] <cache_file>
+
+    Converts a row format cache file into the block cache format. The label type of the cache must be given with
+    --vw_args when it is not the simple label, for example --vw_args "--oaa 3".
+
+    Note: This is an experimental tool.
+)" << std::endl;
+  std::cout << formatter.format_help(option_groups);
+}
+
+struct command_line_options
+{
+  VW::io::log_level log_level{};
+  VW::io::output_location log_output_stream{};
+  std::string input_file;
+  std::string output_file;
+  std::string vw_args;
+  uint32_t examples_per_block = 0;
+};
+
+command_line_options parse_command_line(int argc, char** argv, VW::io::logger& logger)
+{
+  std::string log_level;
+  std::string log_output_stream;
+  bool help = false;
+  option_group_definition diagnostics_options("Diagnostics");
+  diagnostics_options.add(make_option("log_level", log_level)
+                              .default_value("info")
+                              .one_of({"info", "warn", "error", "critical", "off"})
+                              .help("Log level for logging messages."));
+  diagnostics_options.add(make_option("log_output", log_output_stream)
+                              .default_value("stderr")
+                              .one_of({"stdout", "stderr"})
+                              .help("Specify the stream to output log messages to."));
+  diagnostics_options.add(make_option("help", help).short_name("h").help("Output this help message."));
+
+  std::string output_file;
+  std::string vw_args;
+  uint32_t examples_per_block = 0;
+  option_group_definition convert_options("Convert cache");
+  convert_options.add(
+      make_option("output", output_file).short_name('o').help("Name of the block format cache file. Required."));
+  convert_options.add(make_option("vw_args", vw_args)
+                          .help("VW arguments which select the label type the cache was written with."));
+  convert_options.add(make_option("examples_per_block", examples_per_block)
+                          .default_value(VW::details::block_cache_writer::DEFAULT_EXAMPLES_PER_BLOCK)
+                          .help("Number of examples stored in each block."));
+
+  std::vector<std::string> args(argv + 1, argv + argc);
+  options_cli options(args);
+
+  options.add_and_parse(diagnostics_options);
+  options.add_and_parse(convert_options);
+  auto warnings = options.check_unregistered();
+  _UNUSED(warnings);
+
+  if (help)
+  {
+    print_help(options);
+    std::exit(0);
+  }
+
+  const auto cache_files = options.get_positional_tokens();
+  if (cache_files.size() != 1)
+  {
+    logger.error("Must specify exactly one cache file to convert.");
+    print_help(options);
+    std::exit(1);
+  }
+
+  if (!options.was_supplied("output"))
+  {
+    logger.error("Must specify an output file.");
+    print_help(options);
+    std::exit(1);
+  }
+
+  command_line_options result;
+  result.log_level = VW::io::get_log_level(log_level);
+  result.log_output_stream = VW::io::get_output_location(log_output_stream);
+  result.input_file = cache_files[0];
+  result.output_file = output_file;
+  result.vw_args = vw_args;
+  result.examples_per_block = examples_per_block;
+
+  return result;
+}
+
+int main(int argc, char* argv[])
+{
+  auto logger = VW::io::create_default_logger();
+  try
+  {
+    auto options = parse_command_line(argc, argv, logger);
+    logger.set_level(options.log_level);
+    logger.set_location(options.log_output_stream);
+
+    // The workspace only provides the label parser the cache was written with.
+    auto vw_args = VW::split_command_line(options.vw_args);
+    vw_args.emplace_back("--quiet");
+    auto all = VW::initialize_experimental(VW::make_unique<options_cli>(vw_args));
+
+    auto cache_reader = VW::io::open_file_reader(options.input_file);
+    VW::cache_format format;
+    const auto num_bits = VW::details::read_cache_header(*cache_reader, format);
+    if (format != VW::cache_format::row) { THROW("Input cache file is not in the row format: " << options.input_file); }
+    io_buf input;
+    input.add_file(std::move(cache_reader));
+
+    io_buf output;
+    output.add_file(VW::io::open_file_writer(options.output_file));
+    VW::details::write_cache_header(output, num_bits, VW::cache_format::block);
+
+    // Indices were masked when the row cache was written, so they are kept as they are.
+    const uint64_t parse_mask = (static_cast<uint64_t>(1) << num_bits) - 1;
+    VW::details::block_cache_writer writer(options.examples_per_block);
+    VW::example ex;
+    VW::multi_ex examples{&ex};
+    size_t num_examples = 0;
+    while (VW::read_example_from_cache(all.get(), input, examples) > 0)
+    {
+      writer.write(output, ex, all->example_parser->lbl_parser, parse_mask);
+      VW::empty_example(*all, ex);
+      num_examples++;
+    }
+    writer.flush(output);
+    output.flush();
+    output.close_file();
+
+    logger.info("Converted {} examples to: {}", num_examples, options.output_file);
+    VW::finish(*all, false);
+  }
+  catch (const VW::vw_exception& e)
+  {
+    logger.critical("({}:{}): {}", e.Filename(), e.LineNumber(), e.what());
+    return 1;
+  }
+  catch (const std::exception& e)
+  {
+    logger.critical("{}", e.what());
+    return 1;
+  }
+
+  return 0;
+}
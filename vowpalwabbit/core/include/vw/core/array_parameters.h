@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
-#include <unordered_map>
+#include <vector>
 
 #ifndef _WIN32
 #  define NOMINMAX
@@ -22,16 +25,36 @@
 #include "vw/common/vw_exception.h"
 #include "vw/core/array_parameters_dense.h"
 
-class sparse_parameters;
-using weight_map = std::unordered_map<uint64_t, weight*>;
+namespace VW
+{
+namespace details
+{
+constexpr size_t SPARSE_MIN_TABLE_SIZE = 64;
+constexpr size_t SPARSE_MIN_SLAB_BLOCKS = 64;
+constexpr size_t SPARSE_MAX_SLAB_BLOCKS = 1 << 16;
+
+// Slot of the open addressing table in sparse_parameters. Empty slots have a null weights pointer.
+struct sparse_weight_slot
+{
+  uint64_t index;
+  weight* weights;
+};
+}  // namespace details
+}  // namespace VW
 
 template <typename T>
 class sparse_iterator
 {
 private:
-  weight_map::iterator _iter;
+  VW::details::sparse_weight_slot* _current;
+  VW::details::sparse_weight_slot* _end;
   uint32_t _stride;
 
+  void skip_empty()
+  {
+    while (_current != _end && _current->weights == nullptr) { _current++; }
+  }
+
 public:
   using iterator_category = std::forward_iterator_tag;
   using value_type = T;
@@ -39,51 +62,130 @@ public:
   using pointer = T*;
   using reference = T&;
 
-  sparse_iterator(weight_map::iterator& iter, uint32_t stride) : _iter(iter), _stride(stride) {}
+  sparse_iterator(VW::details::sparse_weight_slot* current, VW::details::sparse_weight_slot* end, uint32_t stride)
+      : _current(current), _end(end), _stride(stride)
+  {
+    skip_empty();
+  }
 
   sparse_iterator& operator=(const sparse_iterator& other) = default;
   sparse_iterator(const sparse_iterator& other) = default;
   sparse_iterator& operator=(sparse_iterator&& other) noexcept = default;
   sparse_iterator(sparse_iterator&& other) noexcept = default;
 
-  uint64_t index() { return _iter->first; }
+  uint64_t index() { return _current->index; }
 
-  T& operator*() { return *(_iter->second); }
+  T& operator*() { return *(_current->weights); }
 
   sparse_iterator& operator++()
   {
-    _iter++;
+    _current++;
+    skip_empty();
     return *this;
   }
 
-  bool operator==(const sparse_iterator& rhs) const { return _iter == rhs._iter; }
-  bool operator!=(const sparse_iterator& rhs) const { return _iter != rhs._iter; }
+  bool operator==(const sparse_iterator& rhs) const { return _current == rhs._current; }
+  bool operator!=(const sparse_iterator& rhs) const { return _current != rhs._current; }
 };
 
+// Weights are stored in an open addressing hash table with linear probing, keyed by the masked weight index. The
+// table only holds pointers, the stride sized weight blocks themselves are carved out of large slabs so they never
+// move when the table grows and there is no allocation per weight.
 class sparse_parameters
 {
 private:
-  // This must be mutable because the const operator[] must be able to intialize default weights to return.
-  mutable weight_map _map;
-  uint64_t _weight_mask;  // (stride*(1 << num_bits) -1)
+  // These must be mutable because the const operator[] must be able to intialize default weights to return.
+  mutable std::vector<VW::details::sparse_weight_slot> _table;
+  mutable size_t _table_used;
+  mutable uint32_t _hash_shift;  // 64 - log2(table size)
+  // Slabs allocated by this instance, freed with it. Shallow copies point into the slabs of the source.
+  mutable std::vector<weight*> _slabs;
+  mutable weight* _slab_next;
+  mutable size_t _slab_remaining;  // in weights
+  uint64_t _weight_mask;           // (stride*(1 << num_bits) -1)
   uint32_t _stride_shift;
   bool _seeded;  // whether the instance is sharing model state with others
   bool _delete;
   std::function<void(weight*, uint64_t)> _default_func;
 
+  // Fibonacci hashing, weight indices are multiples of the stride so the low bits alone are poorly distributed.
+  inline size_t home_slot(uint64_t index) const
+  {
+    return static_cast<size_t>((index * 0x9E3779B97F4A7C15ULL) >> _hash_shift);
+  }
+
+  weight* allocate_block() const
+  {
+    if (_slab_remaining < stride())
+    {
+      const size_t blocks =
+          std::min(std::max(VW::details::SPARSE_MIN_SLAB_BLOCKS, _table_used), VW::details::SPARSE_MAX_SLAB_BLOCKS);
+      _slab_next = calloc_mergable_or_throw<weight>(blocks * stride());
+      _slabs.push_back(_slab_next);
+      _slab_remaining = blocks * stride();
+    }
+    weight* block = _slab_next;
+    _slab_next += stride();
+    _slab_remaining -= stride();
+    return block;
+  }
+
+  void insert_slot(uint64_t index, weight* weights) const
+  {
+    const size_t slot_mask = _table.size() - 1;
+    size_t slot = home_slot(index);
+    while (_table[slot].weights != nullptr) { slot = (slot + 1) & slot_mask; }
+    _table[slot].index = index;
+    _table[slot].weights = weights;
+  }
+
+  // Keeps the load factor at or below 3/4.
+  void grow_if_needed() const
+  {
+    if (4 * (_table_used + 1) <= 3 * _table.size()) { return; }
+    std::vector<VW::details::sparse_weight_slot> old_table(
+        std::max(VW::details::SPARSE_MIN_TABLE_SIZE, 2 * _table.size()), VW::details::sparse_weight_slot{0, nullptr});
+    old_table.swap(_table);
+    _hash_shift = 64;
+    for (size_t size = _table.size(); size > 1; size >>= 1) { _hash_shift--; }
+    for (const auto& slot : old_table)
+    {
+      if (slot.weights != nullptr) { insert_slot(slot.index, slot.weights); }
+    }
+  }
+
+  weight* insert_default(uint64_t index) const
+  {
+    grow_if_needed();
+    weight* block = allocate_block();
+    insert_slot(index, block);
+    _table_used++;
+    if (_default_func != nullptr) { _default_func(block, index); }
+    return block;
+  }
+
   // It is marked const so it can be used from both const and non const operator[]
-  // The map itself is mutable to facilitate this
+  // The table itself is mutable to facilitate this
   inline weight* get_or_default_and_get(size_t i) const
   {
-    uint64_t index = i & _weight_mask;
-    weight_map::iterator iter = _map.find(index);
-    if (iter == _map.end())
+    const uint64_t index = i & _weight_mask;
+    if (!_table.empty())
     {
-      _map.insert(std::make_pair(index, calloc_mergable_or_throw<weight>(stride())));
-      iter = _map.find(index);
-      if (_default_func != nullptr) { _default_func(iter->second, index); }
+      const size_t slot_mask = _table.size() - 1;
+      for (size_t slot = home_slot(index); _table[slot].weights != nullptr; slot = (slot + 1) & slot_mask)
+      {
+        if (_table[slot].index == index) { return _table[slot].weights; }
+      }
     }
-    return iter->second;
+    return insert_default(index);
+  }
+
+  void free_slabs()
+  {
+    for (auto* slab : _slabs) { free(slab); }
+    _slabs.clear();
+    _slab_next = nullptr;
+    _slab_remaining = 0;
   }
 
 public:
@@ -91,7 +193,11 @@ public:
   using const_iterator = sparse_iterator<const weight>;
 
   sparse_parameters(size_t length, uint32_t stride_shift = 0)
-      : _map()
+      : _table()
+      , _table_used(0)
+      , _hash_shift(64)
+      , _slab_next(nullptr)
+      , _slab_remaining(0)
       , _weight_mask((length << stride_shift) - 1)
       , _stride_shift(stride_shift)
       , _seeded(false)
@@ -101,7 +207,11 @@ public:
   }
 
   sparse_parameters()
-      : _map()
+      : _table()
+      , _table_used(0)
+      , _hash_shift(64)
+      , _slab_next(nullptr)
+      , _slab_remaining(0)
       , _weight_mask(0)
       , _stride_shift(0)
       , _seeded(false)
@@ -110,7 +220,7 @@ public:
   {
   }
 
-  bool not_null() { return (_weight_mask > 0 && !_map.empty()); }
+  bool not_null() { return (_weight_mask > 0 && _table_used > 0); }
 
   sparse_parameters(const sparse_parameters& other) = delete;
   sparse_parameters& operator=(const sparse_parameters& other) = delete;
@@ -120,51 +230,33 @@ public:
   weight* first() { THROW_OR_RETURN("Allreduce currently not supported in sparse", nullptr); }
 
   // iterator with stride
-  iterator begin()
-  {
-    weight_map::iterator i = _map.begin();
-    return iterator(i, stride());
-  }
-  iterator end()
-  {
-    weight_map::iterator i = _map.end();
-    return iterator(i, stride());
-  }
+  iterator begin() { return iterator(_table.data(), _table.data() + _table.size(), stride()); }
+  iterator end() { return iterator(_table.data() + _table.size(), _table.data() + _table.size(), stride()); }
 
   // const iterator
-  const_iterator cbegin() const
-  {
-    weight_map::iterator i = _map.begin();
-    return const_iterator(i, stride());
-  }
+  const_iterator cbegin() const { return const_iterator(_table.data(), _table.data() + _table.size(), stride()); }
   const_iterator cend() const
   {
-    weight_map::iterator i = _map.begin();
-    return const_iterator(i, stride());
+    return const_iterator(_table.data() + _table.size(), _table.data() + _table.size(), stride());
   }
 
-  inline weight& operator[](size_t i)
-  {
-    return *(get_or_default_and_get(i));
-  }
+  inline weight& operator[](size_t i) { return *(get_or_default_and_get(i)); }
 
   inline const weight& operator[](size_t i) const { return *(get_or_default_and_get(i)); }
 
   inline weight& strided_index(size_t index) { return operator[](index << _stride_shift); }
   inline const weight& strided_index(size_t index) const { return operator[](index << _stride_shift); }
 
+  // Number of weight blocks which have been touched.
+  size_t size() const { return _table_used; }
+
   void shallow_copy(const sparse_parameters& input)
   {
     // TODO: this is level-1 copy (weight* are stilled shared)
-    if (!_seeded)
-    {
-      for (auto& iter : _map)
-      {
-        auto* weight_ptr = iter.second;
-        free(weight_ptr);
-      }
-    }
-    _map = input._map;
+    free_slabs();
+    _table = input._table;
+    _table_used = input._table_used;
+    _hash_shift = input._hash_shift;
     _weight_mask = input._weight_mask;
     _stride_shift = input._stride_shift;
     _seeded = true;
@@ -178,7 +270,10 @@ public:
 
   void set_zero(size_t offset)
   {
-    for (auto& iter : _map) { (&(*(iter.second)))[offset] = 0; }
+    for (auto& slot : _table)
+    {
+      if (slot.weights != nullptr) { slot.weights[offset] = 0; }
+    }
   }
 
   uint64_t mask() const { return _weight_mask; }
@@ -197,14 +292,11 @@ public:
 
   ~sparse_parameters()
   {
-    if (!_delete && !_seeded)  // don't free weight vector if it is shared with another instance
+    // Weights of a shallow copy live in the slabs of its source, only blocks it created itself are in its own slabs.
+    if (!_delete)
     {
-      for (auto& iter : _map)
-      {
-        auto* weight_ptr = iter.second;
-        free(weight_ptr);
-      }
-      _map.clear();
+      free_slabs();
+      _table.clear();
       _delete = true;
     }
   }
@@ -219,6 +311,8 @@ public:
   bool sparse;
   dense_parameters dense_weights;
   sparse_parameters sparse_weights;
+  // Requested placement of the dense weights, applied when they are allocated.
+  VW::dense_allocation_options dense_allocation;
 
   inline weight& operator[](size_t i)
   {
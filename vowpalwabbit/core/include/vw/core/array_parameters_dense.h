@@ -11,7 +11,10 @@
 
 #include "vw/core/memory.h"
 
+#include <algorithm>
 #include <cassert>
+#include <string>
+#include <vector>
 
 // It appears that on OSX MAP_ANONYMOUS is mapped to MAP_ANON
 // https://github.com/leftmike/foment/issues/4
@@ -21,6 +24,48 @@
 
 using weight = float;
 
+namespace VW
+{
+enum class huge_page_policy
+{
+  none,
+  // Transparent huge pages requested with madvise(MADV_HUGEPAGE).
+  transparent,
+  // Pages from the reserved hugetlbfs pool (MAP_HUGETLB). Falls back to transparent huge pages when the pool is
+  // too small.
+  hugetlb
+};
+
+enum class numa_policy
+{
+  none,
+  // Pages are spread round robin over all memory nodes.
+  interleave,
+  // Pages are not touched when allocated, so each is placed on the node of the thread which first writes it.
+  first_touch
+};
+
+struct dense_allocation_options
+{
+  huge_page_policy huge_pages = huge_page_policy::none;
+  numa_policy numa = numa_policy::none;
+
+  bool is_default() const { return huge_pages == huge_page_policy::none && numa == numa_policy::none; }
+};
+
+huge_page_policy huge_page_policy_from_string(const std::string& policy);
+numa_policy numa_policy_from_string(const std::string& policy);
+std::string to_string(huge_page_policy policy);
+std::string to_string(numa_policy policy);
+
+namespace details
+{
+/// Maps zeroed memory for count weights according to options. options is updated to what could actually be applied.
+/// \returns the mapping, mapped_bytes is set to its size for munmap.
+weight* map_dense_weights(size_t count, dense_allocation_options& options, size_t& mapped_bytes);
+}  // namespace details
+}  // namespace VW
+
 template <typename T>
 class dense_iterator
 {
@@ -96,7 +141,25 @@ private:
   weight* _begin;
   uint64_t _weight_mask;  // (stride*(1 << num_bits) -1)
   uint32_t _stride_shift;
-  bool _seeded;  // whether the instance is sharing model state with others
+  bool _seeded;          // whether the instance is sharing model state with others
+  size_t _mapped_bytes;  // non zero if _begin was mapped instead of allocated on the heap
+  VW::dense_allocation_options _allocation;
+  // One bit per block of weights which changed since clear_dirty_blocks(), empty unless dirty tracking is enabled.
+  std::vector<uint64_t> _dirty_blocks;
+  uint32_t _dirty_block_bits = 0;  // log2 of the number of rows in a block
+
+  void free_weights()
+  {
+#ifndef _WIN32
+    if (_mapped_bytes != 0) { munmap(_begin, _mapped_bytes); }
+    else
+#endif
+    {
+      free(_begin);
+    }
+    _begin = nullptr;
+    _mapped_bytes = 0;
+  }
 
 public:
   using iterator = dense_iterator<weight>;
@@ -106,7 +169,23 @@ public:
       , _weight_mask((length << stride_shift) - 1)
       , _stride_shift(stride_shift)
       , _seeded(false)
+      , _mapped_bytes(0)
+  {
+  }
+
+  dense_parameters(size_t length, uint32_t stride_shift, const VW::dense_allocation_options& allocation)
+      : _begin(nullptr)
+      , _weight_mask((length << stride_shift) - 1)
+      , _stride_shift(stride_shift)
+      , _seeded(false)
+      , _mapped_bytes(0)
+      , _allocation(allocation)
   {
+    if (allocation.is_default()) { _begin = calloc_mergable_or_throw<weight>(length << stride_shift); }
+    else
+    {
+      _begin = VW::details::map_dense_weights(length << stride_shift, _allocation, _mapped_bytes);
+    }
   }
 
   dense_parameters()
@@ -114,6 +193,7 @@ public:
       , _weight_mask(0)
       , _stride_shift(0)
       , _seeded(false)
+      , _mapped_bytes(0)
   {
   }
 
@@ -144,13 +224,29 @@ public:
 
   void shallow_copy(const dense_parameters& input)
   {
-    if (!_seeded) { free(_begin); }
+    if (!_seeded) { free_weights(); }
     _begin = input._begin;
     _weight_mask = input._weight_mask;
     _stride_shift = input._stride_shift;
+    _allocation = input._allocation;
     _seeded = true;
   }
 
+#ifndef _WIN32
+  // Replaces the weights with a copy-on-write mapping of a model file, see VW::io::reader::map_private(). The
+  // mapping must hold mask() + 1 weights and is released with munmap.
+  void use_mapped_weights(weight* mapped, size_t mapped_bytes)
+  {
+    assert(!_seeded);
+    free_weights();
+    _begin = mapped;
+    _mapped_bytes = mapped_bytes;
+  }
+#endif
+
+  // The huge page and NUMA policies which were applied when the weights were allocated.
+  const VW::dense_allocation_options& allocation() const { return _allocation; }
+
   inline weight& strided_index(size_t index) { return operator[](index << _stride_shift); }
   inline const weight& strided_index(size_t index) const { return operator[](index << _stride_shift); }
 
@@ -167,6 +263,7 @@ public:
 
   void set_zero(size_t offset)
   {
+    mark_all_dirty();
     for (iterator iter = begin(); iter != end(); ++iter) { (&(*iter))[offset] = 0; }
   }
 
@@ -174,6 +271,7 @@ public:
   {
     assert(from < params_per_problem);
     assert(to < params_per_problem);
+    mark_all_dirty();
 
     auto iterator_from = begin() + from;
     auto iterator_to = begin() + to;
@@ -201,6 +299,7 @@ public:
   void clear_offset(const size_t offset, const size_t params_per_problem)
   {
     assert(offset < params_per_problem);
+    mark_all_dirty();
 
     for (auto iterator_clear = begin() + offset; iterator_clear < end(); iterator_clear += params_per_problem)
     {
@@ -212,6 +311,52 @@ public:
     }
   }
 
+  // Starts recording which blocks of 2^block_bits rows are written by learners, for delta snapshots. Writers of the
+  // weights must call mark_dirty() while tracking is enabled.
+  void enable_dirty_tracking(uint32_t block_bits)
+  {
+    const uint64_t rows = (_weight_mask + 1) >> _stride_shift;
+    const uint64_t blocks = std::max<uint64_t>(rows >> block_bits, 1);
+    _dirty_block_bits = block_bits;
+    _dirty_blocks.assign((blocks + 63) / 64, 0);
+  }
+
+  bool dirty_tracking() const { return !_dirty_blocks.empty(); }
+
+  inline void mark_dirty(const weight* w)
+  {
+    const uint64_t block = static_cast<uint64_t>(w - _begin) >> (_dirty_block_bits + _stride_shift);
+    _dirty_blocks[block >> 6] |= static_cast<uint64_t>(1) << (block & 63);
+  }
+
+  void mark_all_dirty() { std::fill(_dirty_blocks.begin(), _dirty_blocks.end(), ~static_cast<uint64_t>(0)); }
+
+  void clear_dirty_blocks() { std::fill(_dirty_blocks.begin(), _dirty_blocks.end(), 0); }
+
+  // The first row at or after row which is in a dirty block, or the number of rows if there is none.
+  uint64_t next_dirty_row(uint64_t row) const
+  {
+    const uint64_t rows = (_weight_mask + 1) >> _stride_shift;
+    uint64_t block = row >> _dirty_block_bits;
+    uint64_t word = block >> 6;
+    if (row >= rows || word >= _dirty_blocks.size()) { return rows; }
+
+    uint64_t bits = _dirty_blocks[word] & (~static_cast<uint64_t>(0) << (block & 63));
+    while (bits == 0)
+    {
+      if (++word == _dirty_blocks.size()) { return rows; }
+      bits = _dirty_blocks[word];
+    }
+    uint64_t first = word * 64;
+    while ((bits & 1) == 0)
+    {
+      bits >>= 1;
+      first++;
+    }
+    if (first != block) { row = first << _dirty_block_bits; }
+    return std::min(row, rows);
+  }
+
   uint64_t mask() const { return _weight_mask; }
 
   uint64_t seeded() const { return _seeded; }
@@ -226,13 +371,20 @@ public:
 #  ifndef DISABLE_SHARED_WEIGHTS
   void share(size_t length)
   {
-    float* shared_weights = static_cast<float*>(mmap(
-        nullptr, (length << _stride_shift) * sizeof(float), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+    const size_t shared_bytes = (length << _stride_shift) * sizeof(float);
+    float* shared_weights = static_cast<float*>(
+        mmap(nullptr, shared_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+#    ifdef MADV_HUGEPAGE
+    // Shared memory is only backed by huge pages if the kernel enables them for shmem, so this is best effort.
+    if (_allocation.huge_pages != VW::huge_page_policy::none)
+    { madvise(shared_weights, shared_bytes, MADV_HUGEPAGE); }
+#    endif
     size_t float_count = length << _stride_shift;
     weight* dest = shared_weights;
     memcpy(dest, _begin, float_count * sizeof(float));
-    free(_begin);
+    free_weights();
     _begin = dest;
+    _mapped_bytes = shared_bytes;
   }
 #  endif
 #endif
@@ -240,9 +392,6 @@ public:
   ~dense_parameters()
   {
     if (_begin != nullptr && !_seeded)  // don't free weight vector if it is shared with another instance
-    {
-      free(_begin);
-      _begin = nullptr;
-    }
+    { free_weights(); }
   }
 };
@@ -0,0 +1,111 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace VW
+{
+enum class weight_quantization
+{
+  // IEEE 754 half precision.
+  fp16,
+  // The upper 16 bits of a float, same range as float with 8 bits of mantissa.
+  bf16,
+  // Signed bytes with one float scale factor per block of weights.
+  int8
+};
+
+const char* to_string(weight_quantization quantization);
+
+uint16_t float_to_half(float value);
+uint16_t float_to_bfloat16(float value);
+
+inline float half_to_float(uint16_t half)
+{
+  constexpr uint32_t SHIFTED_EXPONENT = 0x7c00u << 13;
+  uint32_t bits = (half & 0x7fffu) << 13;
+  const uint32_t exponent = bits & SHIFTED_EXPONENT;
+  bits += (127u - 15u) << 23;
+  if (exponent == SHIFTED_EXPONENT) { bits += (128u - 16u) << 23; }  // inf or nan
+  else if (exponent == 0)                                            // zero or subnormal
+  {
+    constexpr uint32_t MAGIC_BITS = 113u << 23;
+    float magic;
+    std::memcpy(&magic, &MAGIC_BITS, sizeof(float));
+    bits += 1u << 23;
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    value -= magic;
+    std::memcpy(&bits, &value, sizeof(float));
+  }
+  bits |= static_cast<uint32_t>(half & 0x8000u) << 16;
+  float result;
+  std::memcpy(&result, &bits, sizeof(float));
+  return result;
+}
+
+inline float bfloat16_to_float(uint16_t value)
+{
+  const uint32_t bits = static_cast<uint32_t>(value) << 16;
+  float result;
+  std::memcpy(&result, &bits, sizeof(float));
+  return result;
+}
+
+/// Read only copy of a weight vector holding only the weight of each row, stored with 16 or 8 bits. Indexing works like
+/// dense_parameters, (index & mask) >> row_shift selects the row. This is meant for predict only models, where the
+/// learning state which makes up the rest of a row is not needed.
+class quantized_parameters
+{
+public:
+  // int8 weights share a scale factor per block of 2^INT8_BLOCK_BITS rows.
+  static constexpr uint32_t INT8_BLOCK_BITS = 6;
+
+  /// Quantizes the first float of each row of a dense weight array of mask + 1 floats.
+  quantized_parameters(const float* weights, uint64_t mask, uint32_t row_shift, weight_quantization quantization);
+
+  inline float operator[](size_t i) const
+  {
+    const uint64_t row = (i & _mask) >> _row_shift;
+    switch (_quantization)
+    {
+      case weight_quantization::fp16:
+        return half_to_float(_halves[row]);
+      case weight_quantization::bf16:
+        return bfloat16_to_float(_halves[row]);
+      default:
+        return _int8_values[row] * _scales[row >> INT8_BLOCK_BITS];
+    }
+  }
+
+  uint64_t mask() const { return _mask; }
+  uint32_t row_shift() const { return _row_shift; }
+  weight_quantization quantization() const { return _quantization; }
+  uint64_t rows() const { return _rows; }
+
+  /// 16 bit values of fp16 and bf16 weights.
+  const uint16_t* halves() const { return _halves.data(); }
+  /// int8 weights and the scale factors of their blocks.
+  const int8_t* int8_values() const { return _int8_values.data(); }
+  const float* scales() const { return _scales.data(); }
+
+  /// Bytes used to store the weights.
+  size_t memory_bytes() const;
+
+private:
+  uint64_t _mask;
+  uint32_t _row_shift;
+  weight_quantization _quantization;
+  uint64_t _rows;
+  // Both vectors are padded so that a 32 bit load at any row stays within the allocation, which the gathers of
+  // quantized_interaction_dot rely on.
+  std::vector<uint16_t> _halves;
+  std::vector<int8_t> _int8_values;
+  std::vector<float> _scales;
+};
+}  // namespace VW
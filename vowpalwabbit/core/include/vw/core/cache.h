@@ -4,24 +4,98 @@
 
 #pragma once
 
+#include "vw/core/io_buf.h"
 #include "vw/core/vw_fwd.h"
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace VW
 {
+enum class cache_format
+{
+  // Every example is written on its own, with each feature as a delta encoded varint followed by its value.
+  row,
+  // Examples are grouped into blocks which store labels, feature indices and feature values as separate streams.
+  block
+};
+
 namespace details
 {
+/// Writes the header every cache file starts with.
+void write_cache_header(io_buf& output, uint32_t num_bits, cache_format format);
+/// Reads and validates the header of a cache file.
+/// \returns the number of bits the cache was created with
+uint32_t read_cache_header(VW::io::reader& cache_reader, cache_format& format);
+
 void cache_tag(io_buf& cache, const VW::v_array<char>& tag);
 void cache_index(io_buf& cache, VW::namespace_index index);
 void cache_features(io_buf& cache, const features& feats, uint64_t mask);
 size_t read_cached_tag(io_buf& cache, VW::v_array<char>& tag);
 size_t read_cached_index(io_buf& input, VW::namespace_index& index);
 size_t read_cached_features(io_buf& input, features& feats, bool& sorted);
+
+/// Writes examples in the block cache format. Examples are buffered and written as one block per examples_per_block
+/// examples. A block starts with a fixed size header holding the number of examples and the size of each stream, so
+/// readers can skip whole blocks. It is followed by three streams:
+///  - meta: label, tag, newline marker and for every namespace its index, feature count and whether values are stored
+///  - indices: zig-zag encoded index deltas, stream vbyte encoded if they all fit in 32 bits and varints otherwise
+///  - values: raw floats, namespaces whose values are all 1 store none
+class block_cache_writer
+{
+public:
+  static constexpr uint32_t DEFAULT_EXAMPLES_PER_BLOCK = 1024;
+
+  explicit block_cache_writer(uint32_t examples_per_block = DEFAULT_EXAMPLES_PER_BLOCK);
+
+  /// Buffers ex and writes a block to output once it is full.
+  void write(io_buf& output, const VW::example& ex, VW::label_parser& lbl_parser, uint64_t parse_mask);
+  /// Writes any buffered examples as a final, partial block.
+  void flush(io_buf& output);
+
+private:
+  uint32_t _examples_per_block;
+  uint32_t _num_examples = 0;
+  bool _wide_indices = false;
+  std::shared_ptr<std::vector<char>> _meta_backing;
+  io_buf _meta;
+  std::vector<uint64_t> _index_deltas;
+  std::vector<float> _values;
+  // Scratch space for encoding the index stream.
+  std::vector<uint32_t> _narrow_deltas;
+  std::vector<uint8_t> _encoded_indices;
+};
+
+/// Reads what block_cache_writer writes. A block is decoded as a whole when its first example is read.
+class block_cache_reader
+{
+public:
+  /// Same contract as read_example_from_cache.
+  int read(VW::label_parser& lbl_parser, io_buf& input, VW::multi_ex& examples);
+  /// Drops the rest of the current block, used when the input is reset.
+  void reset();
+
+private:
+  bool load_block(io_buf& input);
+
+  uint32_t _remaining = 0;
+  bool _wide_indices = false;
+  std::vector<char> _meta;
+  io_buf _meta_buf;
+  std::vector<uint32_t> _narrow_deltas;
+  std::vector<uint64_t> _wide_deltas;
+  size_t _num_deltas = 0;
+  size_t _next_delta = 0;
+  std::vector<float> _values;
+  size_t _next_value = 0;
+};
 }  // namespace details
 
 // What is written by write_example_to_cache can be read by read_example_from_cache
 void write_example_to_cache(io_buf& output, VW::example* ex_ptr, VW::label_parser& lbl_parser, uint64_t parse_mask,
     VW::details::cache_temp_buffer& temp_buffer);
 int read_example_from_cache(VW::workspace* all, io_buf& input, VW::multi_ex& examples);
+// Reads the block cache format using the parser's block_cache_reader.
+int read_example_from_block_cache(VW::workspace* all, io_buf& input, VW::multi_ex& examples);
 }  // namespace VW
@@ -0,0 +1,29 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/vw_fwd.h"
+
+#include <cstddef>
+
+namespace VW
+{
+namespace details
+{
+// A connection stops being read while more than this many bytes of its predictions are waiting to be sent.
+constexpr size_t DAEMON_MAX_PENDING_OUTPUT = 1 << 20;
+// A connection is closed if it sends a line longer than this.
+constexpr size_t DAEMON_MAX_LINE_LENGTH = 1 << 24;
+
+/// Whether this platform supports --daemon_server epoll.
+bool epoll_daemon_supported();
+
+/// Serves predictions to all clients of the listening daemon socket from the calling thread, until SIGTERM or SIGINT
+/// is received. Every connection is parsed incrementally: each complete line (text) or JSON object (--json and
+/// --dsjson) is predicted on and its prediction is written back in the order the requests arrived, so clients may
+/// pipeline requests. Connections which do not read their predictions are not read from until they catch up.
+void run_epoll_daemon(VW::workspace& all);
+}  // namespace details
+}  // namespace VW
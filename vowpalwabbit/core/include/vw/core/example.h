@@ -82,8 +82,10 @@ struct example : public example_predict  // core example datatype.
 
   example(const example&) = delete;
   example& operator=(const example&) = delete;
-  example(example&& other) = default;
-  example& operator=(example&& other) = default;
+  // owning_pool belongs to the object a pool allocated rather than to its contents, so a move clears it on the source
+  // and leaves the target with its own: none for a new example, and what it had before for an assigned one.
+  example(example&& other) noexcept;
+  example& operator=(example&& other) noexcept;
 
   // input fields
   polylabel l;
@@ -115,6 +117,8 @@ struct example : public example_predict  // core example datatype.
   bool end_pass = false;  // special example indicating end of pass.
   bool sorted = false;    // Are the features sorted or not?
   bool is_newline = false;
+  // Example pool this example was allocated by, null if it was allocated outside of a parser.
+  const void* owning_pool = nullptr;
 
   size_t get_num_features() const noexcept { return num_features + num_features_from_interactions; }
 
@@ -0,0 +1,133 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/hashstring.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+struct feature_hash_cache_stats
+{
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+  // Names too long to be stored, these are always hashed.
+  uint64_t uncacheable = 0;
+
+  feature_hash_cache_stats& operator+=(const feature_hash_cache_stats& other)
+  {
+    hits += other.hits;
+    misses += other.misses;
+    evictions += other.evictions;
+    uncacheable += other.uncacheable;
+    return *this;
+  }
+};
+
+/// Bounded memo of hash_func(name, seed), for inputs where the same feature names occur over and over. The seed is the
+/// hash of the namespace, so equal names in different namespaces are different entries.
+///
+/// Entries are stored in buckets of BUCKET_SIZE slots of one cache line each. The bucket is picked by a cheap hash of
+/// the name and seed, and a 32 bit tag of the same hash filters the slots before the names are compared. When a bucket
+/// is full an entry is evicted with the CLOCK algorithm: the hand of the bucket passes over entries used since it last
+/// passed them, clearing their flag, and evicts the first one which was not used. The cache is not thread safe, every
+/// parse thread has its own.
+class feature_hash_cache
+{
+public:
+  static constexpr size_t BUCKET_SIZE = 8;
+  // Longer names are not stored, this keeps a slot in one cache line.
+  static constexpr size_t MAX_NAME_LENGTH = 42;
+
+  /// capacity is the maximum number of names kept, it is rounded up to a power of two number of buckets.
+  feature_hash_cache(hash_func_t hasher, size_t capacity);
+
+  uint64_t hash(const char* name, size_t length, uint64_t seed)
+  {
+    if (length > MAX_NAME_LENGTH)
+    {
+      _stats.uncacheable++;
+      return _hasher(name, length, seed);
+    }
+
+    const uint64_t prehash = quick_hash(name, length, seed);
+    const auto tag = static_cast<uint32_t>(prehash >> 32);
+    slot* bucket = _slots.data() + (prehash & _bucket_mask) * BUCKET_SIZE;
+    for (size_t i = 0; i < BUCKET_SIZE; i++)
+    {
+      slot& s = bucket[i];
+      if (s.tag == tag && s.length == length && s.seed == seed && std::memcmp(s.name, name, length) == 0)
+      {
+        _stats.hits++;
+        s.referenced = 1;
+        return s.value;
+      }
+    }
+
+    _stats.misses++;
+    const uint64_t value = _hasher(name, length, seed);
+    insert(bucket, prehash & _bucket_mask, tag, name, length, seed, value);
+    return value;
+  }
+
+  const feature_hash_cache_stats& stats() const { return _stats; }
+  size_t capacity() const { return _slots.size(); }
+
+  /// Cheap hash which picks the bucket and tag, this is not the feature hash.
+  static uint64_t quick_hash(const char* name, size_t length, uint64_t seed)
+  {
+    constexpr uint64_t MULTIPLIER = 0x9e3779b97f4a7c15ULL;
+    uint64_t h = (seed ^ length) * MULTIPLIER;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8)
+    {
+      uint64_t word;
+      std::memcpy(&word, name + i, sizeof(word));
+      h = (h ^ word) * MULTIPLIER;
+      h ^= h >> 29;
+    }
+    if (i < length)
+    {
+      uint64_t word = 0;
+      std::memcpy(&word, name + i, length - i);
+      h = (h ^ word) * MULTIPLIER;
+    }
+    h ^= h >> 32;
+    h *= MULTIPLIER;
+    return h ^ (h >> 29);
+  }
+
+private:
+  // 64 bytes, one cache line.
+  struct slot
+  {
+    uint64_t seed;
+    uint64_t value;
+    uint32_t tag;
+    // EMPTY_SLOT if the slot does not hold a name.
+    uint8_t length;
+    uint8_t referenced;
+    char name[MAX_NAME_LENGTH];
+  };
+  static constexpr uint8_t EMPTY_SLOT = 0xff;
+
+  void insert(slot* bucket, uint64_t bucket_index, uint32_t tag, const char* name, size_t length, uint64_t seed,
+      uint64_t value);
+
+  hash_func_t _hasher;
+  std::vector<slot> _slots;
+  std::vector<uint8_t> _hands;
+  uint64_t _bucket_mask;
+  feature_hash_cache_stats _stats;
+};
+}  // namespace details
+}  // namespace VW
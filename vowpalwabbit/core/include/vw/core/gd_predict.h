@@ -4,8 +4,11 @@
 #pragma once
 
 #include "interactions_predict.h"
+#include "vw/core/array_parameters_dense.h"
+#include "vw/core/array_parameters_quantized.h"
 #include "vw/core/debug_log.h"
 #include "vw/core/example_predict.h"
+#include "vw/core/interactions_simd.h"
 #include "vw/core/v_array.h"
 
 #undef VW_DEBUG_LOG
@@ -99,6 +102,43 @@ inline void foreach_feature(WeightsT& weights, bool ignore_some_linear, std::arr
 }
 
 inline void vec_add(float& p, float fx, float fw) { p += fw * fx; }
+}  // namespace GD
+
+namespace INTERACTIONS
+{
+// Prediction over dense weights is a dot product, which is computed for a whole range of features at once. The
+// products are still added to dat one at a time, so the prediction does not change.
+template <>
+struct batched_inner_kernel<float, float, GD::vec_add, dense_parameters>
+{
+  static bool run(float& dat, const features::const_audit_iterator& begin, const features::const_audit_iterator& end,
+      uint64_t offset, dense_parameters& weights, feature_value ft_value, feature_index halfhash)
+  {
+    const auto count = static_cast<size_t>(end - begin);
+    if (count < MIN_BATCHED_KERNEL_FEATURES) { return false; }
+    dat = dense_interaction_dot(
+        dat, weights.first(), weights.mask(), &begin.index(), &begin.value(), count, halfhash, offset, ft_value);
+    return true;
+  }
+};
+
+// The weights are widened to floats while the dot product is computed.
+template <>
+struct batched_inner_kernel<float, float, GD::vec_add, VW::quantized_parameters>
+{
+  static bool run(float& dat, const features::const_audit_iterator& begin, const features::const_audit_iterator& end,
+      uint64_t offset, VW::quantized_parameters& weights, feature_value ft_value, feature_index halfhash)
+  {
+    const auto count = static_cast<size_t>(end - begin);
+    if (count < MIN_BATCHED_KERNEL_FEATURES) { return false; }
+    dat = quantized_interaction_dot(dat, weights, &begin.index(), &begin.value(), count, halfhash, offset, ft_value);
+    return true;
+  }
+};
+}  // namespace INTERACTIONS
+
+namespace GD
+{
 
 template <class WeightsT>
 inline float inline_predict(WeightsT& weights, bool ignore_some_linear, std::array<bool, NUM_NAMESPACES>& ignore_linear,
@@ -65,6 +65,11 @@ enum class AllReduceType;
 namespace VW
 {
 struct default_reduction_stack_setup;
+class reduction_profiler;
+namespace details
+{
+class model_checkpointer;
+}
 namespace parsers
 {
 namespace flatbuffer
@@ -116,6 +121,9 @@ public:
   AllReduceType all_reduce_type;
   AllReduce* all_reduce;
 
+  // Number of threads which learn concurrently from the parsed examples, see --learn_threads.
+  uint64_t learn_threads = 1;
+
   bool chain_hash_json = false;
 
   VW::LEARNER::base_learner* l;         // the top level learner
@@ -126,6 +134,8 @@ public:
   void learn(multi_ex&);
   void predict(example&);
   void predict(multi_ex&);
+  // Predicts count independent single line examples. Reductions which support it score the batch as a whole.
+  void predict_batch(example** examples, size_t count);
   void finish_example(example&);
   void finish_example(multi_ex&);
 
@@ -155,6 +165,9 @@ public:
   // Used to implement the external binary parser.
   std::vector<std::function<void(VW::metric_sink&)>> metric_output_hooks;
 
+  // Set by --profile_reductions.
+  std::unique_ptr<VW::reduction_profiler> profiler;
+
   // Experimental field.
   // Generic parser interface to make it possible to use any external parser.
   std::unique_ptr<VW::details::input_parser> custom_parser;
@@ -163,8 +176,18 @@ public:
 
   bool daemon;
   uint64_t num_children;
+  // Serve all daemon connections from one process with an event loop, see --daemon_server.
+  bool epoll_daemon = false;
 
   bool save_per_pass;
+  // Set by --async_checkpoint, --checkpoint_every_examples and --checkpoint_every_seconds.
+  std::unique_ptr<VW::details::model_checkpointer> checkpointer;
+  // True while a delta snapshot is written or read. gd then only writes the rows of dirty weight blocks, and reads
+  // rows over the current weights.
+  bool model_delta = false;
+  // Save dense weights as a page aligned array which predict only runs map instead of parsing. Set by
+  // --page_aligned_weights.
+  bool page_aligned_weights = false;
   float initial_weight;
   float initial_constant;
 
@@ -190,6 +213,7 @@ public:
   std::unique_ptr<VW::io::writer> stdout_adapter;
 
   std::vector<std::string> initial_regressors;
+  std::vector<std::string> initial_deltas;  // delta snapshots applied in order after the initial regressor
 
   std::string feature_mask;
 
@@ -261,6 +285,9 @@ public:
                                         // passes learning a single policy
 
   INTERACTIONS::generate_interactions_object_cache _generate_interactions_object_cache;
+  // Scratch space for generating interactions. This is _generate_interactions_object_cache unless the calling thread
+  // installed its own with set_thread_interactions_cache.
+  INTERACTIONS::generate_interactions_object_cache& interactions_cache();
 
   size_t normalized_idx;  // offset idx where the norm is stored (1 or 2 depending on whether adaptive is true)
 
@@ -331,6 +358,13 @@ public:
 private:
   std::unordered_map<reduction_setup_fn, std::string> _setup_name_map;
 };
+
+namespace details
+{
+// Threads which learn concurrently on one workspace each need their own scratch space for generating interactions.
+// Passing nullptr restores the workspace owned cache for the calling thread.
+void set_thread_interactions_cache(INTERACTIONS::generate_interactions_object_cache* cache);
+}  // namespace details
 }  // namespace VW
 
 void print_result_by_ref(
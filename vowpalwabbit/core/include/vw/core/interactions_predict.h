@@ -229,6 +229,19 @@ std::vector<features_range_t> inline generate_generic_char_combination(
   return inter;
 }
 
+// Inner kernels which can process a whole range of features at once specialize this, see GD::vec_add for
+// dense_parameters. run returns false when it did not handle the range and the features must be visited one at a time.
+template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), class WeightsT>
+struct batched_inner_kernel
+{
+  static bool run(DataT& /*dat*/, const features::const_audit_iterator& /*begin*/,
+      const features::const_audit_iterator& /*end*/, uint64_t /*offset*/, WeightsT& /*weights*/,
+      feature_value /*ft_value*/, feature_index /*halfhash*/)
+  {
+    return false;
+  }
+};
+
 template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), bool audit,
     void (*audit_func)(DataT&, const VW::audit_strings*), class WeightsT>
 void inner_kernel(DataT& dat, features::const_audit_iterator& begin, features::const_audit_iterator& end,
@@ -246,6 +259,9 @@ void inner_kernel(DataT& dat, features::const_audit_iterator& begin, features::c
   }
   else
   {
+    if (batched_inner_kernel<DataT, WeightOrIndexT, FuncT, WeightsT>::run(
+            dat, begin, end, offset, weights, ft_value, halfhash))
+    { return; }
     for (; begin != end; ++begin)
     {
       call_FuncT<DataT, FuncT>(
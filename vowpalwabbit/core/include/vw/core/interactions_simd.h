@@ -0,0 +1,43 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/array_parameters_quantized.h"
+#include "vw/core/feature_group.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace INTERACTIONS
+{
+// Ranges shorter than this are left to the scalar inner kernel, the batched kernel does not pay off for them.
+constexpr size_t MIN_BATCHED_KERNEL_FEATURES = 8;
+
+/// Adds the dot product of the last term of an interaction with a dense weight vector to sum:
+///   for each i, sum += weights[((indices[i] ^ halfhash) + offset) & weight_mask] * (ft_value * values[i])
+/// This is what inner_kernel computes for GD::vec_add one feature at a time, and the products are added in the same
+/// order so the result is exactly the same. The AVX2 implementation computes eight interacted indices at once, gathers
+/// their weights and multiplies them in one go. It is selected at runtime when the cpu supports it, otherwise a scalar
+/// loop is used.
+float dense_interaction_dot(float sum, const float* weights, uint64_t weight_mask, const feature_index* indices,
+    const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset, feature_value ft_value);
+
+/// Portable implementation of dense_interaction_dot.
+float dense_interaction_dot_scalar(float sum, const float* weights, uint64_t weight_mask, const feature_index* indices,
+    const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset, feature_value ft_value);
+
+/// dense_interaction_dot over quantized weights. The AVX2 implementation gathers the 16 or 8 bit values of eight rows
+/// and widens them to floats in registers, so it does not need the F16C extension.
+float quantized_interaction_dot(float sum, const VW::quantized_parameters& weights, const feature_index* indices,
+    const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset, feature_value ft_value);
+
+/// Portable implementation of quantized_interaction_dot.
+float quantized_interaction_dot_scalar(float sum, const VW::quantized_parameters& weights,
+    const feature_index* indices, const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset,
+    feature_value ft_value);
+
+/// True if dense_interaction_dot uses the AVX2 kernel on this machine.
+bool has_simd_interaction_kernel();
+}  // namespace INTERACTIONS
@@ -13,6 +13,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -40,6 +41,10 @@
 ** The interval [head, _buffer._end] may be shifted down to _buffer._begin
 ** if the requested number of bytes to be read is larger than the interval size.
 ** This is done to avoid reallocating arrays as much as possible.
+**
+** When the current input file supports VW::io::reader::read_view and nothing is
+** left over from the previous file, _buffer points directly into the memory of
+** the reader instead of the owned array. See begin_view and end_view.
 */
 
 class io_buf
@@ -98,6 +103,14 @@ class io_buf
   // file descriptor currently being used.
   size_t _current = 0;
 
+  // Bytes flushed to the output file so far.
+  size_t _flushed_bytes = 0;
+
+  // Set while _buffer points into a view of input_files[_current]. The owned array is kept here meanwhile.
+  bool _viewing = false;
+  char* _owned_begin = nullptr;
+  char* _owned_end_array = nullptr;
+
   std::vector<std::unique_ptr<VW::io::reader>> input_files;
   std::vector<std::unique_ptr<VW::io::writer>> output_files;
 
@@ -108,6 +121,8 @@ public:
     head = _buffer._begin;
   }
 
+  ~io_buf() { end_view(); }
+
   io_buf(io_buf& other) = delete;
   io_buf& operator=(io_buf& other) = delete;
   io_buf(io_buf&& other) = delete;
@@ -140,6 +155,7 @@ public:
   {
     assert(input_files.empty());
     output_files.push_back(std::move(file));
+    _flushed_bytes = 0;
   }
 
   /**
@@ -199,12 +215,17 @@ public:
   //   - Read mode: The offset of the position that has been read up to so far.
   size_t unflushed_bytes_count() { return head - _buffer._begin; }
 
+  /// Write mode: the offset in the output file the next write goes to.
+  size_t output_position() const { return _flushed_bytes + (head - _buffer._begin); }
+
   void flush();
 
   bool close_file()
   {
     if (!input_files.empty())
     {
+      // Unread bytes of a view must be copied out before the reader goes away.
+      end_view();
       input_files.pop_back();
       return true;
     }
@@ -301,6 +322,24 @@ public:
   size_t copy_to(void* dst, size_t max_size);
   void replace_buffer(char* buf, size_t capacity);
   char* buffer_start() { return _buffer._begin; }  // This should be replaced with slicing.
+
+  /// True while reading directly out of the memory of the current input file.
+  bool is_viewing() const { return _viewing; }
+
+  /// True if the bytes loaded but not yet read contain terminal, in which case readto does not read from the input.
+  bool has_buffered(char terminal) const
+  {
+    return head < _buffer._end && std::memchr(head, terminal, _buffer._end - head) != nullptr;
+  }
+
+  /// Makes more input bytes available after head, moving on to the next file as needed. Returns false once every
+  /// input file is exhausted. Reads from each input file at most once per call.
+  bool load_more();
+
+private:
+  void begin_view(char* data, size_t len);
+  // Switches back to the owned array, copying any unread bytes of the view to its front.
+  void end_view();
 };
 
 inline size_t bin_read(io_buf& i, char* data, size_t len)
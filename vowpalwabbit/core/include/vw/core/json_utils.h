@@ -2,6 +2,7 @@
 
 #include "vw/common/hash.h"
 #include "vw/core/feature_group.h"
+#include "vw/core/feature_hash_cache.h"
 #include "vw/core/global_data.h"
 #include "vw/core/vw.h"
 
@@ -31,6 +32,13 @@ struct Namespace
   features* ftrs;
   size_t feature_count;
   const char* name;
+  // Memo of feature name hashes, may be null.
+  VW::details::feature_hash_cache* hash_cache;
+
+  uint64_t hash(const char* str, size_t length, uint64_t seed, hash_func_t hash_func) const
+  {
+    return hash_cache != nullptr ? hash_cache->hash(str, length, seed) : hash_func(str, length, seed);
+  }
 
   void AddFeature(feature_value v, feature_index i, const char* feature_name)
   {
@@ -45,7 +53,7 @@ struct Namespace
 
   void AddFeature(const char* str, hash_func_t hash_func, uint64_t parse_mask)
   {
-    auto hashed_feature = hash_func(str, strlen(str), namespace_hash) & parse_mask;
+    auto hashed_feature = hash(str, strlen(str), namespace_hash, hash_func) & parse_mask;
     ftrs->push_back(1., hashed_feature);
     feature_count++;
 
@@ -54,7 +62,9 @@ struct Namespace
 
   void AddFeature(const char* key, const char* value, hash_func_t hash_func, uint64_t parse_mask)
   {
-    ftrs->push_back(1., VW::chain_hash_static(key, value, namespace_hash, hash_func, parse_mask));
+    // chain hash is hash(feature_value, hash(feature_name, namespace_hash)) & parse_mask
+    ftrs->push_back(1.,
+        hash(value, strlen(value), hash(key, strlen(key), namespace_hash, hash_func), hash_func) & parse_mask);
     feature_count++;
     if (audit) { ftrs->space_names.emplace_back(name, key, value); }
   }
@@ -62,11 +72,12 @@ struct Namespace
 
 template <bool audit>
 void push_ns(VW::example* ex, const char* ns, std::vector<Namespace<audit>>& namespaces, hash_func_t hash_func,
-    uint64_t hash_seed)
+    uint64_t hash_seed, VW::details::feature_hash_cache* hash_cache = nullptr)
 {
   Namespace<audit> n;
   n.feature_group = ns[0];
-  n.namespace_hash = hash_func(ns, strlen(ns), hash_seed);
+  n.hash_cache = hash_cache;
+  n.namespace_hash = n.hash(ns, strlen(ns), hash_seed, hash_func);
   n.ftrs = ex->feature_space.data() + ns[0];
   n.feature_count = 0;
   n.name = ns;
@@ -35,10 +35,13 @@
 #include "vw/core/label_type.h"
 #include "vw/core/metric_sink.h"
 #include "vw/core/prediction_type.h"
+#include "vw/core/profile_scope.h"
 #include "vw/core/scope_exit.h"
 
 namespace VW
 {
+class reduction_profiler;
+
 /// \brief Contains the VW::LEARNER::learner object and utilities for
 /// interacting with it.
 namespace LEARNER
@@ -86,6 +89,7 @@ struct learn_data
   using fn = void (*)(void* data, base_learner& base, void* ex);
   using multi_fn = void (*)(void* data, base_learner& base, void* ex, size_t count, size_t step, polyprediction* pred,
       bool finalize_predictions);
+  using batch_fn = void (*)(void* data, base_learner& base, void* examples, size_t count);
 
   void* data = nullptr;
   base_learner* base = nullptr;
@@ -93,6 +97,7 @@ struct learn_data
   fn predict_f = nullptr;
   fn update_f = nullptr;
   multi_fn multipredict_f = nullptr;
+  batch_fn predict_batch_f = nullptr;
 };
 
 struct sensitivity_data
@@ -195,6 +200,9 @@ inline void decrement_offset(multi_ex& ec_seq, const size_t increment, const siz
   }
   debug_decrement_depth(ec_seq);
 }
+
+inline size_t example_count(const example&) { return 1; }
+inline size_t example_count(const multi_ex& ec_seq) { return ec_seq.size(); }
 }  // namespace details
 
 bool ec_is_example_header(example const& ec, label_type_t label_type);
@@ -256,6 +264,11 @@ private:
 
   std::shared_ptr<void> learner_data;
 
+  // Set by set_profiler() when --profile_reductions is used, otherwise calls are not timed.
+  VW::reduction_profiler* _profiler = nullptr;
+  const VW::details::profile_frame* _profile_frame = nullptr;
+  const VW::details::profile_frame* _finish_profile_frame = nullptr;
+
   learner() = default;  // Should only be able to construct a learner through make_reduction_learner / make_base_learner
 
   /// \private
@@ -295,6 +308,7 @@ public:
   {
     assert((is_multiline() && std::is_same<multi_ex, E>::value) ||
         (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
+    VW::details::profile_scope profile(_profiler, _profile_frame, details::example_count(ec));
     details::increment_offset(ec, increment, i);
     debug_log_message(ec, "learn");
     learn_fd.learn_f(learn_fd.data, *learn_fd.base, (void*)&ec);
@@ -314,16 +328,45 @@ public:
   {
     assert((is_multiline() && std::is_same<multi_ex, E>::value) ||
         (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
+    VW::details::profile_scope profile(_profiler, _profile_frame, details::example_count(ec));
     details::increment_offset(ec, increment, i);
     debug_log_message(ec, "predict");
     learn_fd.predict_f(learn_fd.data, *learn_fd.base, (void*)&ec);
     details::decrement_offset(ec, increment, i);
   }
 
+  /// \brief Make predictions for a batch of independent examples.
+  /// \param examples Array of count ::example or ::multi_ex pointers. Each
+  /// one **must** have a valid prediction allocated, as for predict().
+  /// \param i This is the offset used for the weights in this call.
+  /// \returns The prediction for each item is set as predict() would set it.
+  /// Reductions that implement predict_batch can overlap the work for
+  /// consecutive items, otherwise this calls predict() on each item in turn.
+  inline void predict_batch(E** examples, size_t count, size_t i = 0)
+  {
+    assert((is_multiline() && std::is_same<multi_ex, E>::value) ||
+        (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
+    if (learn_fd.predict_batch_f == nullptr)
+    {
+      for (size_t n = 0; n < count; n++) { predict(*examples[n], i); }
+      return;
+    }
+
+    VW::details::profile_scope profile(_profiler, _profile_frame, count);
+    for (size_t n = 0; n < count; n++)
+    {
+      details::increment_offset(*examples[n], increment, i);
+      debug_log_message(*examples[n], "predict_batch");
+    }
+    learn_fd.predict_batch_f(learn_fd.data, *learn_fd.base, (void*)examples, count);
+    for (size_t n = 0; n < count; n++) { details::decrement_offset(*examples[n], increment, i); }
+  }
+
   inline void multipredict(E& ec, size_t lo, size_t count, polyprediction* pred, bool finalize_predictions)
   {
     assert((is_multiline() && std::is_same<multi_ex, E>::value) ||
         (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
+    VW::details::profile_scope profile(_profiler, _profile_frame, details::example_count(ec));
     if (learn_fd.multipredict_f == nullptr)
     {
       details::increment_offset(ec, increment, lo);
@@ -359,6 +402,7 @@ public:
   {
     assert((is_multiline() && std::is_same<multi_ex, E>::value) ||
         (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
+    VW::details::profile_scope profile(_profiler, _profile_frame, details::example_count(ec));
     details::increment_offset(ec, increment, i);
     debug_log_message(ec, "update");
     learn_fd.update_f(learn_fd.data, *learn_fd.base, (void*)&ec);
@@ -420,12 +464,22 @@ public:
     if (end_examples_fd.base) { end_examples_fd.base->end_examples(); }
   }
 
+  // Times every learn, predict and finish_example call of this learner and its bases with profiler.  Autorecursive.
+  void set_profiler(VW::reduction_profiler& profiler)
+  {
+    _profiler = &profiler;
+    _profile_frame = VW::details::get_profile_frame(profiler, name);
+    _finish_profile_frame = VW::details::get_profile_frame(profiler, name + ".finish_example");
+    if (learn_fd.base) { learn_fd.base->set_profiler(profiler); }
+  }
+
   // Called at the beginning by the driver.  Explicitly not recursive.
   void init_driver() { init_fd.func(init_fd.data); }
 
   // called after learn example for each example.  Explicitly not recursive.
   inline void finish_example(VW::workspace& all, E& ec)
   {
+    VW::details::profile_scope profile(_profiler, _finish_profile_frame, details::example_count(ec));
     debug_log_message(ec, "finish_example");
     finish_example_fd.finish_example_f(all, finish_example_fd.data, (void*)&ec);
   }
@@ -594,6 +648,12 @@ struct common_learner_builder
     return *static_cast<FluentBuilderT*>(this);
   }
 
+  FluentBuilderT& set_predict_batch(void (*fn_ptr)(DataT&, BaseLearnerT&, ExampleT**, size_t))
+  {
+    this->_learner->learn_fd.predict_batch_f = (details::learn_data::batch_fn)fn_ptr;
+    return *static_cast<FluentBuilderT*>(this);
+  }
+
   FluentBuilderT& set_update(void (*u)(DataT& data, BaseLearnerT& base, ExampleT&))
   {
     this->_learner->learn_fd.update_f = (details::learn_data::fn)u;
@@ -731,6 +791,7 @@ struct reduction_learner_builder
     this->_learner->finisher_fd.base = make_base(*base);
     this->_learner->finisher_fd.func = static_cast<details::func_data::fn>(details::noop);
     this->_learner->learn_fd.multipredict_f = nullptr;
+    this->_learner->learn_fd.predict_batch_f = nullptr;
     // Don't propagate merge functions
     this->_learner->_merge_fn = nullptr;
     this->_learner->_merge_with_all_fn = nullptr;
@@ -816,6 +877,8 @@ struct reduction_no_data_learner_builder
     this->_learner->finisher_fd.data = this->_learner->learner_data.get();
     this->_learner->finisher_fd.base = make_base(*base);
     this->_learner->finisher_fd.func = static_cast<details::func_data::fn>(details::noop);
+    // A batch prediction of the base would skip this reduction.
+    this->_learner->learn_fd.predict_batch_f = nullptr;
     // Don't propagate merge functions
     this->_learner->_merge_fn = nullptr;
     this->_learner->_merge_with_all_fn = nullptr;
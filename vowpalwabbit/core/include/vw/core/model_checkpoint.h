@@ -0,0 +1,118 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/vw_fwd.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+/// Saves model checkpoints for --async_checkpoint, --checkpoint_every_examples and --checkpoint_every_seconds.
+///
+/// With asynchronous writes the model is serialized into memory on the calling thread, which gives a consistent
+/// snapshot while only pausing learning for the copy, and the snapshot is written to disk by a background thread. The
+/// file is written next to its destination and renamed into place, so readers never see a partial model.
+///
+/// With --checkpoint_deltas periodic checkpoints form a chain instead of overwriting the final regressor: <f>.0 holds
+/// the full model and <f>.n for n > 0 only the weight blocks which changed since <f>.n-1 was saved.
+class model_checkpointer
+{
+public:
+  /// \param filename File periodic checkpoints are saved to.
+  /// \param every_examples Save a checkpoint after this many learned examples, 0 to disable.
+  /// \param every_seconds Save a checkpoint when this many seconds passed since the last one, 0 to disable.
+  /// \param async_writes Write binary models on a background thread.
+  model_checkpointer(std::string filename, uint64_t every_examples, float every_seconds, bool async_writes);
+  /// Waits for the queued writes to finish.
+  ~model_checkpointer();
+
+  model_checkpointer(const model_checkpointer&) = delete;
+  model_checkpointer& operator=(const model_checkpointer&) = delete;
+
+  bool async_writes() const { return _async_writes; }
+
+  /// Saves periodic checkpoints as a base model followed by delta snapshots. The workspace must track dirty weight
+  /// blocks of 2^block_bits rows, see dense_parameters::enable_dirty_tracking().
+  void enable_deltas(uint32_t block_bits)
+  {
+    _deltas = true;
+    _delta_block_bits = block_bits;
+  }
+  bool deltas() const { return _deltas; }
+  uint32_t delta_block_bits() const { return _delta_block_bits; }
+
+  /// Called by the driver after each example or multi_ex is learned from. Saves a checkpoint when one is due.
+  void on_learn(VW::workspace& all)
+  {
+    if (checkpoint_due()) { save_checkpoint(all); }
+  }
+
+  /// The two halves of on_learn(), for drivers which can not save right away because other threads are learning.
+  /// Counts a learned example and returns whether a checkpoint is due.
+  bool checkpoint_due();
+  /// Saves the periodic checkpoint which checkpoint_due() reported.
+  void save_checkpoint(VW::workspace& all);
+
+  /// Saves a checkpoint of the model, or a delta snapshot of it, to filename. Goes through save_async() when writes are
+  /// asynchronous. Explicit saves such as VW::save_predictor() and save commands do not use this and always finish
+  /// writing before they return.
+  void save(VW::workspace& all, const std::string& filename, bool delta);
+
+  /// Serializes the model and queues it to be written to filename. A write of the same file which has not started yet
+  /// is replaced by this one, so at most two snapshots of a file are held in memory.
+  void save_async(VW::workspace& all, const std::string& filename, bool delta = false);
+
+  /// Blocks until every queued write is finished. Rethrows the first error raised while writing.
+  void wait();
+
+  uint64_t checkpoints_written() const;
+
+private:
+  struct pending_write
+  {
+    std::string filename;
+    std::shared_ptr<std::vector<char>> model;
+  };
+
+  void writer_loop();
+
+  const std::string _filename;
+  const uint64_t _every_examples;
+  const std::chrono::duration<float> _every_seconds;
+  const bool _async_writes;
+  bool _deltas = false;
+  uint32_t _delta_block_bits = 0;
+  uint64_t _snapshots_saved = 0;
+
+  uint64_t _examples_since_checkpoint = 0;
+  std::chrono::steady_clock::time_point _last_checkpoint;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _work_available;
+  std::condition_variable _idle;
+  std::deque<pending_write> _queue;
+  bool _writing = false;
+  bool _stopping = false;
+  uint64_t _checkpoints_written = 0;
+  std::exception_ptr _error;
+  std::thread _writer;
+};
+
+/// Writes model to a temporary file next to filename and renames it into place.
+void write_model_file(const std::string& filename, const std::vector<char>& model);
+}  // namespace details
+}  // namespace VW
@@ -4,10 +4,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stack>
+#include <vector>
 
 // Mutex and CV cannot be used in managed C++, tell the compiler that this is unmanaged even if included in a managed
 // project.
@@ -192,4 +196,163 @@ private:
   mutable std::mutex m_lock;
   no_lock_object_pool<T, TInitializer, TCleanup> inner_pool;
 };
+
+struct object_pool_stats
+{
+  uint64_t get_count = 0;
+  // Gets served from the calling thread's cache without taking the lock.
+  uint64_t cache_hits = 0;
+  // Gets which had to refill the calling thread's cache from the shared free list.
+  uint64_t cache_misses = 0;
+  // Number of times the shared free list was empty and a new chunk had to be allocated, not counting the initial one.
+  uint64_t chunk_allocations = 0;
+  uint64_t return_count = 0;
+  // Number of batches moved from a thread's cache back to the shared free list.
+  uint64_t batch_returns = 0;
+};
+
+namespace details
+{
+struct object_pool_thread_cache;
+struct object_pool_thread_caches;
+
+/// Type erased part of thread_cached_object_pool. The per thread caches live in object_pool.cc.
+class thread_cached_object_pool_base
+{
+public:
+  thread_cached_object_pool_base(const thread_cached_object_pool_base&) = delete;
+  thread_cached_object_pool_base& operator=(const thread_cached_object_pool_base&) = delete;
+
+  /// Includes the counters of all threads which currently have a cache for this pool.
+  object_pool_stats stats() const;
+
+protected:
+  explicit thread_cached_object_pool_base(size_t batch_size);
+  virtual ~thread_cached_object_pool_base() = default;
+
+  void* get_object();
+  void return_object(void* obj);
+  bool empty() const;
+
+  // Detaches the caches of all threads and returns the number of free objects. Must be called at the start of the
+  // derived destructor.
+  size_t release_thread_caches();
+
+  // Called with the lock held when the shared free list is empty. Must add at least one object.
+  virtual void new_chunk() = 0;
+  // Only to be called from the derived constructor or new_chunk.
+  void add_free_object(void* obj) { _free.push_back(obj); }
+
+private:
+  friend struct object_pool_thread_caches;
+
+  object_pool_thread_cache& local_cache();
+  object_pool_thread_cache* find_local_cache() const;
+  void refill(object_pool_thread_cache& cache);
+  void flush(object_pool_thread_cache& cache);
+  // Called when a thread which has a cache for this pool exits.
+  void detach(object_pool_thread_cache& cache);
+
+  size_t _batch_size;
+  mutable std::mutex _mutex;
+  std::vector<void*> _free;
+  std::vector<object_pool_thread_cache*> _caches;
+  // Counters of threads which have exited and of operations on the shared free list.
+  object_pool_stats _stats;
+};
+}  // namespace details
+
+/// Object pool for objects which are taken on one thread and returned on another, such as examples which are created
+/// by the parser and returned once learning is done. Every thread keeps a small cache of free objects and only takes
+/// the shared lock to move a batch between its cache and the shared free list. Objects cached by a thread are given
+/// back to the shared free list when it exits.
+/// A thread only flushes its cache once it holds 2 * batch_size objects, so up to 2 * batch_size - 1 free objects per
+/// thread which returns objects can be out of reach of the other threads. A thread which finds the shared free list
+/// empty allocates a new chunk instead of waiting for them, so the pool can hold that many more objects than are ever
+/// in use at once.
+/// The pool must not be used by any thread while it is being destroyed.
+template <typename T, typename TInitializer = default_initializer<T>, typename TCleanup = default_cleanup<T>>
+class thread_cached_object_pool : public details::thread_cached_object_pool_base
+{
+public:
+  static constexpr size_t DEFAULT_BATCH_SIZE = 16;
+
+  thread_cached_object_pool(size_t initial_chunk_size = 0, TInitializer initializer = {}, size_t chunk_size = 8,
+      size_t batch_size = DEFAULT_BATCH_SIZE)
+      : details::thread_cached_object_pool_base(batch_size)
+      , _initializer(initializer)
+      , _chunk_size(chunk_size == 0 ? 1 : chunk_size)
+  {
+    allocate(initial_chunk_size);
+  }
+
+  ~thread_cached_object_pool() override
+  {
+    const auto free_count = release_thread_caches();
+    assert(free_count == size());
+    static_cast<void>(free_count);
+    for (auto& c : _chunks)
+    {
+      for (size_t i = 0; i < c->size; i++) { _cleanup(&c->objects[i]); }
+    }
+  }
+
+  T* get_object() { return static_cast<T*>(details::thread_cached_object_pool_base::get_object()); }
+
+  void return_object(T* obj)
+  {
+    assert(is_from_pool(obj));
+    details::thread_cached_object_pool_base::return_object(obj);
+  }
+
+  /// True if neither the shared free list nor the calling thread's cache has an object left.
+  bool empty() const { return details::thread_cached_object_pool_base::empty(); }
+
+  size_t size() const { return _size.load(std::memory_order_acquire); }
+
+  /// Does not take any lock. Chunks are never freed while the pool is alive, so an object which was handed out by the
+  /// pool is always found. Walks all chunks, so it is meant for debug checks rather than for every object.
+  bool is_from_pool(const T* obj) const
+  {
+    for (auto* c = _chunks_head.load(std::memory_order_acquire); c != nullptr; c = c->next)
+    {
+      if (obj >= &c->objects[0] && obj <= &c->objects[c->size - 1]) { return true; }
+    }
+    return false;
+  }
+
+private:
+  struct chunk
+  {
+    std::unique_ptr<T[]> objects;
+    size_t size = 0;
+    chunk* next = nullptr;
+  };
+
+  void new_chunk() override { allocate(_chunk_size); }
+
+  void allocate(size_t size)
+  {
+    if (size == 0) { return; }
+
+    std::unique_ptr<chunk> c(new chunk);
+    c->objects.reset(new T[size]);
+    c->size = size;
+    for (size_t i = 0; i < size; i++) { add_free_object(_initializer(&c->objects[i])); }
+
+    c->next = _chunks_head.load(std::memory_order_relaxed);
+    _chunks_head.store(c.get(), std::memory_order_release);
+    _size.store(_size.load(std::memory_order_relaxed) + size, std::memory_order_release);
+    _chunks.push_back(std::move(c));
+  }
+
+  TInitializer _initializer;
+  TCleanup _cleanup;
+  size_t _chunk_size;
+
+  // Owns the chunks, the linked list starting at _chunks_head is what is_from_pool walks.
+  std::vector<std::unique_ptr<chunk>> _chunks;
+  std::atomic<chunk*> _chunks_head{nullptr};
+  std::atomic<size_t> _size{0};
+};
 }  // namespace VW
@@ -0,0 +1,126 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/common/string_view.h"
+#include "vw/core/feature_hash_cache.h"
+#include "vw/core/label_parser.h"
+#include "vw/core/vw_fwd.h"
+
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Mutex and CV cannot be used in managed C++, tell the compiler that this is unmanaged even if included in a managed
+// project.
+#ifdef _M_CEE
+#  pragma managed(push, off)
+#  undef _M_CEE
+#  include <condition_variable>
+#  include <mutex>
+#  define _M_CEE 001
+#  pragma managed(pop)
+#else
+#  include <condition_variable>
+#  include <mutex>
+#endif
+
+namespace VW
+{
+namespace details
+{
+/// Per thread scratch space for the line parsers, these are the parts of the parser struct that are written to while
+/// parsing an example.
+struct line_parse_scratch
+{
+  std::vector<VW::string_view> words;
+  VW::label_parser_reuse_mem reuse_mem;
+  std::unique_ptr<feature_hash_cache> hash_cache;
+};
+
+/// Parses a single null terminated line into examples. examples contains a single unused example when this is called.
+/// Returns false if the line did not produce any examples and should be skipped.
+using line_parser_func = bool (*)(VW::workspace&, line_parse_scratch&, char* line, size_t num_chars, VW::multi_ex&);
+
+/// Parses line based input on several threads. A reader thread copies chunks of lines out of the input io_buf, worker
+/// threads turn them into examples and next() hands the examples back in input order. Everything that depends on the
+/// order of examples, such as setup_example, holdout counting and cache writing, is left to the caller of next().
+class parallel_parse_pipeline
+{
+public:
+  parallel_parse_pipeline(VW::workspace& all, size_t num_threads, line_parser_func line_parser);
+  ~parallel_parse_pipeline();
+
+  parallel_parse_pipeline(const parallel_parse_pipeline&) = delete;
+  parallel_parse_pipeline& operator=(const parallel_parse_pipeline&) = delete;
+
+  /// Same contract as parser::reader. Starts the threads on first use and returns 0 once the input is exhausted.
+  /// Exceptions thrown while parsing a line are rethrown here, after all lines which precede it have been returned.
+  int next(io_buf& input, VW::multi_ex& examples);
+
+  /// Joins all threads and returns examples that were parsed ahead to the pool. The input io_buf may be used by the
+  /// caller again once this returns. A later call to next() starts reading from the current position of the input.
+  void stop();
+
+  size_t num_threads() const { return _num_threads; }
+
+private:
+  struct chunk
+  {
+    std::vector<char> text;
+    // Offset and length into text for each line.
+    std::vector<std::pair<size_t, size_t>> lines;
+    std::vector<VW::multi_ex> results;
+    std::exception_ptr error;
+    size_t error_line = 0;
+    // Number of the example of the first line, counted as if parsing on one thread.
+    size_t first_example_number = 0;
+    bool end_of_input = false;
+    bool parsed = false;
+
+    void clear();
+  };
+
+  void reader_loop(io_buf& input);
+  // Waits until a whole line can be read from stdin without blocking. Returns false if stop() was called meanwhile.
+  bool wait_for_line(io_buf& input);
+  void worker_loop();
+  void parse_chunk(chunk& c, line_parse_scratch& scratch);
+  void recycle_front_chunk();
+
+  VW::workspace& _all;
+  size_t _num_threads;
+  line_parser_func _line_parser;
+  size_t _lines_per_chunk;
+  size_t _max_chunks_in_flight;
+
+  std::mutex _mutex;
+  std::condition_variable _space_available;
+  std::condition_variable _work_available;
+  std::condition_variable _chunk_parsed;
+
+  // Chunks in input order, owned here. Workers only hold pointers to chunks which are also in _in_flight.
+  std::deque<std::unique_ptr<chunk>> _in_flight;
+  std::deque<chunk*> _work;
+  std::vector<std::unique_ptr<chunk>> _free_chunks;
+  size_t _next_line = 0;
+  // Only used by the reader while it runs.
+  size_t _next_example_number = 0;
+  bool _stopping = false;
+  bool _running = false;
+
+  std::thread _reader;
+  std::vector<std::thread> _workers;
+};
+
+/// Switches the parser to multi-threaded parsing if the currently selected reader supports it. Returns false and leaves
+/// the reader alone otherwise.
+bool enable_parallel_parsing(VW::workspace& all, size_t num_threads);
+int read_features_parallel(VW::workspace* all, io_buf& buf, VW::multi_ex& examples);
+}  // namespace details
+}  // namespace VW
@@ -20,6 +20,7 @@ struct input_options
   uint32_t port;
   std::string pid_file;
   std::string port_file;
+  std::string daemon_server;
 
   bool cache;
   std::vector<std::string> cache_files;
@@ -29,6 +30,10 @@ struct input_options
   bool compressed;
   bool chain_hash_json;
   bool flatbuffer = false;
+  uint32_t parse_threads = 1;
+  bool mmap_cache = false;
+  std::string cache_format;
+  std::string json_parser;
 #ifdef VW_BUILD_CSV
   std::unique_ptr<VW::parsers::csv_parser_options> csv_opts;
 #endif
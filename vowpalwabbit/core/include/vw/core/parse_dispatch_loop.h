@@ -8,6 +8,7 @@
 #include "vw/core/global_data.h"
 #include "vw/core/parse_example.h"
 #include "vw/core/parser.h"
+#include "vw/core/reduction_profiler.h"
 #include "vw/core/v_array.h"
 #include "vw/io/logger.h"
 
@@ -19,16 +20,27 @@ void parse_dispatch(VW::workspace& all, DispatchFuncT& dispatch)
 {
   VW::multi_ex examples;
   size_t example_number = 0;  // for variable-size batch learning algorithms
+  const VW::details::profile_frame* parse_frame =
+      all.profiler != nullptr ? all.profiler->get_frame("parser") : nullptr;
 
   try
   {
     while (!all.example_parser->done)
     {
       examples.push_back(&VW::get_unused_example(&all));  // need at least 1 example
-      if (!all.do_reset_source && example_number != all.pass_length && all.max_examples > example_number &&
-          all.example_parser->reader(&all, all.example_parser->input, examples) > 0)
+      int num_read = 0;
+      if (!all.do_reset_source && example_number != all.pass_length && all.max_examples > example_number)
+      {
+        VW::details::profile_scope profile(all.profiler.get(), parse_frame, 0);
+        num_read = all.example_parser->reader(&all, all.example_parser->input, examples);
+        if (num_read > 0)
+        {
+          VW::setup_examples(all, examples);
+          profile.set_examples(examples.size());
+        }
+      }
+      if (num_read > 0)
       {
-        VW::setup_examples(all, examples);
         example_number += examples.size();
         dispatch(all, examples);
       }
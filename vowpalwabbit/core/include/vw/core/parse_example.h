@@ -6,8 +6,22 @@
 #include "vw/core/vw_fwd.h"
 
 #include <cstdint>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+class feature_hash_cache;
+}
+}  // namespace VW
 
 void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example);
+// Same as above but uses the given scratch space instead of the parser's, so it can be called from several threads.
+// Names are hashed through hash_cache when it is given.
+void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example,
+    std::vector<VW::string_view>& words, VW::label_parser_reuse_mem& reuse_mem,
+    VW::details::feature_hash_cache* hash_cache = nullptr);
 
 namespace VW
 {
@@ -47,6 +47,10 @@ VW_WARNING_STATE_POP
 #include "vw/core/cb.h"
 #include "vw/core/cb_continuous_label.h"
 
+#ifdef VW_BUILD_SIMDJSON
+#  include "vw/core/parse_example_simdjson.h"
+#endif
+
 #include <algorithm>
 #include <limits>
 #include <sstream>
@@ -1064,7 +1068,7 @@ public:
   BaseState<audit>* Float(Context<audit>& ctx, float f) override
   {
     auto& ns = ctx.CurrentNamespace();
-    auto hash_index = ctx._hash_func(ctx.key, strlen(ctx.key), ns.namespace_hash) & ctx._parse_mask;
+    auto hash_index = ns.hash(ctx.key, strlen(ctx.key), ns.namespace_hash, ctx._hash_func) & ctx._parse_mask;
     ns.AddFeature(f, hash_index, ctx.key);
     return this;
   }
@@ -1522,6 +1526,7 @@ public:
   uint64_t _hash_seed;
   uint64_t _parse_mask;
   bool _chain_hash;
+  VW::details::feature_hash_cache* _hash_cache;
 
   VW::label_parser_reuse_mem* _reuse_mem;
   const VW::named_labels* _ldict;
@@ -1589,7 +1594,8 @@ public:
   }
 
   void init(const VW::label_parser& lbl_parser, hash_func_t hash_func, uint64_t hash_seed, uint64_t parse_mask,
-      bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict, VW::io::logger* logger)
+      bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict, VW::io::logger* logger,
+      VW::details::feature_hash_cache* hash_cache = nullptr)
   {
     assert(reuse_mem != nullptr);
     assert(logger != nullptr);
@@ -1598,6 +1604,7 @@ public:
     _hash_seed = hash_seed;
     _parse_mask = parse_mask;
     _chain_hash = chain_hash;
+    _hash_cache = hash_cache;
     _reuse_mem = reuse_mem;
     _ldict = ldict;
     _logger = logger;
@@ -1622,7 +1629,7 @@ public:
 
   void PushNamespace(const char* ns, BaseState<audit>* return_state)
   {
-    push_ns(ex, ns, namespace_path, _hash_func, _hash_seed);
+    push_ns(ex, ns, namespace_path, _hash_func, _hash_seed, _hash_cache);
     return_path.push_back(return_state);
   }
 
@@ -1657,9 +1664,10 @@ struct VWReaderHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>,
       VW::multi_ex* examples, rapidjson::InsituStringStream* stream, const char* stream_end,
       VW::example_factory_t example_factory, void* example_factory_context,
       std::unordered_map<std::string, std::set<std::string>>* ignore_features,
-      std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr)
+      std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr,
+      VW::details::feature_hash_cache* hash_cache = nullptr)
   {
-    ctx.init(lbl_parser, hash_func, hash_seed, parse_mask, chain_hash, reuse_mem, ldict, logger);
+    ctx.init(lbl_parser, hash_func, hash_seed, parse_mask, chain_hash, reuse_mem, ldict, logger, hash_cache);
     ctx.examples = examples;
     ctx.ex = (*examples)[0];
     lbl_parser.default_label(ctx.ex->l);
@@ -1718,7 +1726,8 @@ void read_line_json_s(const VW::label_parser& lbl_parser, hash_func_t hash_func,
     uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict,
     VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory, void* ex_factory_context,
     VW::io::logger& logger, std::unordered_map<std::string, std::set<std::string>>* ignore_features,
-    std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr)
+    std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr,
+    VW::details::feature_hash_cache* hash_cache = nullptr)
 {
   if (lbl_parser.label_type == VW::label_type_t::slates)
   {
@@ -1735,7 +1744,7 @@ void read_line_json_s(const VW::label_parser& lbl_parser, hash_func_t hash_func,
   VWReaderHandler<audit>& handler = parser.handler;
 
   handler.init(lbl_parser, hash_func, hash_seed, parse_mask, chain_hash, reuse_mem, ldict, &logger, &examples, &ss,
-      line + length, example_factory, ex_factory_context, ignore_features, dedup_examples);
+      line + length, example_factory, ex_factory_context, ignore_features, dedup_examples, hash_cache);
 
   ParseResult result =
       parser.reader.template Parse<kParseInsituFlag, InsituStringStream, VWReaderHandler<audit>>(ss, handler);
@@ -1761,7 +1770,8 @@ void read_line_json_s(VW::workspace& all, VW::multi_ex& examples, char* line, si
 {
   return read_line_json_s<audit>(all.example_parser->lbl_parser, all.example_parser->hasher, all.hash_seed,
       all.parse_mask, all.chain_hash_json, &all.example_parser->parser_memory_to_reuse, all.sd->ldict.get(), examples,
-      line, length, example_factory, ex_factory_context, all.logger, &all.ignore_features_dsjson, dedup_examples);
+      line, length, example_factory, ex_factory_context, all.logger, &all.ignore_features_dsjson, dedup_examples,
+      all.example_parser->hash_cache.get());
 }
 
 inline bool apply_pdrop(label_type_t label_type, float pdrop, VW::multi_ex& examples, VW::io::logger& logger)
@@ -1812,7 +1822,8 @@ bool read_line_decision_service_json(VW::workspace& all, VW::multi_ex& examples,
   VWReaderHandler<audit>& handler = parser.handler;
   handler.init(all.example_parser->lbl_parser, all.example_parser->hasher, all.hash_seed, all.parse_mask,
       all.chain_hash_json, &all.example_parser->parser_memory_to_reuse, all.sd->ldict.get(), &all.logger, &examples,
-      &ss, line + length, example_factory, ex_factory_context, &all.ignore_features_dsjson);
+      &ss, line + length, example_factory, ex_factory_context, &all.ignore_features_dsjson, nullptr,
+      all.example_parser->hash_cache.get());
 
   handler.ctx.SetStartStateToDecisionService(data);
   handler.ctx.decision_service_data = data;
@@ -1847,6 +1858,25 @@ bool read_line_decision_service_json(VW::workspace& all, VW::multi_ex& examples,
 }  // namespace VW
 }  // namespace VW
 
+// Parses the line with --json_parser simdjson when it is used. Returns false if the line must be parsed by rapidjson.
+template <bool audit>
+bool parse_line_json_simdjson(
+    VW::workspace* all, char* line, size_t num_chars, VW::multi_ex& examples, DecisionServiceInteraction* data)
+{
+#ifdef VW_BUILD_SIMDJSON
+  auto* simdjson_parser = all->example_parser->simdjson_parser.get();
+  return simdjson_parser != nullptr &&
+      simdjson_parser->template parse_line<audit>(*all, examples, line, num_chars, data);
+#else
+  _UNUSED(all);
+  _UNUSED(line);
+  _UNUSED(num_chars);
+  _UNUSED(examples);
+  _UNUSED(data);
+  return false;
+#endif
+}
+
 template <bool audit>
 bool parse_line_json(VW::workspace* all, char* line, size_t num_chars, VW::multi_ex& examples)
 {
@@ -1856,8 +1886,11 @@ bool parse_line_json(VW::workspace* all, char* line, size_t num_chars, VW::multi
     if (line[0] != '{') { return false; }
 
     DecisionServiceInteraction interaction;
-    bool result = VW::template read_line_decision_service_json<audit>(*all, examples, line, num_chars, false,
-        reinterpret_cast<VW::example_factory_t>(&VW::get_unused_example), all, &interaction);
+    bool result = parse_line_json_simdjson<audit>(all, line, num_chars, examples, &interaction)
+        ? VW::apply_pdrop(all->example_parser->lbl_parser.label_type, interaction.probabilityOfDrop, examples,
+              all->logger)
+        : VW::template read_line_decision_service_json<audit>(*all, examples, line, num_chars, false,
+              reinterpret_cast<VW::example_factory_t>(&VW::get_unused_example), all, &interaction);
 
     if (!result)
     {
@@ -1937,7 +1970,7 @@ bool parse_line_json(VW::workspace* all, char* line, size_t num_chars, VW::multi
       return false;
     }
   }
-  else
+  else if (!parse_line_json_simdjson<audit>(all, line, num_chars, examples, nullptr))
   {
     VW::template read_line_json_s<audit>(
         *all, examples, line, num_chars, reinterpret_cast<VW::example_factory_t>(&VW::get_unused_example), all);
@@ -0,0 +1,47 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/vw_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct DecisionServiceInteraction;
+
+namespace VW
+{
+namespace details
+{
+/// Reads --json and --dsjson lines with the simdjson On-Demand parser, selected with --json_parser simdjson. The
+/// document is walked directly and each value is handed to the same parser state the rapidjson handler would dispatch
+/// it to, so both produce the same examples, without a virtual call per token.
+///
+/// The line is only read with simdjson if it sticks to the parts of the format used by decision service logs and
+/// plain JSON examples. Lines using anything else (nested arrays, "pdf", "_slot_id", "__aid", continuous action
+/// labels, slates) or which are not valid JSON are left to the rapidjson reader, which also reports the errors.
+class simdjson_line_parser
+{
+public:
+  simdjson_line_parser();
+  ~simdjson_line_parser();
+
+  /// Parses a single line into examples, which contains a single unused example when this is called. data must be
+  /// given for decision service lines and null otherwise. \returns false if the line must be parsed with rapidjson
+  /// instead, examples and data are then back to how they were passed.
+  template <bool audit>
+  bool parse_line(VW::workspace& all, VW::multi_ex& examples, const char* line, size_t length,
+      DecisionServiceInteraction* data);
+
+  /// Number of lines which were left to rapidjson.
+  uint64_t fallback_count() const;
+
+private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+}  // namespace details
+}  // namespace VW
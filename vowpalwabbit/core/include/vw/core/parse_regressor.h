@@ -13,6 +13,9 @@ void finalize_regressor(VW::workspace& all, const std::string& reg_name);
 void initialize_regressor(VW::workspace& all);
 
 void save_predictor(VW::workspace& all, const std::string& reg_name, size_t current_pass);
+// Saves the model at the end of a pass for --save_per_pass. Unlike save_predictor it may return before the file is
+// written, see --async_checkpoint.
+void save_pass_checkpoint(VW::workspace& all, const std::string& reg_name, size_t current_pass);
 void save_load_header(VW::workspace& all, io_buf& model_file, bool read, bool text, std::string& file_options,
     VW::config::options_i& options);
 
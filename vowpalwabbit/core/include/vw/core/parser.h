@@ -23,6 +23,7 @@
 #include "vw/common/future_compat.h"
 #include "vw/common/string_view.h"
 #include "vw/core/example.h"
+#include "vw/core/feature_hash_cache.h"
 #include "vw/core/io_buf.h"
 #include "vw/core/vw_fwd.h"
 
@@ -36,6 +37,13 @@ void parse_example_label(string_view label, const VW::label_parser& lbl_parser,
 void setup_examples(VW::workspace& all, VW::multi_ex& examples);
 namespace details
 {
+class block_cache_reader;
+class block_cache_writer;
+class parallel_parse_pipeline;
+#ifdef VW_BUILD_SIMDJSON
+class simdjson_line_parser;
+#endif
+
 struct cache_temp_buffer
 {
   std::shared_ptr<std::vector<char>> _backing_buffer;
@@ -46,6 +54,23 @@ struct cache_temp_buffer
     _temporary_cache_buffer.add_file(VW::io::create_vector_writer(_backing_buffer));
   }
 };
+
+// Records the pool in every example it allocates, so VW::is_ring_example does not have to search the pool's chunks.
+struct example_pool_initializer
+{
+  example_pool_initializer() = default;
+  explicit example_pool_initializer(const void* owner) : pool(owner) {}
+
+  example* operator()(example* ex)
+  {
+    ex->owning_pool = pool;
+    return ex;
+  }
+
+  const void* pool = nullptr;
+};
+
+using example_pool = thread_cached_object_pool<example, example_pool_initializer>;
 }  // namespace details
 }  // namespace VW
 
@@ -54,7 +79,8 @@ struct dsjson_metrics;
 
 struct parser
 {
-  parser(size_t example_queue_limit, bool strict_parse_);
+  parser(size_t example_queue_limit, bool strict_parse_, VW::queue_mode example_queue_mode = VW::queue_mode::locked);
+  ~parser();
 
   // delete copy constructor
   parser(const parser&) = delete;
@@ -63,7 +89,7 @@ struct parser
   // helper(s) for text parsing
   std::vector<VW::string_view> words;
 
-  VW::object_pool<VW::example> example_pool;
+  VW::details::example_pool example_pool;
   VW::ptr_queue<VW::example> ready_parsed_examples;
 
   io_buf input;  // Input source(s)
@@ -88,6 +114,12 @@ struct parser
   std::string finalname;
 
   bool write_cache = false;
+  // Read cache files through a memory mapping instead of copying them into the input buffer.
+  bool mmap_cache = false;
+  // Write caches in the block format instead of one row per example, see --cache_format.
+  bool block_cache = false;
+  std::unique_ptr<VW::details::block_cache_writer> block_cache_writer;
+  std::unique_ptr<VW::details::block_cache_reader> block_cache_reader;
   bool sort_features = false;
 
   size_t example_queue_limit;
@@ -115,6 +147,26 @@ struct parser
   bool strict_parse;
   std::exception_ptr exc_ptr;
   std::unique_ptr<dsjson_metrics> metrics = nullptr;
+
+  // Set when --parse_threads is used, reader then pulls examples out of this pipeline in input order.
+  std::unique_ptr<VW::details::parallel_parse_pipeline> parallel_parse;
+
+  // Set by --feature_hash_cache and used by the thread calling reader. Workers of --parse_threads have their own cache
+  // of the same capacity, and add their counters to worker_hash_cache_stats when they stop.
+  std::unique_ptr<VW::details::feature_hash_cache> hash_cache;
+  VW::details::feature_hash_cache_stats worker_hash_cache_stats;
+
+#ifdef VW_BUILD_SIMDJSON
+  // Set by --json_parser simdjson, JSON lines are then read with it and only left to rapidjson when it cannot.
+  std::unique_ptr<VW::details::simdjson_line_parser> simdjson_parser;
+#endif
+
+  VW::details::feature_hash_cache_stats hash_cache_stats() const
+  {
+    auto stats = worker_hash_cache_stats;
+    if (hash_cache != nullptr) { stats += hash_cache->stats(); }
+    return stats;
+  }
 };
 
 struct dsjson_metrics
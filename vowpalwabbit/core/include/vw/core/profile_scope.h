@@ -0,0 +1,48 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace VW
+{
+class reduction_profiler;
+
+namespace details
+{
+struct profile_frame;
+
+// Out of line forms of reduction_profiler::get_frame(), enter() and exit(), for code which only sees the forward
+// declaration of the profiler.
+const profile_frame* get_profile_frame(reduction_profiler& profiler, const std::string& name);
+void enter_profile_frame(reduction_profiler& profiler, const profile_frame* frame);
+void exit_profile_frame(reduction_profiler& profiler, size_t examples);
+
+/// Records the enclosing scope as a call of frame, does nothing if profiler is null.
+class profile_scope
+{
+public:
+  profile_scope(reduction_profiler* profiler, const profile_frame* frame, size_t examples = 1)
+      : _profiler(profiler), _examples(examples)
+  {
+    if (_profiler != nullptr) { enter_profile_frame(*_profiler, frame); }
+  }
+  ~profile_scope()
+  {
+    if (_profiler != nullptr) { exit_profile_frame(*_profiler, _examples); }
+  }
+
+  profile_scope(const profile_scope&) = delete;
+  profile_scope& operator=(const profile_scope&) = delete;
+
+  void set_examples(size_t examples) { _examples = examples; }
+
+private:
+  reduction_profiler* _profiler;
+  size_t _examples;
+};
+}  // namespace details
+}  // namespace VW
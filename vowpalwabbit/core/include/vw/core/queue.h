@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include "vw/core/memory.h"
+
+#include <atomic>
+#include <cstdint>
 #include <queue>
+#include <vector>
 
 // Mutex and CV cannot be used in managed C++, tell the compiler that this is unmanaged even if included in a managed
 // project.
@@ -20,16 +25,220 @@
 #  include <mutex>
 #endif
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#endif
+
 namespace VW
 {
+enum class queue_mode
+{
+  // std::queue guarded by a mutex, producers and consumers are woken via condition variables on every operation.
+  locked,
+  // Bounded lock-free ring for exactly one producer and one consumer thread. Waiting sides spin and then park.
+  spsc
+};
+
+struct queue_stats
+{
+  uint64_t push_count = 0;
+  uint64_t pop_count = 0;
+  // Number of pushes that found the queue full. A high value means the consumer is the bottleneck.
+  uint64_t full_waits = 0;
+  // Number of pops that found the queue empty. A high value means the producer is the bottleneck.
+  uint64_t empty_waits = 0;
+  // Sum of the queue size observed after each push. Divide by push_count for the mean occupancy.
+  uint64_t occupancy_sum = 0;
+  uint64_t max_occupancy = 0;
+};
+
+namespace details
+{
+inline void cpu_relax()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_pause();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+}  // namespace details
+
+/// Bounded single-producer/single-consumer queue of pointers. Exactly one thread may call push and exactly one thread
+/// may call pop. A side that cannot make progress spins for spin_count iterations before it parks on a condition
+/// variable, the other side only takes the lock to wake it when it is known to be parked.
+template <typename T>
+class spsc_ptr_queue
+{
+public:
+  static constexpr size_t DEFAULT_SPIN_COUNT = 1024;
+
+  spsc_ptr_queue(size_t max_size, size_t spin_count = DEFAULT_SPIN_COUNT)
+      : _max_size(max_size), _spin_count(spin_count)
+  {
+    size_t capacity = 1;
+    while (capacity < max_size) { capacity <<= 1; }
+    _mask = capacity - 1;
+    _buffer.resize(capacity, nullptr);
+  }
+
+  T* pop()
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head == _cached_tail)
+    {
+      _cached_tail = _tail.load(std::memory_order_acquire);
+      if (head == _cached_tail)
+      {
+        _empty_waits++;
+        spin_then_park(
+            [&]() {
+              // done must be read before tail so that items pushed before set_done are always observed.
+              const bool done = _done.load(std::memory_order_seq_cst);
+              _cached_tail = _tail.load(std::memory_order_seq_cst);
+              return head != _cached_tail || done;
+            },
+            _consumer_parked, _is_not_empty);
+        if (head == _cached_tail) { return nullptr; }
+      }
+    }
+
+    auto* item = _buffer[head & _mask];
+    _head.store(head + 1, std::memory_order_seq_cst);
+    if (_producer_parked.load(std::memory_order_seq_cst)) { wake(_is_not_full); }
+    _pop_count++;
+    return item;
+  }
+
+  void push(T* item)
+  {
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _cached_head >= _max_size)
+    {
+      _cached_head = _head.load(std::memory_order_acquire);
+      if (tail - _cached_head >= _max_size)
+      {
+        _full_waits++;
+        spin_then_park(
+            [&]() {
+              _cached_head = _head.load(std::memory_order_seq_cst);
+              return tail - _cached_head < _max_size;
+            },
+            _producer_parked, _is_not_full);
+      }
+    }
+
+    _buffer[tail & _mask] = item;
+    _tail.store(tail + 1, std::memory_order_seq_cst);
+    if (_consumer_parked.load(std::memory_order_seq_cst)) { wake(_is_not_empty); }
+
+    const auto occupancy = static_cast<uint64_t>(tail + 1 - _head.load(std::memory_order_relaxed));
+    _push_count++;
+    _occupancy_sum += occupancy;
+    if (occupancy > _max_occupancy) { _max_occupancy = occupancy; }
+  }
+
+  void set_done()
+  {
+    {
+      std::unique_lock<std::mutex> lock(_mut);
+      _done.store(true, std::memory_order_seq_cst);
+    }
+    _is_not_empty.notify_all();
+    _is_not_full.notify_all();
+  }
+
+  size_t size() const
+  {
+    // head must be read first, tail can only be ahead of it.
+    const auto head = _head.load(std::memory_order_acquire);
+    const auto tail = _tail.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  /// Counters are owned by the producer and consumer threads, only read them once both have stopped.
+  queue_stats stats() const
+  {
+    queue_stats result;
+    result.push_count = _push_count;
+    result.pop_count = _pop_count;
+    result.full_waits = _full_waits;
+    result.empty_waits = _empty_waits;
+    result.occupancy_sum = _occupancy_sum;
+    result.max_occupancy = _max_occupancy;
+    return result;
+  }
+
+private:
+  template <typename PredicateT>
+  void spin_then_park(PredicateT&& ready, std::atomic<bool>& parked, std::condition_variable& cv)
+  {
+    for (size_t i = 0; i < _spin_count; i++)
+    {
+      if (ready()) { return; }
+      details::cpu_relax();
+    }
+
+    std::unique_lock<std::mutex> lock(_mut);
+    parked.store(true, std::memory_order_seq_cst);
+    while (!ready()) { cv.wait(lock); }
+    parked.store(false, std::memory_order_relaxed);
+  }
+
+  void wake(std::condition_variable& cv)
+  {
+    // Taking the lock guarantees the parked side is either inside wait or has not yet evaluated its predicate.
+    std::unique_lock<std::mutex> lock(_mut);
+    cv.notify_one();
+  }
+
+  // Shared, read-mostly state.
+  size_t _max_size;
+  size_t _mask;
+  size_t _spin_count;
+  std::vector<T*> _buffer;
+  std::atomic<bool> _done{false};
+  std::atomic<bool> _producer_parked{false};
+  std::atomic<bool> _consumer_parked{false};
+  std::mutex _mut;
+  std::condition_variable _is_not_full;
+  std::condition_variable _is_not_empty;
+
+  // Consumer owned state.
+  char _pad0[details::CACHE_LINE_SIZE];
+  std::atomic<size_t> _head{0};
+  size_t _cached_tail = 0;
+  uint64_t _pop_count = 0;
+  uint64_t _empty_waits = 0;
+
+  // Producer owned state.
+  char _pad1[details::CACHE_LINE_SIZE];
+  std::atomic<size_t> _tail{0};
+  size_t _cached_head = 0;
+  uint64_t _push_count = 0;
+  uint64_t _full_waits = 0;
+  uint64_t _occupancy_sum = 0;
+  uint64_t _max_occupancy = 0;
+  char _pad2[details::CACHE_LINE_SIZE];
+};
+
 template <typename T>
 class ptr_queue
 {
 public:
-  ptr_queue(size_t max_size) : max_size(max_size) {}
+  ptr_queue(size_t max_size, queue_mode mode = queue_mode::locked) : max_size(max_size)
+  {
+    if (mode == queue_mode::spsc) { _spsc = VW::make_unique<spsc_ptr_queue<T>>(max_size); }
+  }
 
   T* pop()
   {
+    if (_spsc != nullptr) { return _spsc->pop(); }
+
     std::unique_lock<std::mutex> lock(mut);
     while (object_queue.size() == 0 && !done) { is_not_empty.wait(lock); }
 
@@ -44,6 +253,12 @@ public:
 
   void push(T* item)
   {
+    if (_spsc != nullptr)
+    {
+      _spsc->push(item);
+      return;
+    }
+
     std::unique_lock<std::mutex> lock(mut);
     while (object_queue.size() == max_size) { is_not_full.wait(lock); }
     object_queue.push(item);
@@ -53,6 +268,12 @@ public:
 
   void set_done()
   {
+    if (_spsc != nullptr)
+    {
+      _spsc->set_done();
+      return;
+    }
+
     {
       std::unique_lock<std::mutex> lock(mut);
       done = true;
@@ -63,10 +284,17 @@ public:
 
   size_t size() const
   {
+    if (_spsc != nullptr) { return _spsc->size(); }
+
     std::unique_lock<std::mutex> lock(mut);
     return object_queue.size();
   }
 
+  queue_mode mode() const { return _spsc != nullptr ? queue_mode::spsc : queue_mode::locked; }
+
+  /// Occupancy counters are only collected in spsc mode.
+  queue_stats stats() const { return _spsc != nullptr ? _spsc->stats() : queue_stats{}; }
+
 private:
   size_t max_size;
   std::queue<T*> object_queue;
@@ -76,5 +304,7 @@ private:
 
   std::condition_variable is_not_full;
   std::condition_variable is_not_empty;
+
+  std::unique_ptr<spsc_ptr_queue<T>> _spsc;
 };
 }  // namespace VW
@@ -8,6 +8,7 @@
 #include "continuous_actions_reduction_features.h"
 #include "epsilon_reduction_features.h"
 #include "generated_interactions_reduction_features.h"
+#include "shared_features_reduction_features.h"
 #include "simple_label.h"
 #include "vw/common/future_compat.h"
 
@@ -41,6 +42,7 @@ private:
   simple_label_reduction_features _simple_label_reduction_features;
   VW::cb_explore_adf::greedy::reduction_features _epsilon_reduction_features;
   VW::generated_interactions::reduction_features _generated_interactions_reduction_features;
+  VW::shared_features::reduction_features _shared_features_reduction_features;
 
 public:
   template <typename T>
@@ -56,6 +58,7 @@ public:
     _simple_label_reduction_features.reset_to_default();
     _epsilon_reduction_features.reset_to_default();
     _generated_interactions_reduction_features.reset_to_default();
+    _shared_features_reduction_features.reset_to_default();
   }
 };
 
@@ -123,6 +126,19 @@ reduction_features::get<VW::generated_interactions::reduction_features>() const
 {
   return _generated_interactions_reduction_features;
 }
+
+template <>
+inline VW::shared_features::reduction_features& reduction_features::get<VW::shared_features::reduction_features>()
+{
+  return _shared_features_reduction_features;
+}
+
+template <>
+inline const VW::shared_features::reduction_features&
+reduction_features::get<VW::shared_features::reduction_features>() const
+{
+  return _shared_features_reduction_features;
+}
 }  // namespace VW
 
 using reduction_features VW_DEPRECATED("reduction_features moved into VW namespace") = VW::reduction_features;
\ No newline at end of file
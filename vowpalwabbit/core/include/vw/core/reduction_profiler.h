@@ -0,0 +1,90 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/profile_scope.h"
+#include "vw/core/vw_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace VW
+{
+struct metric_sink;
+
+namespace details
+{
+/// A named section of code whose time is recorded by the reduction_profiler, such as the learn and predict calls of
+/// one learner. Frames are compared by address.
+struct profile_frame
+{
+  std::string name;
+};
+}  // namespace details
+
+/// Records the time spent in each learner of the stack, the parser and the output of predictions (see
+/// --profile_reductions). Every thread keeps its own tree of calls so recording a call does not take a lock. Times are
+/// read from the time stamp counter where it is available and converted to nanoseconds when reporting.
+class reduction_profiler
+{
+public:
+  struct frame_stats
+  {
+    std::string name;
+    uint64_t calls = 0;
+    uint64_t examples = 0;
+    // Time from entering to leaving the frame, including nested frames.
+    uint64_t inclusive_ns = 0;
+    // Inclusive time minus the time spent in nested frames.
+    uint64_t exclusive_ns = 0;
+  };
+
+  /// \param folded_stacks_file File the folded call stacks are written to by report(). Nothing is written if empty.
+  explicit reduction_profiler(std::string folded_stacks_file);
+  ~reduction_profiler();
+
+  reduction_profiler(const reduction_profiler&) = delete;
+  reduction_profiler& operator=(const reduction_profiler&) = delete;
+
+  /// Returns the frame with the given name, creating it on first use. The frame lives as long as the profiler.
+  const details::profile_frame* get_frame(const std::string& name);
+
+  /// Starts a call of frame on the calling thread, nested in the innermost call which has not ended yet.
+  void enter(const details::profile_frame* frame);
+  /// Ends the innermost call on the calling thread, which processed the given number of examples.
+  void exit(size_t examples);
+
+  /// Totals per frame over all threads and call paths, in the order in which the frames were created.
+  std::vector<frame_stats> summarize() const;
+  /// Writes one line per call path in the "frame;frame;frame microseconds" format read by flame graph tools. The value
+  /// is the exclusive time spent in the last frame of the path.
+  void write_folded_stacks(std::ostream& output) const;
+  void persist_metrics(metric_sink& metrics) const;
+
+  /// Prints the summary to output and writes the folded stacks file, if one was requested.
+  void report(std::ostream& output) const;
+
+private:
+  struct call_node;
+  struct thread_state;
+
+  thread_state& current_thread_state();
+  double ns_per_tick() const;
+
+  const uint64_t _id;
+  const std::string _folded_stacks_file;
+  const uint64_t _start_ticks;
+  const uint64_t _start_ns;
+
+  mutable std::mutex _mutex;
+  std::vector<std::unique_ptr<details::profile_frame>> _frames;
+  std::vector<std::unique_ptr<thread_state>> _threads;
+};
+}  // namespace VW
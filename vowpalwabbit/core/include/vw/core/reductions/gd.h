@@ -5,6 +5,7 @@
 #pragma once
 
 #include "vw/core/array_parameters.h"
+#include "vw/core/array_parameters_quantized.h"
 #include "vw/core/constant.h"
 #include "vw/core/example.h"
 #include "vw/core/gd_predict.h"
@@ -15,6 +16,8 @@
 // we need it for base_learner
 #include "vw/core/vw_fwd.h"
 
+#include <mutex>
+
 namespace VW
 {
 namespace reductions
@@ -29,6 +32,17 @@ struct per_model_state
   double normalized_sum_norm_x = 0.0;
   double total_weight = 0.0;
 };
+// Difference between the predictions of a quantized copy of the weights and the float weights, see
+// --quantization_report.
+struct quantization_error
+{
+  VW::weight_quantization quantization = VW::weight_quantization::fp16;
+  std::unique_ptr<VW::quantized_parameters> weights;
+  double sum_abs_error = 0.0;
+  float max_abs_error = 0.f;
+  uint64_t predictions = 0;
+};
+
 struct gd
 {
   std::vector<per_model_state> per_model_states;
@@ -38,16 +52,20 @@ struct gd
   float neg_norm_power = 0.f;
   float neg_power_t = 0.f;
   float sparse_l2 = 0.f;
-  float update_multiplier = 0.f;
+  // Set with --learn_threads, where the threads add to per_model_states under per_model_states_mutex.
+  bool concurrent_learn = false;
+  std::mutex per_model_states_mutex;
   void (*predict)(gd&, VW::LEARNER::base_learner&, VW::example&) = nullptr;
   void (*learn)(gd&, VW::LEARNER::base_learner&, VW::example&) = nullptr;
   void (*update)(gd&, VW::LEARNER::base_learner&, VW::example&) = nullptr;
   float (*sensitivity)(gd&, VW::LEARNER::base_learner&, VW::example&) = nullptr;
   void (*multipredict)(
       gd&, VW::LEARNER::base_learner&, VW::example&, size_t, size_t, VW::polyprediction*, bool) = nullptr;
+  void (*predict_batch)(gd&, VW::LEARNER::base_learner&, VW::example**, size_t) = nullptr;
   bool adaptive_input = false;
   bool normalized_input = false;
   bool adax = false;
+  std::vector<quantization_error> quantization_errors;
   VW::workspace* all = nullptr;  // parallel, features, parameters
 };
 
@@ -104,10 +122,10 @@ inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat)
   return all.weights.sparse
       ? foreach_feature<DataT, WeightOrIndexT, FuncT, sparse_parameters>(all.weights.sparse_weights,
             all.ignore_some_linear, all.ignore_linear, *ec.interactions, *ec.extent_interactions, all.permutations, ec,
-            dat, all._generate_interactions_object_cache)
+            dat, all.interactions_cache())
       : foreach_feature<DataT, WeightOrIndexT, FuncT, dense_parameters>(all.weights.dense_weights,
             all.ignore_some_linear, all.ignore_linear, *ec.interactions, *ec.extent_interactions, all.permutations, ec,
-            dat, all._generate_interactions_object_cache);
+            dat, all.interactions_cache());
 }
 
 // iterate through one namespace (or its part), callback function FuncT(some_data_R, feature_value_x, feature_weight)
@@ -117,10 +135,10 @@ inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat, siz
   return all.weights.sparse
       ? foreach_feature<DataT, WeightOrIndexT, FuncT, sparse_parameters>(all.weights.sparse_weights,
             all.ignore_some_linear, all.ignore_linear, *ec.interactions, *ec.extent_interactions, all.permutations, ec,
-            dat, num_interacted_features, all._generate_interactions_object_cache)
+            dat, num_interacted_features, all.interactions_cache())
       : foreach_feature<DataT, WeightOrIndexT, FuncT, dense_parameters>(all.weights.dense_weights,
             all.ignore_some_linear, all.ignore_linear, *ec.interactions, *ec.extent_interactions, all.permutations, ec,
-            dat, num_interacted_features, all._generate_interactions_object_cache);
+            dat, num_interacted_features, all.interactions_cache());
 }
 
 // iterate through all namespaces and quadratic&cubic features, callback function T(some_data_R, feature_value_x,
@@ -154,10 +172,10 @@ inline float inline_predict(VW::workspace& all, VW::example& ec)
   const auto& simple_red_features = ec._reduction_features.template get<simple_label_reduction_features>();
   return all.weights.sparse ? inline_predict<sparse_parameters>(all.weights.sparse_weights, all.ignore_some_linear,
                                   all.ignore_linear, *ec.interactions, *ec.extent_interactions, all.permutations, ec,
-                                  all._generate_interactions_object_cache, simple_red_features.initial)
+                                  all.interactions_cache(), simple_red_features.initial)
                             : inline_predict<dense_parameters>(all.weights.dense_weights, all.ignore_some_linear,
                                   all.ignore_linear, *ec.interactions, *ec.extent_interactions, all.permutations, ec,
-                                  all._generate_interactions_object_cache, simple_red_features.initial);
+                                  all.interactions_cache(), simple_red_features.initial);
 }
 
 inline float inline_predict(VW::workspace& all, VW::example& ec, size_t& num_generated_features)
@@ -166,10 +184,10 @@ inline float inline_predict(VW::workspace& all, VW::example& ec, size_t& num_gen
   return all.weights.sparse
       ? inline_predict<sparse_parameters>(all.weights.sparse_weights, all.ignore_some_linear, all.ignore_linear,
             *ec.interactions, *ec.extent_interactions, all.permutations, ec, num_generated_features,
-            all._generate_interactions_object_cache, simple_red_features.initial)
+            all.interactions_cache(), simple_red_features.initial)
       : inline_predict<dense_parameters>(all.weights.dense_weights, all.ignore_some_linear, all.ignore_linear,
             *ec.interactions, *ec.extent_interactions, all.permutations, ec, num_generated_features,
-            all._generate_interactions_object_cache, simple_red_features.initial);
+            all.interactions_cache(), simple_red_features.initial);
 }
 
 inline float trunc_weight(const float w, const float gravity)
@@ -188,13 +206,13 @@ inline void generate_interactions(VW::workspace& all, VW::example_predict& ec, R
   {
     generate_interactions<R, S, T, audit, audit_func, sparse_parameters>(*ec.interactions, *ec.extent_interactions,
         all.permutations, ec, dat, all.weights.sparse_weights, num_interacted_features,
-        all._generate_interactions_object_cache);
+        all.interactions_cache());
   }
   else
   {
     generate_interactions<R, S, T, audit, audit_func, dense_parameters>(*ec.interactions, *ec.extent_interactions,
         all.permutations, ec, dat, all.weights.dense_weights, num_interacted_features,
-        all._generate_interactions_object_cache);
+        all.interactions_cache());
   }
 }
 
@@ -205,12 +223,12 @@ inline void generate_interactions(VW::workspace& all, VW::example_predict& ec, R
   if (all.weights.sparse)
   {
     generate_interactions<R, S, T, sparse_parameters>(all.interactions, all.extent_interactions, all.permutations, ec,
-        dat, all.weights.sparse_weights, num_interacted_features, all._generate_interactions_object_cache);
+        dat, all.weights.sparse_weights, num_interacted_features, all.interactions_cache());
   }
   else
   {
     generate_interactions<R, S, T, dense_parameters>(all.interactions, all.extent_interactions, all.permutations, ec,
-        dat, all.weights.dense_weights, num_interacted_features, all._generate_interactions_object_cache);
+        dat, all.weights.dense_weights, num_interacted_features, all.interactions_cache());
   }
 }
 
@@ -5,6 +5,7 @@
 
 #include "vw/core/vw_fwd.h"
 
+#include <atomic>
 #include <cfloat>
 #include <cstdint>
 #include <memory>
@@ -34,8 +35,10 @@ struct shared_data
   float dump_interval = 1.;  // when should I update for the user.
   double gravity = 0.0;
   double contraction = 1.;
-  float min_label = 0.f;  // minimum label encountered
-  float max_label = 0.f;  // maximum label encountered
+  // Smallest and largest label encountered. Atomic as threads learning concurrently (see --learn_threads) widen and
+  // read them without a lock.
+  std::atomic<float> min_label{0.f};
+  std::atomic<float> max_label{0.f};
 
   std::unique_ptr<VW::named_labels> ldict;
 
@@ -0,0 +1,61 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/constant.h"
+#include "vw/core/vw_fwd.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace VW
+{
+namespace shared_features
+{
+// A namespace of the shared example as seen by the actions it is factorized into.
+struct factorized_namespace
+{
+  VW::namespace_index index = 0;
+  const features* shared = nullptr;
+  // Interacted namespaces are still merged into the actions, as the interactions of every action read them from there.
+  bool merged = false;
+  // The weights of the shared features at factorized_shared_features::weights_offset.
+  std::vector<float> weights;
+};
+
+// The shared example of the multiline example being predicted on, with the weights of its linear features looked up
+// once for all of the actions.
+struct factorized_shared_features
+{
+  // In the order of the indices of the shared example, without the constant namespace.
+  std::vector<factorized_namespace> namespaces;
+  // Position of each namespace in namespaces, or -1 when the shared example does not have it.
+  std::array<int, NUM_NAMESPACES> positions;
+  bool has_weights = false;
+  uint64_t weights_offset = 0;
+};
+
+struct reduction_features
+{
+  // Set by shared_feature_merger on each action while predicting with --factorize_shared_features. gd then scores the
+  // shared features in the order they would have been merged in, so the prediction does not change.
+  factorized_shared_features* factorized = nullptr;
+  // Number of indices of the action before and after the interacted shared namespaces were merged into it.
+  size_t num_own_indices = 0;
+  size_t num_merged_indices = 0;
+
+  reduction_features() = default;
+
+  void reset_to_default()
+  {
+    factorized = nullptr;
+    num_own_indices = 0;
+    num_merged_indices = 0;
+  }
+};
+
+}  // namespace shared_features
+}  // namespace VW
@@ -0,0 +1,36 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VW
+{
+namespace details
+{
+// Stream VByte encoding of 32 bit integers, see Lemire, Kurz and Rupp, "Stream VByte: Faster Byte-Oriented Integer
+// Compression". Each integer is stored in 1 to 4 bytes. The lengths of four consecutive integers are packed into one
+// control byte, and all control bytes are stored ahead of the data bytes. Keeping the lengths apart from the data lets
+// the decoder expand four integers at a time with a single shuffle.
+
+/// Upper bound on the number of bytes stream_vbyte_encode writes for count integers.
+size_t stream_vbyte_max_encoded_size(size_t count);
+
+/// \returns the number of bytes written to out, which must hold at least stream_vbyte_max_encoded_size(count) bytes.
+size_t stream_vbyte_encode(const uint32_t* in, size_t count, uint8_t* out);
+
+/// Decodes count integers from in, using the SSSE3 decoder when the cpu supports it.
+/// \returns the number of bytes consumed from in.
+/// \throw VW::vw_exception if in_size is too small for count integers.
+size_t stream_vbyte_decode(const uint8_t* in, size_t in_size, size_t count, uint32_t* out);
+
+/// Portable decoder, stream_vbyte_decode falls back to this when SIMD is not available.
+size_t stream_vbyte_decode_scalar(const uint8_t* in, size_t in_size, size_t count, uint32_t* out);
+
+/// True if stream_vbyte_decode uses the SIMD decoder on this machine.
+bool stream_vbyte_has_simd_decoder();
+}  // namespace details
+}  // namespace VW
@@ -0,0 +1,82 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/common/string_view.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VW
+{
+namespace details
+{
+// Structural characters of the text format are the ones which end a namespace or feature name: ' ', '\t', ':', '|'
+// and '\r'. Like the first stage of simdjson, the text is classified 64 bytes at a time into a bitmap of the positions
+// of structural characters, so the parser can find the end of a token with a bit scan instead of testing every byte.
+
+constexpr size_t STRUCTURAL_BLOCK_SIZE = 64;
+
+/// Bit i of the result is set if data[i] is a structural character. Only the first size bytes are read, size must be at
+/// most STRUCTURAL_BLOCK_SIZE. Uses SSE2 when available.
+uint64_t structural_mask(const char* data, size_t size);
+
+/// Portable implementation of structural_mask.
+uint64_t structural_mask_scalar(const char* data, size_t size);
+
+/// True if structural_mask uses SIMD instructions on this machine.
+bool structural_mask_is_simd();
+
+inline size_t lowest_set_bit(uint64_t bits)
+{
+  size_t position = 0;
+#if defined(__GNUC__) || defined(__clang__)
+  position = static_cast<size_t>(__builtin_ctzll(bits));
+#else
+  while ((bits & 1) == 0)
+  {
+    bits >>= 1;
+    position++;
+  }
+#endif
+  return position;
+}
+
+/// Finds the structural characters of a line. The bitmap of the block being read is kept, so scanning forward through
+/// the line classifies each byte once.
+class structural_scanner
+{
+public:
+  explicit structural_scanner(VW::string_view text) : _text(text) {}
+
+  /// \returns the position of the first structural character at or after pos, or the size of the text if there is
+  /// none.
+  size_t next(size_t pos)
+  {
+    while (pos < _text.size())
+    {
+      const size_t block = pos - pos % STRUCTURAL_BLOCK_SIZE;
+      if (block != _block)
+      {
+        const size_t remaining = _text.size() - block;
+        _bits = structural_mask(
+            _text.data() + block, remaining < STRUCTURAL_BLOCK_SIZE ? remaining : STRUCTURAL_BLOCK_SIZE);
+        _block = block;
+      }
+      const uint64_t bits = _bits >> (pos - block);
+      if (bits != 0) { return pos + lowest_set_bit(bits); }
+      pos = block + STRUCTURAL_BLOCK_SIZE;
+    }
+    return _text.size();
+  }
+
+private:
+  VW::string_view _text;
+  // Start of the block _bits belongs to, initially none.
+  size_t _block = SIZE_MAX;
+  uint64_t _bits = 0;
+};
+}  // namespace details
+}  // namespace VW
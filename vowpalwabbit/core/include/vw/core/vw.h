@@ -180,6 +180,14 @@ void releaseFeatureSpace(primitive_feature_space* features, size_t len);
 void save_predictor(VW::workspace& all, const std::string& reg_name);
 void save_predictor(VW::workspace& all, io_buf& buf);
 
+// Delta snapshots hold the model state with only the weight blocks which changed since dirty tracking was enabled or
+// last cleared with dense_parameters::clear_dirty_blocks() (see --checkpoint_deltas). They require dense weights and
+// the gd base learner. Loading a delta applies it over the model saved by the snapshot before it.
+void save_predictor_delta(VW::workspace& all, const std::string& reg_name);
+void save_predictor_delta(VW::workspace& all, io_buf& buf);
+void load_predictor_delta(VW::workspace& all, const std::string& reg_name);
+void load_predictor_delta(VW::workspace& all, io_buf& buf);
+
 // inlines
 
 // First create the hash of a namespace.
@@ -233,7 +241,9 @@ inline float get_weight(VW::workspace& all, uint32_t index, uint32_t offset)
 
 inline void set_weight(VW::workspace& all, uint32_t index, uint32_t offset, float value)
 {
-  (&all.weights[static_cast<uint64_t>(index) << all.weights.stride_shift()])[offset] = value;
+  weight& w = (&all.weights[static_cast<uint64_t>(index) << all.weights.stride_shift()])[offset];
+  w = value;
+  if (!all.weights.sparse && all.weights.dense_weights.dirty_tracking()) { all.weights.dense_weights.mark_dirty(&w); }
 }
 
 inline uint32_t num_weights(VW::workspace& all) { return static_cast<uint32_t>(all.length()); }
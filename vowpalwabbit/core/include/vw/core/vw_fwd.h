@@ -26,6 +26,7 @@ template <class T>
 struct v_array<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type>;
 
 struct label_parser;
+struct label_parser_reuse_mem;
 struct example;
 using multi_ex = std::vector<example*>;
 using namespace_index = unsigned char;
@@ -0,0 +1,159 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/array_parameters_dense.h"
+
+#include "vw/common/vw_exception.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+#ifdef __linux__
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+// From linux/mempolicy.h, which is not always installed.
+constexpr int MPOL_INTERLEAVE_MODE = 3;
+
+// Parses the node list in /sys/devices/system/node/online, e.g. "0-1,3", into a bitmask for mbind.
+bool online_numa_nodes(std::vector<unsigned long>& mask, unsigned long& max_node)
+{
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string list;
+  if (!file || !std::getline(file, list)) { return false; }
+
+  constexpr size_t BITS = sizeof(unsigned long) * 8;
+  size_t node_count = 0;
+  size_t pos = 0;
+  while (pos < list.size())
+  {
+    char* end = nullptr;
+    const unsigned long first = std::strtoul(list.c_str() + pos, &end, 10);
+    unsigned long last = first;
+    if (*end == '-') { last = std::strtoul(end + 1, &end, 10); }
+    for (unsigned long node = first; node <= last; node++)
+    {
+      if (node / BITS >= mask.size()) { mask.resize(node / BITS + 1, 0); }
+      mask[node / BITS] |= 1UL << (node % BITS);
+      node_count++;
+    }
+    pos = end - list.c_str();
+    if (pos < list.size() && list[pos] == ',') { pos++; }
+    else
+    {
+      break;
+    }
+  }
+  max_node = mask.size() * BITS;
+  // Interleaving over a single node is a no-op.
+  return node_count > 1;
+}
+
+void* map_anonymous(size_t bytes, int extra_flags)
+{
+  void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+  return memory == MAP_FAILED ? nullptr : memory;
+}
+#endif
+}  // namespace
+
+namespace VW
+{
+huge_page_policy huge_page_policy_from_string(const std::string& policy)
+{
+  if (policy == "off") { return huge_page_policy::none; }
+  if (policy == "transparent") { return huge_page_policy::transparent; }
+  if (policy == "hugetlb") { return huge_page_policy::hugetlb; }
+  THROW("Unknown huge page policy: " << policy << ". Choose one of off, transparent or hugetlb.");
+}
+
+numa_policy numa_policy_from_string(const std::string& policy)
+{
+  if (policy == "off") { return numa_policy::none; }
+  if (policy == "interleave") { return numa_policy::interleave; }
+  if (policy == "first_touch") { return numa_policy::first_touch; }
+  THROW("Unknown NUMA policy: " << policy << ". Choose one of off, interleave or first_touch.");
+}
+
+std::string to_string(huge_page_policy policy)
+{
+  switch (policy)
+  {
+    case huge_page_policy::none:
+      return "off";
+    case huge_page_policy::transparent:
+      return "transparent";
+    case huge_page_policy::hugetlb:
+      return "hugetlb";
+  }
+  return "unknown";
+}
+
+std::string to_string(numa_policy policy)
+{
+  switch (policy)
+  {
+    case numa_policy::none:
+      return "off";
+    case numa_policy::interleave:
+      return "interleave";
+    case numa_policy::first_touch:
+      return "first_touch";
+  }
+  return "unknown";
+}
+
+namespace details
+{
+weight* map_dense_weights(size_t count, dense_allocation_options& options, size_t& mapped_bytes)
+{
+#ifdef __linux__
+  size_t bytes = count * sizeof(weight);
+  if (options.huge_pages != huge_page_policy::none) { bytes = (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1); }
+
+  void* memory = nullptr;
+  if (options.huge_pages == huge_page_policy::hugetlb)
+  {
+    memory = map_anonymous(bytes, MAP_HUGETLB);
+    if (memory == nullptr) { options.huge_pages = huge_page_policy::transparent; }
+  }
+  if (memory == nullptr)
+  {
+    memory = map_anonymous(bytes, 0);
+    if (memory == nullptr) { THROW("Failed to map " << bytes << " bytes for the weights"); }
+#  ifdef MADV_HUGEPAGE
+    if (options.huge_pages == huge_page_policy::transparent && madvise(memory, bytes, MADV_HUGEPAGE) != 0)
+    { options.huge_pages = huge_page_policy::none; }
+#  else
+    options.huge_pages = huge_page_policy::none;
+#  endif
+  }
+
+  // The policy has to be set before the pages are first touched, anonymous mappings are zero filled on demand.
+  if (options.numa == numa_policy::interleave)
+  {
+    std::vector<unsigned long> mask;
+    unsigned long max_node = 0;
+    if (!online_numa_nodes(mask, max_node) ||
+        syscall(SYS_mbind, memory, bytes, MPOL_INTERLEAVE_MODE, mask.data(), max_node, 0) != 0)
+    { options.numa = numa_policy::none; }
+  }
+
+  mapped_bytes = bytes;
+  return static_cast<weight*>(memory);
+#else
+  options = dense_allocation_options{};
+  mapped_bytes = 0;
+  return calloc_mergable_or_throw<weight>(count);
+#endif
+}
+}  // namespace details
+}  // namespace VW
@@ -0,0 +1,112 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/array_parameters_quantized.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace VW
+{
+const char* to_string(weight_quantization quantization)
+{
+  switch (quantization)
+  {
+    case weight_quantization::fp16:
+      return "fp16";
+    case weight_quantization::bf16:
+      return "bf16";
+    default:
+      return "int8";
+  }
+}
+
+// Rounds to nearest even, overflow becomes infinity.
+uint16_t float_to_half(float value)
+{
+  constexpr uint32_t FLOAT_INFINITY = 255u << 23;
+  constexpr uint32_t HALF_OVERFLOW = (127u + 16u) << 23;
+  constexpr uint32_t DENORMAL_MAGIC = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(float));
+  const uint32_t sign = bits & 0x80000000u;
+  bits ^= sign;
+
+  uint32_t half;
+  if (bits >= HALF_OVERFLOW) { half = bits > FLOAT_INFINITY ? 0x7e00u : 0x7c00u; }
+  else if (bits < (113u << 23))
+  {
+    // The result is subnormal or zero, the float addition does the rounding.
+    float magic;
+    std::memcpy(&magic, &DENORMAL_MAGIC, sizeof(float));
+    float abs_value;
+    std::memcpy(&abs_value, &bits, sizeof(float));
+    abs_value += magic;
+    std::memcpy(&bits, &abs_value, sizeof(float));
+    half = bits - DENORMAL_MAGIC;
+  }
+  else
+  {
+    const uint32_t mantissa_odd = (bits >> 13) & 1u;
+    bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + mantissa_odd;
+    half = bits >> 13;
+  }
+  return static_cast<uint16_t>(half | (sign >> 16));
+}
+
+uint16_t float_to_bfloat16(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(float));
+  // Keep nan a nan, truncation could otherwise turn it into infinity.
+  if ((bits & 0x7fffffffu) > 0x7f800000u) { return static_cast<uint16_t>((bits >> 16) | 0x40u); }
+  bits += 0x7fffu + ((bits >> 16) & 1u);
+  return static_cast<uint16_t>(bits >> 16);
+}
+
+quantized_parameters::quantized_parameters(
+    const float* weights, uint64_t mask, uint32_t row_shift, weight_quantization quantization)
+    : _mask(mask), _row_shift(row_shift), _quantization(quantization), _rows((mask >> row_shift) + 1)
+{
+  const auto rows = static_cast<size_t>(_rows);
+  if (quantization == weight_quantization::int8)
+  {
+    _int8_values.resize(rows + 3, 0);
+    _scales.resize(((rows - 1) >> INT8_BLOCK_BITS) + 1, 0.f);
+    for (size_t block = 0; block < _scales.size(); block++)
+    {
+      const size_t begin = block << INT8_BLOCK_BITS;
+      const size_t end = std::min(begin + (size_t{1} << INT8_BLOCK_BITS), rows);
+      float max_abs = 0.f;
+      for (size_t row = begin; row < end; row++) { max_abs = std::max(max_abs, std::fabs(weights[row << row_shift])); }
+      if (max_abs == 0.f || !std::isfinite(max_abs)) { continue; }
+
+      const float scale = max_abs / 127.f;
+      _scales[block] = scale;
+      for (size_t row = begin; row < end; row++)
+      {
+        const float q = std::round(weights[row << row_shift] / scale);
+        _int8_values[row] = static_cast<int8_t>(std::max(-127.f, std::min(127.f, q)));
+      }
+    }
+  }
+  else
+  {
+    _halves.resize(rows + 1, 0);
+    for (size_t row = 0; row < rows; row++)
+    {
+      const float w = weights[row << row_shift];
+      _halves[row] = quantization == weight_quantization::fp16 ? float_to_half(w) : float_to_bfloat16(w);
+    }
+  }
+}
+
+size_t quantized_parameters::memory_bytes() const
+{
+  if (_quantization == weight_quantization::int8)
+  { return static_cast<size_t>(_rows) * sizeof(int8_t) + _scales.size() * sizeof(float); }
+  return static_cast<size_t>(_rows) * sizeof(uint16_t);
+}
+}  // namespace VW
@@ -6,14 +6,19 @@
 
 #include "vw/core/global_data.h"
 #include "vw/core/io_buf.h"
+#include "vw/core/label_parser.h"
 #include "vw/core/parser.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/stream_vbyte.h"
 #include "vw/core/unique_sort.h"
+#include "vw/core/version.h"
 #include "vw/core/vw_fwd.h"
 #include "vw/io/io_adapter.h"
 #include "vw/io/logger.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 namespace
@@ -23,6 +28,13 @@ constexpr size_t NEG_ONE = 1;
 constexpr size_t GENERAL = 2;
 constexpr unsigned char NEWLINE_EXAMPLE_INDICATOR = '1';
 constexpr unsigned char NON_NEWLINE_EXAMPLE_INDICATOR = '0';
+constexpr char ROW_CACHE_MARKER = 'c';
+constexpr char BLOCK_CACHE_MARKER = 'b';
+
+// Block cache format.
+constexpr uint32_t WIDE_INDICES_FLAG = 1;
+constexpr unsigned char VALUES_ELIDED = 0;
+constexpr unsigned char VALUES_STORED = 1;
 
 // Integers are written/read 1 byte at at time (using 7 bits for the number
 // representation and the msb used to signal further bytes), with only the
@@ -69,8 +81,78 @@ __attribute__((packed))
 #endif
 ;
 
+template <typename DeltaT>
+void restore_features(
+    const DeltaT* deltas, const float* values, size_t count, features& feats, bool& sorted, uint64_t& last)
+{
+  feats.values.reserve(feats.values.size() + count);
+  feats.indices.reserve(feats.indices.size() + count);
+  for (size_t i = 0; i < count; i++)
+  {
+    const int64_t s_diff = zig_zag_decode(deltas[i]);
+    if (s_diff < 0) { sorted = false; }
+    last += s_diff;
+    feats.push_back(values == nullptr ? 1.f : values[i], last);
+  }
+}
+
 }  // namespace
 
+void VW::details::write_cache_header(io_buf& output, uint32_t num_bits, cache_format format)
+{
+  size_t v_length = static_cast<uint64_t>(VW::version.to_string().length()) + 1;
+
+  output.bin_write_fixed(reinterpret_cast<const char*>(&v_length), sizeof(v_length));
+  output.bin_write_fixed(VW::version.to_string().c_str(), v_length);
+  const char marker = format == cache_format::block ? BLOCK_CACHE_MARKER : ROW_CACHE_MARKER;
+  output.bin_write_fixed(&marker, 1);
+  output.bin_write_fixed(reinterpret_cast<const char*>(&num_bits), sizeof(num_bits));
+}
+
+uint32_t VW::details::read_cache_header(VW::io::reader& cache_reader, cache_format& format)
+{
+  size_t version_buffer_length;
+  if (static_cast<size_t>(cache_reader.read(reinterpret_cast<char*>(&version_buffer_length),
+          sizeof(version_buffer_length))) < sizeof(version_buffer_length))
+  { THROW("failed to read: version_buffer_length"); }
+
+  if (version_buffer_length > 61) THROW("cache version too long, cache file is probably invalid");
+  if (version_buffer_length == 0) THROW("cache version too short, cache file is probably invalid");
+
+  std::vector<char> version_buffer(version_buffer_length);
+  if (static_cast<size_t>(cache_reader.read(version_buffer.data(), version_buffer_length)) < version_buffer_length)
+  { THROW("failed to read: version buffer"); }
+  VW::version_struct cache_version(version_buffer.data());
+  if (cache_version != VW::version)
+  {
+    auto msg = fmt::format(
+        "Cache file version does not match current VW version. Cache files must be produced by the version consuming "
+        "them. Cache version: {} VW version: {}",
+        cache_version.to_string(), VW::version.to_string());
+    THROW(msg);
+  }
+
+  char marker;
+  if (static_cast<size_t>(cache_reader.read(&marker, sizeof(marker))) < sizeof(marker)) { THROW("failed to read"); }
+
+  if (marker == ROW_CACHE_MARKER) { format = cache_format::row; }
+  else if (marker == BLOCK_CACHE_MARKER)
+  {
+    format = cache_format::block;
+  }
+  else
+  {
+    THROW("data file is not a cache file");
+  }
+
+  uint32_t cache_numbits;
+  if (static_cast<size_t>(cache_reader.read(reinterpret_cast<char*>(&cache_numbits), sizeof(cache_numbits))) <
+      sizeof(cache_numbits))
+  { THROW("failed to read"); }
+
+  return cache_numbits;
+}
+
 size_t VW::details::read_cached_tag(io_buf& cache, VW::v_array<char>& tag)
 {
   char* read_head = nullptr;
@@ -234,3 +316,190 @@ int VW::read_example_from_cache(VW::workspace* all, io_buf& input, VW::multi_ex&
 
   return static_cast<int>(total);
 }
+
+VW::details::block_cache_writer::block_cache_writer(uint32_t examples_per_block)
+    : _examples_per_block(std::max<uint32_t>(examples_per_block, 1))
+{
+  _meta_backing = std::make_shared<std::vector<char>>();
+  _meta.add_file(VW::io::create_vector_writer(_meta_backing));
+}
+
+void VW::details::block_cache_writer::write(
+    io_buf& output, const VW::example& ex, VW::label_parser& lbl_parser, uint64_t parse_mask)
+{
+  lbl_parser.cache_label(ex.l, ex._reduction_features, _meta, "_label", false);
+  cache_tag(_meta, ex.tag);
+  _meta.write_value<unsigned char>(ex.is_newline ? NEWLINE_EXAMPLE_INDICATOR : NON_NEWLINE_EXAMPLE_INDICATOR);
+  assert(ex.indices.size() < 256);
+  _meta.write_value<unsigned char>(static_cast<unsigned char>(ex.indices.size()));
+  for (VW::namespace_index ns_idx : ex.indices)
+  {
+    const auto& feats = ex.feature_space[ns_idx];
+    const bool all_ones =
+        std::all_of(feats.values.begin(), feats.values.end(), [](feature_value v) { return v == 1.f; });
+    cache_index(_meta, ns_idx);
+    _meta.write_value<uint32_t>(static_cast<uint32_t>(feats.size()));
+    _meta.write_value<unsigned char>(all_ones ? VALUES_ELIDED : VALUES_STORED);
+
+    uint64_t last = 0;
+    for (auto index : feats.indices)
+    {
+      const uint64_t masked = index & parse_mask;
+      const uint64_t delta = zig_zag_encode(static_cast<int64_t>(masked - last));
+      if (delta > std::numeric_limits<uint32_t>::max()) { _wide_indices = true; }
+      _index_deltas.push_back(delta);
+      last = masked;
+    }
+    if (!all_ones) { _values.insert(_values.end(), feats.values.begin(), feats.values.end()); }
+  }
+
+  if (++_num_examples == _examples_per_block) { flush(output); }
+}
+
+void VW::details::block_cache_writer::flush(io_buf& output)
+{
+  if (_num_examples == 0) { return; }
+  _meta.flush();
+
+  const size_t num_deltas = _index_deltas.size();
+  if (_wide_indices)
+  {
+    _encoded_indices.resize(num_deltas * INTS_SIZE);
+    char* write_head = reinterpret_cast<char*>(_encoded_indices.data());
+    for (auto delta : _index_deltas) { write_head = variable_length_int_encode(write_head, delta); }
+    _encoded_indices.resize(write_head - reinterpret_cast<char*>(_encoded_indices.data()));
+  }
+  else
+  {
+    _narrow_deltas.assign(_index_deltas.begin(), _index_deltas.end());
+    _encoded_indices.resize(stream_vbyte_max_encoded_size(num_deltas));
+    _encoded_indices.resize(stream_vbyte_encode(_narrow_deltas.data(), num_deltas, _encoded_indices.data()));
+  }
+
+  output.write_value<uint32_t>(_num_examples);
+  output.write_value<uint32_t>(_wide_indices ? WIDE_INDICES_FLAG : 0);
+  output.write_value<uint64_t>(num_deltas);
+  output.write_value<uint64_t>(_meta_backing->size());
+  output.write_value<uint64_t>(_encoded_indices.size());
+  output.write_value<uint64_t>(_values.size());
+  output.bin_write_fixed(_meta_backing->data(), _meta_backing->size());
+  output.bin_write_fixed(reinterpret_cast<const char*>(_encoded_indices.data()), _encoded_indices.size());
+  output.bin_write_fixed(reinterpret_cast<const char*>(_values.data()), _values.size() * sizeof(float));
+
+  _num_examples = 0;
+  _wide_indices = false;
+  _meta_backing->clear();
+  _index_deltas.clear();
+  _values.clear();
+}
+
+int VW::details::block_cache_reader::read(VW::label_parser& lbl_parser, io_buf& input, VW::multi_ex& examples)
+{
+  if (_remaining == 0 && !load_block(input)) { return 0; }
+
+  auto* ex = examples[0];
+  size_t total = lbl_parser.read_cached_label(ex->l, ex->_reduction_features, _meta_buf);
+  if (total == 0) { THROW("Ran out of cache while reading example. File may be truncated."); }
+
+  size_t tag_size = read_cached_tag(_meta_buf, ex->tag);
+  if (tag_size == 0) { THROW("Ran out of cache while reading example. File may be truncated."); }
+  total += tag_size;
+  ex->is_newline =
+      (_meta_buf.read_value_and_accumulate_size<unsigned char>("newline_indicator", total) == NEWLINE_EXAMPLE_INDICATOR);
+
+  ex->sorted = true;
+  auto num_indices = _meta_buf.read_value_and_accumulate_size<unsigned char>("num_indices", total);
+  for (; num_indices > 0; num_indices--)
+  {
+    VW::namespace_index index = 0;
+    total += read_cached_index(_meta_buf, index);
+    const auto count = _meta_buf.read_value_and_accumulate_size<uint32_t>("feature count", total);
+    const auto values_mode = _meta_buf.read_value_and_accumulate_size<unsigned char>("values mode", total);
+
+    if (count > _num_deltas - _next_delta) { THROW("Block cache has fewer feature indices than its examples use."); }
+    const float* values = nullptr;
+    if (values_mode == VALUES_STORED)
+    {
+      if (count > _values.size() - _next_value) { THROW("Block cache has fewer values than its examples use."); }
+      values = _values.data() + _next_value;
+      _next_value += count;
+    }
+
+    ex->indices.push_back(static_cast<size_t>(index));
+    uint64_t last = 0;
+    if (_wide_indices)
+    { restore_features(_wide_deltas.data() + _next_delta, values, count, ex->feature_space[index], ex->sorted, last); }
+    else
+    {
+      restore_features(_narrow_deltas.data() + _next_delta, values, count, ex->feature_space[index], ex->sorted, last);
+    }
+    _next_delta += count;
+  }
+
+  _remaining--;
+  return static_cast<int>(total);
+}
+
+void VW::details::block_cache_reader::reset() { _remaining = 0; }
+
+bool VW::details::block_cache_reader::load_block(io_buf& input)
+{
+  char* read_head = nullptr;
+  // Running out of input exactly at a block boundary is the expected end of the cache.
+  if (input.buf_read(read_head, sizeof(uint32_t)) < sizeof(uint32_t)) { return false; }
+  uint32_t num_examples = 0;
+  memcpy(&num_examples, read_head, sizeof(num_examples));
+
+  const auto flags = input.read_value<uint32_t>("block flags");
+  const auto num_deltas = input.read_value<uint64_t>("block feature count");
+  const auto meta_size = input.read_value<uint64_t>("block meta size");
+  const auto index_size = input.read_value<uint64_t>("block index size");
+  const auto num_values = input.read_value<uint64_t>("block value count");
+  if (num_examples == 0) { THROW("Block cache contains an empty block. File may be corrupt."); }
+
+  const size_t payload_size = meta_size + index_size + num_values * sizeof(float);
+  if (input.buf_read(read_head, payload_size) < payload_size)
+  { THROW("Ran out of cache while reading example. File may be truncated."); }
+
+  _meta.assign(read_head, read_head + meta_size);
+  _meta_buf.close_files();
+  _meta_buf.add_file(VW::io::create_buffer_view(_meta.data(), _meta.size()));
+  _meta_buf.reset();
+  read_head += meta_size;
+
+  _wide_indices = (flags & WIDE_INDICES_FLAG) != 0;
+  const auto* encoded = reinterpret_cast<const uint8_t*>(read_head);
+  if (_wide_indices)
+  {
+    _wide_deltas.resize(num_deltas);
+    char* varint_head = read_head;
+    for (auto& delta : _wide_deltas)
+    {
+      delta = 0;
+      varint_head = variable_length_int_decode(varint_head, delta);
+    }
+    if (varint_head != read_head + index_size) { THROW("Block cache index stream is corrupt."); }
+  }
+  else
+  {
+    _narrow_deltas.resize(num_deltas);
+    if (stream_vbyte_decode(encoded, index_size, num_deltas, _narrow_deltas.data()) != index_size)
+    { THROW("Block cache index stream is corrupt."); }
+  }
+  read_head += index_size;
+
+  _values.resize(num_values);
+  if (num_values > 0) { memcpy(_values.data(), read_head, num_values * sizeof(float)); }
+
+  _num_deltas = num_deltas;
+  _next_delta = 0;
+  _next_value = 0;
+  _remaining = num_examples;
+  return true;
+}
+
+int VW::read_example_from_block_cache(VW::workspace* all, io_buf& input, VW::multi_ex& examples)
+{
+  assert(all != nullptr);
+  return all->example_parser->block_cache_reader->read(all->example_parser->lbl_parser, input, examples);
+}
@@ -0,0 +1,407 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/daemon_server.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/global_data.h"
+#include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/parse_example.h"
+#include "vw/core/parser.h"
+#include "vw/core/scope_exit.h"
+#include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
+#include "vw/io/logger.h"
+
+#ifdef __linux__
+#  include <fcntl.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+#  include <sys/epoll.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+
+#  include <algorithm>
+#  include <cerrno>
+#  include <csignal>
+#  include <cstring>
+#  include <memory>
+#  include <unordered_map>
+#  include <vector>
+
+namespace
+{
+constexpr size_t READ_CHUNK_SIZE = 1 << 16;
+constexpr int MAX_EVENTS = 64;
+// epoll_wait wakes up at least this often to notice a stop signal which raced with the wait.
+constexpr int WAIT_TIMEOUT_MS = 500;
+
+volatile sig_atomic_t got_stop_signal = 0;
+void handle_stop_signal(int) { got_stop_signal = 1; }
+
+bool set_non_blocking(int fd)
+{
+  const int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+struct connection
+{
+  explicit connection(int fd)
+      : fd(fd), output_buffer(std::make_shared<std::vector<char>>()), output(VW::io::create_vector_writer(output_buffer))
+  {
+  }
+
+  size_t pending_output() const { return output_buffer->size() - sent; }
+
+  int fd;
+  // Received bytes which do not yet form a complete line start at consumed.
+  std::vector<char> input;
+  size_t consumed = 0;
+  // Predictions are appended to output_buffer through output and sent from sent onwards.
+  std::shared_ptr<std::vector<char>> output_buffer;
+  std::unique_ptr<VW::io::writer> output;
+  size_t sent = 0;
+  // Examples of a multiline text request which has not yet been terminated by an empty line.
+  VW::multi_ex pending;
+  bool read_closed = false;
+  uint32_t registered_events = 0;
+};
+
+class epoll_daemon
+{
+public:
+  explicit epoll_daemon(VW::workspace& all)
+      : _all(all)
+      , _listen_fd(all.example_parser->bound_sock)
+      , _is_text(all.example_parser->text_reader == &VW::read_lines)
+      , _is_multiline(all.l->is_multiline())
+  {
+  }
+
+  ~epoll_daemon()
+  {
+    while (!_connections.empty()) { close_connection(*_connections.begin()->second); }
+    if (_epoll_fd >= 0) { close(_epoll_fd); }
+  }
+
+  void run()
+  {
+    if (!set_non_blocking(_listen_fd)) { THROWERRNO("fcntl"); }
+    _epoll_fd = epoll_create1(0);
+    if (_epoll_fd < 0) { THROWERRNO("epoll_create1"); }
+
+    epoll_event listen_event;
+    std::memset(&listen_event, 0, sizeof(listen_event));
+    listen_event.events = EPOLLIN;
+    listen_event.data.fd = _listen_fd;
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _listen_fd, &listen_event) < 0) { THROWERRNO("epoll_ctl"); }
+
+    // SA_RESTART is not set so that epoll_wait is interrupted by the signal.
+    struct sigaction sa;
+    std::memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = handle_stop_signal;
+    sigaction(SIGTERM, &sa, nullptr);
+    sigaction(SIGINT, &sa, nullptr);
+
+    epoll_event events[MAX_EVENTS];
+    while (got_stop_signal == 0)
+    {
+      const int ready = epoll_wait(_epoll_fd, events, MAX_EVENTS, WAIT_TIMEOUT_MS);
+      if (ready < 0)
+      {
+        if (errno == EINTR) { continue; }
+        THROWERRNO("epoll_wait");
+      }
+
+      for (int i = 0; i < ready; i++)
+      {
+        if (events[i].data.fd == _listen_fd)
+        {
+          accept_connections();
+          continue;
+        }
+
+        // An earlier event of this batch may already have closed the connection.
+        auto it = _connections.find(events[i].data.fd);
+        if (it == _connections.end()) { continue; }
+        on_event(*it->second, events[i].events);
+      }
+    }
+  }
+
+private:
+  void accept_connections()
+  {
+    while (true)
+    {
+      const int fd = accept(_listen_fd, nullptr, nullptr);
+      if (fd < 0)
+      {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        { _all.logger.err_warn("accept: {}", VW::strerror_to_string(errno)); }
+        return;
+      }
+
+      // Disable Nagle delay algorithm due to daemon mode's interactive workload
+      int one = 1;
+      setsockopt(fd, SOL_TCP, TCP_NODELAY, reinterpret_cast<char*>(&one), sizeof(one));
+      if (!set_non_blocking(fd))
+      {
+        _all.logger.err_warn("fcntl: {}", VW::strerror_to_string(errno));
+        close(fd);
+        continue;
+      }
+
+      auto conn = VW::make_unique<connection>(fd);
+      epoll_event event;
+      std::memset(&event, 0, sizeof(event));
+      event.events = EPOLLIN;
+      event.data.fd = fd;
+      if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0)
+      {
+        _all.logger.err_warn("epoll_ctl: {}", VW::strerror_to_string(errno));
+        close(fd);
+        continue;
+      }
+      conn->registered_events = EPOLLIN;
+      _connections[fd] = std::move(conn);
+    }
+  }
+
+  void on_event(connection& conn, uint32_t events)
+  {
+    try
+    {
+      if ((events & EPOLLOUT) != 0 && !flush(conn)) { return; }
+      if ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0 && !conn.read_closed && !receive(conn)) { return; }
+      process_input(conn);
+      if (!flush(conn)) { return; }
+
+      if (conn.read_closed && conn.pending_output() == 0)
+      {
+        close_connection(conn);
+        return;
+      }
+      update_events(conn);
+    }
+    catch (const std::exception& e)
+    {
+      _all.logger.err_error("Closing daemon connection after error: {}", e.what());
+      close_connection(conn);
+    }
+  }
+
+  // Returns false if the connection was closed.
+  bool receive(connection& conn)
+  {
+    if (conn.input.size() - conn.consumed > VW::details::DAEMON_MAX_LINE_LENGTH)
+    {
+      _all.logger.err_error(
+          "Closing daemon connection which sent a line longer than {} bytes", VW::details::DAEMON_MAX_LINE_LENGTH);
+      close_connection(conn);
+      return false;
+    }
+
+    const size_t old_size = conn.input.size();
+    conn.input.resize(old_size + READ_CHUNK_SIZE);
+    const ssize_t received = read(conn.fd, conn.input.data() + old_size, READ_CHUNK_SIZE);
+    conn.input.resize(old_size + std::max<ssize_t>(received, 0));
+
+    if (received == 0) { conn.read_closed = true; }
+    else if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+      close_connection(conn);
+      return false;
+    }
+    return true;
+  }
+
+  // Handles complete lines until the connection has too many unsent predictions.
+  void process_input(connection& conn)
+  {
+    while (conn.pending_output() <= VW::details::DAEMON_MAX_PENDING_OUTPUT)
+    {
+      const auto begin = conn.input.begin() + conn.consumed;
+      auto newline = std::find(begin, conn.input.end(), '\n');
+      if (newline == conn.input.end())
+      {
+        // The last line of a closed connection does not need a terminating newline.
+        if (!conn.read_closed || begin == conn.input.end()) { break; }
+        newline = conn.input.insert(conn.input.end(), '\n');
+      }
+
+      // The readers expect null terminated lines.
+      *newline = '\0';
+      const size_t line_start = conn.consumed;
+      conn.consumed = newline - conn.input.begin() + 1;
+      process_line(conn, conn.input.data() + line_start, conn.consumed - line_start - 1);
+    }
+
+    if (conn.read_closed && conn.consumed == conn.input.size() && !conn.pending.empty()) { predict(conn); }
+
+    // Drop consumed bytes once they make up most of the buffer.
+    if (conn.consumed > 0 && conn.consumed * 2 >= conn.input.size())
+    {
+      conn.input.erase(conn.input.begin(), conn.input.begin() + conn.consumed);
+      conn.consumed = 0;
+    }
+  }
+
+  void process_line(connection& conn, const char* line, size_t length)
+  {
+    VW::multi_ex examples;
+    auto return_on_error = VW::scope_exit([&] {
+      for (auto* ex : examples) { VW::finish_example(_all, *ex); }
+    });
+
+    if (_is_text)
+    {
+      examples.push_back(&VW::get_unused_example(&_all));
+      VW::read_line(_all, examples.back(), line);
+    }
+    else
+    {
+      _all.example_parser->text_reader(&_all, line, length, examples);
+    }
+    VW::setup_examples(_all, examples);
+
+    if (!_is_multiline)
+    {
+      while (!examples.empty())
+      {
+        auto* ex = examples.front();
+        examples.erase(examples.begin());
+        auto finish_on_error = VW::scope_exit([&] { VW::finish_example(_all, *ex); });
+        _all.learn(*ex);
+        finish_on_error.cancel();
+        with_output(conn, [&] { VW::LEARNER::as_singleline(_all.l)->finish_example(_all, *ex); });
+      }
+      return;
+    }
+
+    // A JSON line holds a complete multiline request, text requests are terminated by an empty line.
+    for (auto* ex : examples)
+    {
+      if (_is_text && example_is_newline_not_header(*ex))
+      {
+        if (!conn.pending.empty()) { predict(conn); }
+        VW::finish_example(_all, *ex);
+      }
+      else
+      {
+        conn.pending.push_back(ex);
+      }
+    }
+    examples.clear();
+    if (!_is_text && !conn.pending.empty()) { predict(conn); }
+  }
+
+  void predict(connection& conn)
+  {
+    VW::multi_ex examples;
+    examples.swap(conn.pending);
+    auto finish_on_error = VW::scope_exit([&] {
+      for (auto* ex : examples) { VW::finish_example(_all, *ex); }
+    });
+    _all.learn(examples);
+    finish_on_error.cancel();
+    with_output(conn, [&] { VW::LEARNER::as_multiline(_all.l)->finish_example(_all, examples); });
+  }
+
+  bool example_is_newline_not_header(VW::example& ex)
+  {
+    return VW::example_is_newline(ex) &&
+        !VW::LEARNER::ec_is_example_header(ex, _all.example_parser->lbl_parser.label_type);
+  }
+
+  // Runs finish, which prints predictions, with the connection as an additional prediction sink.
+  template <typename FinishT>
+  void with_output(connection& conn, FinishT finish)
+  {
+    _all.final_prediction_sink.push_back(std::move(conn.output));
+    auto restore = VW::scope_exit([&] {
+      conn.output = std::move(_all.final_prediction_sink.back());
+      _all.final_prediction_sink.pop_back();
+    });
+    finish();
+  }
+
+  // Returns false if the connection was closed.
+  bool flush(connection& conn)
+  {
+    auto& buffer = *conn.output_buffer;
+    while (conn.sent < buffer.size())
+    {
+      const ssize_t sent = send(conn.fd, buffer.data() + conn.sent, buffer.size() - conn.sent, MSG_NOSIGNAL);
+      if (sent < 0)
+      {
+        if (errno == EINTR) { continue; }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) { break; }
+        close_connection(conn);
+        return false;
+      }
+      conn.sent += sent;
+    }
+
+    if (conn.sent == buffer.size())
+    {
+      buffer.clear();
+      conn.sent = 0;
+    }
+    return true;
+  }
+
+  // Reads while there is room for more predictions and waits for the socket to drain while there are unsent ones.
+  void update_events(connection& conn)
+  {
+    uint32_t events = 0;
+    if (!conn.read_closed && conn.pending_output() <= VW::details::DAEMON_MAX_PENDING_OUTPUT) { events |= EPOLLIN; }
+    if (conn.pending_output() > 0) { events |= EPOLLOUT; }
+    if (events == conn.registered_events) { return; }
+
+    epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events = events;
+    event.data.fd = conn.fd;
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, conn.fd, &event) < 0) { THROWERRNO("epoll_ctl"); }
+    conn.registered_events = events;
+  }
+
+  void close_connection(connection& conn)
+  {
+    const int fd = conn.fd;
+    for (auto* ex : conn.pending) { VW::finish_example(_all, *ex); }
+    conn.pending.clear();
+    if (_epoll_fd >= 0) { epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr); }
+    close(fd);
+    _connections.erase(fd);
+  }
+
+  VW::workspace& _all;
+  int _listen_fd;
+  int _epoll_fd = -1;
+  bool _is_text;
+  bool _is_multiline;
+  std::unordered_map<int, std::unique_ptr<connection>> _connections;
+};
+}  // namespace
+
+bool VW::details::epoll_daemon_supported() { return true; }
+
+void VW::details::run_epoll_daemon(VW::workspace& all)
+{
+  got_stop_signal = 0;
+  epoll_daemon daemon(all);
+  daemon.run();
+}
+
+#else
+
+bool VW::details::epoll_daemon_supported() { return false; }
+
+void VW::details::run_epoll_daemon(VW::workspace&) { THROW("--daemon_server epoll is only supported on Linux"); }
+
+#endif
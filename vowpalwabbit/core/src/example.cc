@@ -35,6 +35,63 @@ VW::example::~example()
   }
 }
 
+VW::example::example(example&& other) noexcept
+    : example_predict(std::move(other))
+    , l(std::move(other.l))
+    , pred(std::move(other.pred))
+    , weight(other.weight)
+    , tag(std::move(other.tag))
+    , example_counter(other.example_counter)
+    , num_features(other.num_features)
+    , num_features_from_interactions(other.num_features_from_interactions)
+    , partial_prediction(other.partial_prediction)
+    , updated_prediction(other.updated_prediction)
+    , loss(other.loss)
+    , total_sum_feat_sq(other.total_sum_feat_sq)
+    , confidence(other.confidence)
+    , passthrough(other.passthrough)
+    , test_only(other.test_only)
+    , end_pass(other.end_pass)
+    , sorted(other.sorted)
+    , is_newline(other.is_newline)
+    , owning_pool(nullptr)
+    , total_sum_feat_sq_calculated(other.total_sum_feat_sq_calculated)
+    , use_permutations(other.use_permutations)
+{
+  other.passthrough = nullptr;
+  other.owning_pool = nullptr;
+}
+
+VW::example& VW::example::operator=(example&& other) noexcept
+{
+  if (this == &other) { return *this; }
+  example_predict::operator=(std::move(other));
+  l = std::move(other.l);
+  pred = std::move(other.pred);
+  weight = other.weight;
+  tag = std::move(other.tag);
+  example_counter = other.example_counter;
+  num_features = other.num_features;
+  num_features_from_interactions = other.num_features_from_interactions;
+  partial_prediction = other.partial_prediction;
+  updated_prediction = other.updated_prediction;
+  loss = other.loss;
+  total_sum_feat_sq = other.total_sum_feat_sq;
+  confidence = other.confidence;
+  delete passthrough;
+  passthrough = other.passthrough;
+  other.passthrough = nullptr;
+  test_only = other.test_only;
+  end_pass = other.end_pass;
+  sorted = other.sorted;
+  is_newline = other.is_newline;
+  // The target keeps owning_pool, it is still the object its pool allocated.
+  other.owning_pool = nullptr;
+  total_sum_feat_sq_calculated = other.total_sum_feat_sq_calculated;
+  use_permutations = other.use_permutations;
+  return *this;
+}
+
 float VW::example::get_total_sum_feat_sq()
 {
   if (!total_sum_feat_sq_calculated)
@@ -0,0 +1,60 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/feature_hash_cache.h"
+
+namespace VW
+{
+namespace details
+{
+feature_hash_cache::feature_hash_cache(hash_func_t hasher, size_t capacity) : _hasher(hasher)
+{
+  static_assert(sizeof(slot) == 64, "A slot should fill one cache line");
+  size_t buckets = 1;
+  while (buckets * BUCKET_SIZE < capacity) { buckets *= 2; }
+
+  slot empty;
+  std::memset(&empty, 0, sizeof(empty));
+  empty.length = EMPTY_SLOT;
+  _slots.assign(buckets * BUCKET_SIZE, empty);
+  _hands.assign(buckets, 0);
+  _bucket_mask = buckets - 1;
+}
+
+void feature_hash_cache::insert(
+    slot* bucket, uint64_t bucket_index, uint32_t tag, const char* name, size_t length, uint64_t seed, uint64_t value)
+{
+  slot* victim = nullptr;
+  for (size_t i = 0; i < BUCKET_SIZE; i++)
+  {
+    if (bucket[i].length == EMPTY_SLOT)
+    {
+      victim = bucket + i;
+      break;
+    }
+  }
+
+  if (victim == nullptr)
+  {
+    // Every slot is cleared by the first pass of the hand at the latest, so this takes at most two passes.
+    uint8_t& hand = _hands[bucket_index];
+    while (bucket[hand].referenced != 0)
+    {
+      bucket[hand].referenced = 0;
+      hand = static_cast<uint8_t>((hand + 1) % BUCKET_SIZE);
+    }
+    victim = bucket + hand;
+    hand = static_cast<uint8_t>((hand + 1) % BUCKET_SIZE);
+    _stats.evictions++;
+  }
+
+  victim->seed = seed;
+  victim->value = value;
+  victim->tag = tag;
+  victim->length = static_cast<uint8_t>(length);
+  victim->referenced = 0;
+  std::memcpy(victim->name, name, length);
+}
+}  // namespace details
+}  // namespace VW
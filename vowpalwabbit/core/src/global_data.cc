@@ -13,9 +13,11 @@
 #include "vw/core/kskip_ngram_transformer.h"
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
+#include "vw/core/model_checkpoint.h"
 #include "vw/core/named_labels.h"
 #include "vw/core/parser.h"
 #include "vw/core/rand_state.h"
+#include "vw/core/reduction_profiler.h"
 #include "vw/core/reduction_stack.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw_allreduce.h"
@@ -136,14 +138,35 @@ void print_raw_text_by_ref(
 
 void set_mm(shared_data* sd, float label)
 {
-  sd->min_label = std::min(sd->min_label, label);
-  if (label != FLT_MAX) { sd->max_label = std::max(sd->max_label, label); }
+  // Only ever moves a bound outwards, so concurrent learning threads can not undo each other's updates.
+  float min_label = sd->min_label.load(std::memory_order_relaxed);
+  while (label < min_label && !sd->min_label.compare_exchange_weak(min_label, label, std::memory_order_relaxed)) {}
+  if (label != FLT_MAX)
+  {
+    float max_label = sd->max_label.load(std::memory_order_relaxed);
+    while (max_label < label && !sd->max_label.compare_exchange_weak(max_label, label, std::memory_order_relaxed)) {}
+  }
 }
 
 void noop_mm(shared_data*, float) {}
 
+namespace
+{
+thread_local INTERACTIONS::generate_interactions_object_cache* thread_interactions_cache = nullptr;
+}
+
 namespace VW
 {
+void details::set_thread_interactions_cache(INTERACTIONS::generate_interactions_object_cache* cache)
+{
+  thread_interactions_cache = cache;
+}
+
+INTERACTIONS::generate_interactions_object_cache& workspace::interactions_cache()
+{
+  return thread_interactions_cache != nullptr ? *thread_interactions_cache : _generate_interactions_object_cache;
+}
+
 void workspace::learn(example& ec)
 {
   if (l->is_multiline()) THROW("This reduction does not support single-line examples.");
@@ -197,6 +220,14 @@ void workspace::predict(multi_ex& ec)
   VW::LEARNER::as_multiline(l)->predict(ec);
 }
 
+void workspace::predict_batch(example** examples, size_t count)
+{
+  if (l->is_multiline()) THROW("This reduction does not support single-line examples.");
+
+  for (size_t i = 0; i < count; i++) { examples[i]->test_only = true; }
+  VW::LEARNER::as_singleline(l)->predict_batch(examples, count);
+}
+
 void workspace::finish_example(example& ec)
 {
   if (l->is_multiline()) THROW("This reduction does not support single-line examples.");
@@ -0,0 +1,240 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/interactions_simd.h"
+
+#if !defined(VW_NO_INLINE_SIMD)
+#  if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#    define VW_INTERACTIONS_AVX2
+#    define VW_TARGET_AVX2 __attribute__((target("avx2")))
+#    include <immintrin.h>
+#  elif defined(_MSC_VER) && defined(_M_X64)
+#    define VW_INTERACTIONS_AVX2
+#    define VW_TARGET_AVX2
+#    include <immintrin.h>
+#    include <intrin.h>
+#  endif
+#endif
+
+namespace
+{
+#ifdef VW_INTERACTIONS_AVX2
+bool cpu_has_avx2()
+{
+#  if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) { return false; }
+  __cpuid(info, 1);
+  // The OS must save the ymm registers.
+  const bool os_avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+  __cpuidex(info, 7, 0);
+  return os_avx && (info[1] & (1 << 5)) != 0;
+#  else
+  return __builtin_cpu_supports("avx2");
+#  endif
+}
+
+VW_TARGET_AVX2 inline __m128 gather_weights(
+    const float* weights, const feature_index* indices, __m256i halfhash, __m256i offset, __m256i mask)
+{
+  __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+  idx = _mm256_and_si256(_mm256_add_epi64(_mm256_xor_si256(idx, halfhash), offset), mask);
+  return _mm256_i64gather_ps(weights, idx, sizeof(float));
+}
+
+// Adds the eight products to sum one after the other, so the result is the one of the scalar loop.
+VW_TARGET_AVX2 inline float add_in_order(float sum, __m256 products)
+{
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, products);
+  for (float p : lanes) { sum += p; }
+  return sum;
+}
+
+VW_TARGET_AVX2 float dense_interaction_dot_avx2(float sum, const float* weights, uint64_t weight_mask,
+    const feature_index* indices, const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset,
+    feature_value ft_value)
+{
+  const __m256i halfhash_v = _mm256_set1_epi64x(static_cast<int64_t>(halfhash));
+  const __m256i offset_v = _mm256_set1_epi64x(static_cast<int64_t>(offset));
+  const __m256i mask_v = _mm256_set1_epi64x(static_cast<int64_t>(weight_mask));
+  const __m256 ft_value_v = _mm256_set1_ps(ft_value);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128 low = gather_weights(weights, indices + i, halfhash_v, offset_v, mask_v);
+    const __m128 high = gather_weights(weights, indices + i + 4, halfhash_v, offset_v, mask_v);
+    const __m256 w = _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+    const __m256 x = _mm256_mul_ps(ft_value_v, _mm256_loadu_ps(values + i));
+    sum = add_in_order(sum, _mm256_mul_ps(w, x));
+  }
+
+  return INTERACTIONS::dense_interaction_dot_scalar(
+      sum, weights, weight_mask, indices + i, values + i, count - i, halfhash, offset, ft_value);
+}
+
+// Rows of the weights of four interacted features.
+VW_TARGET_AVX2 inline __m256i interacted_rows(
+    const feature_index* indices, __m256i halfhash, __m256i offset, __m256i mask, __m128i row_shift)
+{
+  __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+  idx = _mm256_and_si256(_mm256_add_epi64(_mm256_xor_si256(idx, halfhash), offset), mask);
+  return _mm256_srl_epi64(idx, row_shift);
+}
+
+// Loads the 32 bits starting at each of eight rows of an array with elements of Scale bytes. Only the low Scale bytes
+// of each lane belong to the row.
+template <int Scale>
+VW_TARGET_AVX2 inline __m256i gather_rows(const void* values, __m256i low_rows, __m256i high_rows)
+{
+  const auto* base = static_cast<const int*>(values);
+  const __m128i low = _mm256_i64gather_epi32(base, low_rows, Scale);
+  const __m128i high = _mm256_i64gather_epi32(base, high_rows, Scale);
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+// Vector version of VW::half_to_float for the low 16 bits of each lane.
+VW_TARGET_AVX2 inline __m256 halves_to_floats(__m256i halves)
+{
+  const __m256i shifted_exponent = _mm256_set1_epi32(0x7c00 << 13);
+  __m256i bits = _mm256_slli_epi32(_mm256_and_si256(halves, _mm256_set1_epi32(0x7fff)), 13);
+  const __m256i exponent = _mm256_and_si256(bits, shifted_exponent);
+  bits = _mm256_add_epi32(bits, _mm256_set1_epi32((127 - 15) << 23));
+  const __m256i is_special = _mm256_cmpeq_epi32(exponent, shifted_exponent);
+  bits = _mm256_add_epi32(bits, _mm256_and_si256(is_special, _mm256_set1_epi32((128 - 16) << 23)));
+
+  const __m256i is_subnormal = _mm256_cmpeq_epi32(exponent, _mm256_setzero_si256());
+  const __m256 subnormal = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(bits, _mm256_set1_epi32(1 << 23))),
+      _mm256_castsi256_ps(_mm256_set1_epi32(113 << 23)));
+  const __m256 value = _mm256_blendv_ps(_mm256_castsi256_ps(bits), subnormal, _mm256_castsi256_ps(is_subnormal));
+
+  const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(halves, _mm256_set1_epi32(0x8000)), 16);
+  return _mm256_or_ps(value, _mm256_castsi256_ps(sign));
+}
+
+template <VW::weight_quantization Quantization>
+VW_TARGET_AVX2 __m256 gather_quantized_weights(
+    const VW::quantized_parameters& weights, __m256i low_rows, __m256i high_rows);
+
+template <>
+VW_TARGET_AVX2 inline __m256 gather_quantized_weights<VW::weight_quantization::fp16>(
+    const VW::quantized_parameters& weights, __m256i low_rows, __m256i high_rows)
+{
+  return halves_to_floats(gather_rows<2>(weights.halves(), low_rows, high_rows));
+}
+
+template <>
+VW_TARGET_AVX2 inline __m256 gather_quantized_weights<VW::weight_quantization::bf16>(
+    const VW::quantized_parameters& weights, __m256i low_rows, __m256i high_rows)
+{
+  return _mm256_castsi256_ps(_mm256_slli_epi32(gather_rows<2>(weights.halves(), low_rows, high_rows), 16));
+}
+
+template <>
+VW_TARGET_AVX2 inline __m256 gather_quantized_weights<VW::weight_quantization::int8>(
+    const VW::quantized_parameters& weights, __m256i low_rows, __m256i high_rows)
+{
+  // Sign extend the low byte of each lane.
+  const __m256i bytes = gather_rows<1>(weights.int8_values(), low_rows, high_rows);
+  const __m256 values = _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(bytes, 24), 24));
+
+  const __m128i block_shift = _mm_cvtsi32_si128(static_cast<int>(VW::quantized_parameters::INT8_BLOCK_BITS));
+  const __m128 low_scales =
+      _mm256_i64gather_ps(weights.scales(), _mm256_srl_epi64(low_rows, block_shift), sizeof(float));
+  const __m128 high_scales =
+      _mm256_i64gather_ps(weights.scales(), _mm256_srl_epi64(high_rows, block_shift), sizeof(float));
+  return _mm256_mul_ps(values, _mm256_insertf128_ps(_mm256_castps128_ps256(low_scales), high_scales, 1));
+}
+
+template <VW::weight_quantization Quantization>
+VW_TARGET_AVX2 float quantized_interaction_dot_avx2(float sum, const VW::quantized_parameters& weights,
+    const feature_index* indices, const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset,
+    feature_value ft_value)
+{
+  const __m256i halfhash_v = _mm256_set1_epi64x(static_cast<int64_t>(halfhash));
+  const __m256i offset_v = _mm256_set1_epi64x(static_cast<int64_t>(offset));
+  const __m256i mask_v = _mm256_set1_epi64x(static_cast<int64_t>(weights.mask()));
+  const __m128i row_shift = _mm_cvtsi32_si128(static_cast<int>(weights.row_shift()));
+  const __m256 ft_value_v = _mm256_set1_ps(ft_value);
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256i low_rows = interacted_rows(indices + i, halfhash_v, offset_v, mask_v, row_shift);
+    const __m256i high_rows = interacted_rows(indices + i + 4, halfhash_v, offset_v, mask_v, row_shift);
+    const __m256 w = gather_quantized_weights<Quantization>(weights, low_rows, high_rows);
+    const __m256 x = _mm256_mul_ps(ft_value_v, _mm256_loadu_ps(values + i));
+    sum = add_in_order(sum, _mm256_mul_ps(w, x));
+  }
+
+  return INTERACTIONS::quantized_interaction_dot_scalar(
+      sum, weights, indices + i, values + i, count - i, halfhash, offset, ft_value);
+}
+#endif
+}  // namespace
+
+namespace INTERACTIONS
+{
+float dense_interaction_dot_scalar(float sum, const float* weights, uint64_t weight_mask, const feature_index* indices,
+    const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset, feature_value ft_value)
+{
+  for (size_t i = 0; i < count; i++)
+  { sum += weights[((indices[i] ^ halfhash) + offset) & weight_mask] * (ft_value * values[i]); }
+  return sum;
+}
+
+float dense_interaction_dot(float sum, const float* weights, uint64_t weight_mask, const feature_index* indices,
+    const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset, feature_value ft_value)
+{
+#ifdef VW_INTERACTIONS_AVX2
+  if (has_simd_interaction_kernel())
+  { return dense_interaction_dot_avx2(sum, weights, weight_mask, indices, values, count, halfhash, offset, ft_value); }
+#endif
+  return dense_interaction_dot_scalar(sum, weights, weight_mask, indices, values, count, halfhash, offset, ft_value);
+}
+
+float quantized_interaction_dot_scalar(float sum, const VW::quantized_parameters& weights,
+    const feature_index* indices, const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset,
+    feature_value ft_value)
+{
+  for (size_t i = 0; i < count; i++)
+  { sum += weights[static_cast<size_t>((indices[i] ^ halfhash) + offset)] * (ft_value * values[i]); }
+  return sum;
+}
+
+float quantized_interaction_dot(float sum, const VW::quantized_parameters& weights, const feature_index* indices,
+    const feature_value* values, size_t count, uint64_t halfhash, uint64_t offset, feature_value ft_value)
+{
+#ifdef VW_INTERACTIONS_AVX2
+  if (has_simd_interaction_kernel())
+  {
+    switch (weights.quantization())
+    {
+      case VW::weight_quantization::fp16:
+        return quantized_interaction_dot_avx2<VW::weight_quantization::fp16>(
+            sum, weights, indices, values, count, halfhash, offset, ft_value);
+      case VW::weight_quantization::bf16:
+        return quantized_interaction_dot_avx2<VW::weight_quantization::bf16>(
+            sum, weights, indices, values, count, halfhash, offset, ft_value);
+      default:
+        return quantized_interaction_dot_avx2<VW::weight_quantization::int8>(
+            sum, weights, indices, values, count, halfhash, offset, ft_value);
+    }
+  }
+#endif
+  return quantized_interaction_dot_scalar(sum, weights, indices, values, count, halfhash, offset, ft_value);
+}
+
+bool has_simd_interaction_kernel()
+{
+#ifdef VW_INTERACTIONS_AVX2
+  static const bool has_avx2 = cpu_has_avx2();
+  return has_avx2;
+#else
+  return false;
+#endif
+}
+}  // namespace INTERACTIONS
@@ -5,6 +5,8 @@
 
 #include "vw/io/logger.h"
 
+#include <cstring>
+
 size_t io_buf::buf_read(char*& pointer, size_t n)
 {
   // return a pointer to the next n bytes.  n must be smaller than the maximum size.
@@ -16,27 +18,12 @@ size_t io_buf::buf_read(char*& pointer, size_t n)
   }
   else  // out of bytes, so refill.
   {
-    if (head != _buffer._begin)  // There exists room to shift.
-    {
-      // Out of buffer so swap to beginning.
-      _buffer.shift_to_front(head);
-      head = _buffer._begin;
-    }
-    if (_current < input_files.size() && fill(input_files[_current].get()) > 0)
-    {                               // read more bytes from _current file if present
-      return buf_read(pointer, n);  // more bytes are read.
-    }
-    else if (++_current < input_files.size())
-    {
-      return buf_read(pointer, n);  // No more bytes, so go to next file and try again.
-    }
-    else
-    {
-      // no more bytes to read, return all that we have left.
-      pointer = head;
-      head = _buffer._end;
-      return _buffer._end - pointer;
-    }
+    if (load_more()) { return buf_read(pointer, n); }
+
+    // no more bytes to read, return all that we have left.
+    pointer = head;
+    head = _buffer._end;
+    return _buffer._end - pointer;
   }
 }
 
@@ -44,7 +31,7 @@ bool io_buf::isbinary()
 {
   if (_buffer._end == head)
   {
-    if (fill(input_files[_current].get()) <= 0) { return false; }
+    if (!load_more()) { return false; }
   }
 
   bool ret = (*head == 0);
@@ -56,8 +43,9 @@ bool io_buf::isbinary()
 size_t io_buf::readto(char*& pointer, char terminal)
 {
   // Return a pointer to the bytes before the terminal.  Must be less than the buffer size.
-  pointer = head;
-  while (pointer < _buffer._end && *pointer != terminal) { pointer++; }
+  // memchr compares many bytes at a time.
+  pointer = head < _buffer._end ? static_cast<char*>(std::memchr(head, terminal, _buffer._end - head)) : nullptr;
+  if (pointer == nullptr) { pointer = _buffer._end; }
   if (pointer != _buffer._end)
   {
     size_t n = pointer - head;
@@ -67,27 +55,12 @@ size_t io_buf::readto(char*& pointer, char terminal)
   }
   else  // Else means we didn't find 'terminal' in the available buffer.
   {
-    // Shift down if there is space at the beginning.
-    if (head != _buffer._begin)
-    {
-      _buffer.shift_to_front(head);
-      head = _buffer._begin;
-    }
+    if (load_more()) { return readto(pointer, terminal); }
 
-    if (_current < input_files.size() && fill(input_files[_current].get()) > 0)
-    {  // more bytes are read.
-      return readto(pointer, terminal);
-    }
-    else if (++_current < input_files.size())
-    {  // no more bytes, so go to next file.
-      return readto(pointer, terminal);
-    }
-    else  // no more bytes to read, return everything we have.
-    {
-      pointer = head;
-      head = _buffer._end;
-      return _buffer._end - pointer;
-    }
+    // no more bytes to read, return everything we have.
+    pointer = head;
+    head = _buffer._end;
+    return _buffer._end - pointer;
   }
 }
 
@@ -137,6 +110,7 @@ void io_buf::flush()
   {
     auto bytes_written = output_files[0]->write(_buffer._begin, unflushed_bytes_count());
     if (bytes_written != static_cast<ssize_t>(unflushed_bytes_count())) { THROW("Failed to write example"); }
+    _flushed_bytes += unflushed_bytes_count();
     head = _buffer._begin;
     output_files[0]->flush();
   }
@@ -147,6 +121,7 @@ void io_buf::reset()
   // This operation is only intended for read buffers.
   assert(output_files.empty());
 
+  end_view();
   for (auto& f : input_files) { f->reset(); }
   _buffer._end = _buffer._begin;
   head = _buffer._begin;
@@ -161,3 +136,80 @@ bool io_buf::is_resettable() const
   return std::all_of(input_files.begin(), input_files.end(),
       [](const std::unique_ptr<VW::io::reader>& ptr) { return ptr->is_resettable(); });
 }
+
+bool io_buf::load_more()
+{
+  while (_current < input_files.size())
+  {
+    auto* file = input_files[_current].get();
+    char* data = nullptr;
+    size_t len = 0;
+
+    if (_viewing)
+    {
+      // Views of the same reader are contiguous, so the next one simply extends the current one.
+      if (file->read_view(data, len))
+      {
+        assert(data == _buffer._end);
+        _buffer._end += len;
+        _buffer._end_array = _buffer._end;
+        return true;
+      }
+      end_view();
+      _current++;
+      continue;
+    }
+
+    if (head != _buffer._begin)  // There exists room to shift.
+    {
+      // Out of buffer so swap to beginning.
+      _buffer.shift_to_front(head);
+      head = _buffer._begin;
+    }
+
+    // Reading straight out of the reader's memory is only possible when nothing is left over in the owned array.
+    if (head == _buffer._end && file->read_view(data, len))
+    {
+      begin_view(data, len);
+      return true;
+    }
+
+    // read more bytes from _current file if present
+    if (fill(file) > 0) { return true; }
+
+    // No more bytes, so go to next file and try again.
+    _current++;
+  }
+  return false;
+}
+
+void io_buf::begin_view(char* data, size_t len)
+{
+  assert(!_viewing && head == _buffer._end);
+  _owned_begin = _buffer._begin;
+  _owned_end_array = _buffer._end_array;
+  _buffer._begin = data;
+  _buffer._end = data + len;
+  _buffer._end_array = data + len;
+  head = data;
+  _viewing = true;
+}
+
+void io_buf::end_view()
+{
+  if (!_viewing) { return; }
+
+  const char* unread = head;
+  const size_t unread_size = _buffer._end - head;
+  _buffer._begin = _owned_begin;
+  _buffer._end = _owned_begin;
+  _buffer._end_array = _owned_end_array;
+  _owned_begin = nullptr;
+  _owned_end_array = nullptr;
+  _viewing = false;
+
+  if (unread_size > _buffer.capacity()) { _buffer.realloc(unread_size); }
+  if (unread_size > 0) { std::memcpy(_buffer._begin, unread, unread_size); }
+  _buffer._end = _buffer._begin + unread_size;
+  head = _buffer._begin;
+}
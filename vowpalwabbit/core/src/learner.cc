@@ -4,12 +4,21 @@
 
 #include "vw/core/learner.h"
 
+#include "vw/core/daemon_server.h"
+#include "vw/core/model_checkpoint.h"
 #include "vw/core/parse_dispatch_loop.h"
 #include "vw/core/parse_regressor.h"
 #include "vw/core/parser.h"
 #include "vw/core/reductions/conditional_contextual_bandit.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/vw.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace VW
 {
 namespace LEARNER
@@ -18,12 +27,14 @@ void learn_ex(example& ec, VW::workspace& all)
 {
   all.learn(ec);
   as_singleline(all.l)->finish_example(all, ec);
+  if (all.checkpointer != nullptr) { all.checkpointer->on_learn(all); }
 }
 
 void learn_multi_ex(multi_ex& ec_seq, VW::workspace& all)
 {
   all.learn(ec_seq);
   as_multiline(all.l)->finish_example(all, ec_seq);
+  if (all.checkpointer != nullptr) { all.checkpointer->on_learn(all); }
 }
 
 void end_pass(example& ec, VW::workspace& all)
@@ -261,6 +272,140 @@ void process_examples(queue_type& examples, handler_type& handler)
   while ((ec = examples.pop()) != nullptr) { handler.on_example(ec); }
 }
 
+// Drives the threads started for --learn_threads. Regular examples are learned concurrently and the threads update
+// the shared weights without locking (Hogwild). Finishing an example, which accounts the loss into shared_data and
+// prints progress and predictions, is serialized. Pass ends and save commands run alone once every example popped
+// before them has been learned, and examples popped after them wait until they are done. Periodic checkpoints also
+// run alone, but are only ordered after the example which made them due.
+class hogwild_learner
+{
+public:
+  hogwild_learner(VW::workspace& all) : _all(all) {}
+
+  void run()
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(_all.learn_threads - 1);
+    for (uint64_t i = 1; i < _all.learn_threads; i++) { threads.emplace_back([this] { learn_examples(); }); }
+    learn_examples();
+    for (auto& thread : threads) { thread.join(); }
+    // The remaining examples are drained by the caller.
+    if (_stopping.load()) { _all.early_terminate = true; }
+    if (_exception != nullptr) { std::rethrow_exception(_exception); }
+  }
+
+private:
+  void learn_examples()
+  {
+    INTERACTIONS::generate_interactions_object_cache cache;
+    VW::details::set_thread_interactions_cache(&cache);
+    try
+    {
+      example* ec;
+      while ((ec = pop()) != nullptr)
+      {
+        if (ec->indices.size() <= 1 && (ec->end_pass || is_save_cmd(ec)))
+        {
+          run_exclusive([this, ec] {
+            if (ec->end_pass) { end_pass(*ec, _all); }
+            else
+            {
+              save(*ec, _all);
+            }
+          });
+        }
+        else if (learn(*ec))
+        {
+          wait_and_run_exclusive([this] { _all.checkpointer->save_checkpoint(_all); });
+        }
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_exception == nullptr) { _exception = std::current_exception(); }
+      // Stop the other threads.
+      _stopping = true;
+    }
+    VW::details::set_thread_interactions_cache(nullptr);
+  }
+
+  // Takes the next example and, in the same step, either counts it as in flight or claims exclusive access for it if
+  // it is a command. An example popped before a command is therefore always learned before the command runs.
+  example* pop()
+  {
+    std::lock_guard<std::mutex> pop_lock(_pop_mutex);
+    if (_stopping.load()) { return nullptr; }
+    example* ec = VW::get_example(_all.example_parser);
+    if (ec == nullptr) { return nullptr; }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this] { return !_exclusive; });
+    if (ec->indices.size() <= 1 && (ec->end_pass || is_save_cmd(ec))) { _exclusive = true; }
+    else
+    {
+      _in_flight++;
+    }
+    return ec;
+  }
+
+  // Learns from an example counted as in flight by pop(). Returns whether a periodic checkpoint is due, which has to
+  // be saved while no other thread is learning.
+  bool learn(example& ec)
+  {
+    auto done_guard = VW::scope_exit([this] {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (--_in_flight == 0 && _exclusive) { _idle.notify_all(); }
+    });
+
+    _all.learn(ec);
+    std::lock_guard<std::mutex> lock(_finish_mutex);
+    as_singleline(_all.l)->finish_example(_all, ec);
+    return _all.checkpointer != nullptr && _all.checkpointer->checkpoint_due();
+  }
+
+  // Runs func once no example is in flight. Exclusive access must already be claimed.
+  template <typename FuncT>
+  void run_exclusive(FuncT func)
+  {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _idle.wait(lock, [this] { return _in_flight == 0; });
+    }
+    auto done_guard = VW::scope_exit([this] {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _exclusive = false;
+      _idle.notify_all();
+    });
+
+    func();
+    // Early stopping at the end of a pass sets this, and no other thread reads it while the threads run.
+    if (_all.early_terminate) { _stopping = true; }
+  }
+
+  template <typename FuncT>
+  void wait_and_run_exclusive(FuncT func)
+  {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _idle.wait(lock, [this] { return !_exclusive; });
+      _exclusive = true;
+    }
+    run_exclusive(func);
+  }
+
+  VW::workspace& _all;
+  std::mutex _pop_mutex;
+  std::mutex _mutex;
+  std::condition_variable _idle;
+  size_t _in_flight = 0;
+  bool _exclusive = false;
+  // Set when the threads have to stop. all.early_terminate is only written from here once they have joined.
+  std::atomic<bool> _stopping{false};
+  std::mutex _finish_mutex;
+  std::exception_ptr _exception;
+};
+
 template <typename context_type>
 void generic_driver(ready_examples_queue& examples, context_type& context)
 {
@@ -283,6 +428,17 @@ void generic_driver(ready_examples_queue& examples, context_type& context)
 
 void generic_driver(VW::workspace& all)
 {
+  // The event loop serves every connection, afterwards the driver consumes the parser's single empty pass.
+  if (all.epoll_daemon) { VW::details::run_epoll_daemon(all); }
+
+  if (all.learn_threads > 1)
+  {
+    hogwild_learner learner(all);
+    learner.run();
+    drain_examples(all);
+    return;
+  }
+
   single_instance_context context(all);
   ready_examples_queue examples(all);
   generic_driver(examples, context);
@@ -312,6 +468,8 @@ void generic_driver_onethread(VW::workspace& all)
 
 void generic_driver_onethread(VW::workspace& all)
 {
+  if (all.epoll_daemon) { VW::details::run_epoll_daemon(all); }
+
   if (all.l->is_multiline()) { generic_driver_onethread<multi_example_handler<single_instance_context>>(all); }
   else
   {
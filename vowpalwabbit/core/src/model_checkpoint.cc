@@ -0,0 +1,242 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/model_checkpoint.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/global_data.h"
+#include "vw/core/io_buf.h"
+#include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
+
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+// Flushes what was written to path through the operating system's caches to the disk.
+void sync_to_disk(const std::string& path)
+{
+#ifdef _WIN32
+  const int fd = _open(path.c_str(), _O_RDWR | _O_BINARY);
+  const bool synced = fd != -1 && _commit(fd) == 0;
+  if (fd != -1) { _close(fd); }
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  const bool synced = fd != -1 && fsync(fd) == 0;
+  if (fd != -1) { close(fd); }
+#endif
+  if (!synced) { THROW("Failed to sync model checkpoint to disk: " << path); }
+}
+
+// Syncs the directory holding filename, so a rename in it survives a crash. Windows can not open directories as
+// files and journals the rename itself.
+void sync_parent_directory(const std::string& filename)
+{
+#ifndef _WIN32
+  const auto slash = filename.find_last_of('/');
+  const std::string directory =
+      slash == std::string::npos ? std::string(".") : (slash == 0 ? std::string("/") : filename.substr(0, slash));
+  sync_to_disk(directory);
+#else
+  _UNUSED(filename);
+#endif
+}
+}  // namespace
+
+namespace VW
+{
+namespace details
+{
+model_checkpointer::model_checkpointer(
+    std::string filename, uint64_t every_examples, float every_seconds, bool async_writes)
+    : _filename(std::move(filename))
+    , _every_examples(every_examples)
+    , _every_seconds(every_seconds)
+    , _async_writes(async_writes)
+    , _last_checkpoint(std::chrono::steady_clock::now())
+{
+  if (_async_writes) { _writer = std::thread(&model_checkpointer::writer_loop, this); }
+}
+
+model_checkpointer::~model_checkpointer()
+{
+  if (!_writer.joinable()) { return; }
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _work_available.notify_all();
+  _writer.join();
+}
+
+bool model_checkpointer::checkpoint_due()
+{
+  _examples_since_checkpoint++;
+  bool due = _every_examples > 0 && _examples_since_checkpoint >= _every_examples;
+  const bool timed = _every_seconds.count() > 0.f;
+  const auto now = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+  if (timed && now - _last_checkpoint >= _every_seconds) { due = true; }
+  if (!due) { return false; }
+
+  _examples_since_checkpoint = 0;
+  _last_checkpoint = now;
+  return true;
+}
+
+void model_checkpointer::save_checkpoint(VW::workspace& all)
+{
+  if (_deltas)
+  {
+    const std::string filename = _filename + "." + std::to_string(_snapshots_saved);
+    save(all, filename, _snapshots_saved > 0);
+    // The model was serialized before returning, so the next delta starts from here.
+    all.weights.dense_weights.clear_dirty_blocks();
+    _snapshots_saved++;
+  }
+  else
+  {
+    save(all, _filename, false);
+  }
+}
+
+void model_checkpointer::save(VW::workspace& all, const std::string& filename, bool delta)
+{
+  if (_async_writes) { return save_async(all, filename, delta); }
+
+  if (delta) { VW::save_predictor_delta(all, filename); }
+  else
+  {
+    VW::save_predictor(all, filename);
+  }
+  std::unique_lock<std::mutex> lock(_mutex);
+  _checkpoints_written++;
+}
+
+void model_checkpointer::save_async(VW::workspace& all, const std::string& filename, bool delta)
+{
+  {
+    // Surface a failed write on the learning thread rather than silently dropping checkpoints.
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_error != nullptr)
+    {
+      auto error = _error;
+      _error = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  auto model = std::make_shared<std::vector<char>>();
+  io_buf buffer;
+  buffer.add_file(VW::io::create_vector_writer(model));
+  if (delta) { VW::save_predictor_delta(all, buffer); }
+  else
+  {
+    VW::save_predictor(all, buffer);
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto queued = std::find_if(
+        _queue.begin(), _queue.end(), [&filename](const pending_write& write) { return write.filename == filename; });
+    if (queued != _queue.end()) { queued->model = std::move(model); }
+    else
+    {
+      _queue.push_back({filename, std::move(model)});
+    }
+  }
+  _work_available.notify_one();
+}
+
+void model_checkpointer::wait()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _idle.wait(lock, [this] { return _queue.empty() && !_writing; });
+  if (_error != nullptr)
+  {
+    auto error = _error;
+    _error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+uint64_t model_checkpointer::checkpoints_written() const
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  return _checkpoints_written;
+}
+
+void model_checkpointer::writer_loop()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true)
+  {
+    _work_available.wait(lock, [this] { return _stopping || !_queue.empty(); });
+    // Queued checkpoints are still written when stopping.
+    if (_queue.empty()) { return; }
+
+    auto write = std::move(_queue.front());
+    _queue.pop_front();
+    _writing = true;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try
+    {
+      write_model_file(write.filename, *write.model);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+    write.model.reset();
+
+    lock.lock();
+    _writing = false;
+    if (error == nullptr) { _checkpoints_written++; }
+    else if (_error == nullptr)
+    {
+      _error = error;
+    }
+    _idle.notify_all();
+  }
+}
+
+void write_model_file(const std::string& filename, const std::vector<char>& model)
+{
+  const std::string temp_name = filename + ".writing";
+  {
+    auto writer = VW::io::open_file_writer(temp_name);
+    size_t written = 0;
+    while (written < model.size())
+    {
+      const auto num_bytes = writer->write(model.data() + written, model.size() - written);
+      if (num_bytes <= 0) { THROW("Failed to write model checkpoint: " << temp_name); }
+      written += static_cast<size_t>(num_bytes);
+    }
+    writer->flush();
+  }
+  // Without syncing the data and then the directory entry first, a crash right after the rename can leave an empty
+  // or partial model under the final name.
+  sync_to_disk(temp_name);
+  sync_parent_directory(temp_name);
+
+  // rename replaces the destination atomically on POSIX. Windows refuses to replace an existing file.
+  if (std::rename(temp_name.c_str(), filename.c_str()) != 0)
+  {
+    std::remove(filename.c_str());
+    if (std::rename(temp_name.c_str(), filename.c_str()) != 0)
+    { THROW("Failed to rename model checkpoint " << temp_name << " to " << filename); }
+  }
+}
+}  // namespace details
+}  // namespace VW
@@ -0,0 +1,203 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/object_pool.h"
+
+#include <algorithm>
+
+namespace VW
+{
+namespace details
+{
+struct object_pool_thread_cache
+{
+  // Set to nullptr when the pool is destroyed. Only changed while holding the registry mutex.
+  std::atomic<thread_cached_object_pool_base*> pool{nullptr};
+  std::vector<void*> objects;
+  // Only written by the owning thread, atomic so that stats() can read them from any thread.
+  std::atomic<uint64_t> get_count{0};
+  std::atomic<uint64_t> cache_hits{0};
+  std::atomic<uint64_t> return_count{0};
+};
+
+namespace
+{
+// Guards attaching caches to pools and detaching them when either the thread exits or the pool is destroyed.
+std::mutex& registry_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+void increment(std::atomic<uint64_t>& counter)
+{
+  // Single writer, so a plain load and store is enough and avoids a locked instruction.
+  counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+}  // namespace
+
+// All caches of one thread, one for each pool it has used.
+struct object_pool_thread_caches
+{
+  std::vector<std::unique_ptr<object_pool_thread_cache>> caches;
+
+  // Makes sure the registry mutex is constructed first, and therefore destroyed after this.
+  object_pool_thread_caches() { registry_mutex(); }
+
+  ~object_pool_thread_caches()
+  {
+    std::lock_guard<std::mutex> registry_lock(registry_mutex());
+    for (auto& cache : caches)
+    {
+      auto* pool = cache->pool.load(std::memory_order_relaxed);
+      if (pool != nullptr) { pool->detach(*cache); }
+    }
+  }
+
+  static object_pool_thread_caches& local()
+  {
+    static thread_local object_pool_thread_caches instance;
+    return instance;
+  }
+};
+
+thread_cached_object_pool_base::thread_cached_object_pool_base(size_t batch_size)
+    : _batch_size(batch_size == 0 ? 1 : batch_size)
+{
+}
+
+void* thread_cached_object_pool_base::get_object()
+{
+  auto& cache = local_cache();
+  increment(cache.get_count);
+  if (cache.objects.empty()) { refill(cache); }
+  else
+  {
+    increment(cache.cache_hits);
+  }
+
+  auto* obj = cache.objects.back();
+  cache.objects.pop_back();
+  return obj;
+}
+
+void thread_cached_object_pool_base::return_object(void* obj)
+{
+  auto& cache = local_cache();
+  increment(cache.return_count);
+  cache.objects.push_back(obj);
+  // Flushing down to a single batch instead of to zero avoids a thread which both takes and returns objects from
+  // moving the same batch back and forth.
+  if (cache.objects.size() >= 2 * _batch_size) { flush(cache); }
+}
+
+bool thread_cached_object_pool_base::empty() const
+{
+  const auto* cache = find_local_cache();
+  if (cache != nullptr && !cache->objects.empty()) { return false; }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _free.empty();
+}
+
+object_pool_stats thread_cached_object_pool_base::stats() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto result = _stats;
+  for (const auto* cache : _caches)
+  {
+    result.get_count += cache->get_count.load(std::memory_order_relaxed);
+    result.cache_hits += cache->cache_hits.load(std::memory_order_relaxed);
+    result.return_count += cache->return_count.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+size_t thread_cached_object_pool_base::release_thread_caches()
+{
+  std::lock_guard<std::mutex> registry_lock(registry_mutex());
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // The owning threads no longer use these caches for this pool, so reading their objects is safe. The pointers left
+  // in them are dropped once the thread attaches a cache to another pool or exits.
+  auto free_count = _free.size();
+  for (auto* cache : _caches)
+  {
+    free_count += cache->objects.size();
+    cache->pool.store(nullptr, std::memory_order_relaxed);
+  }
+  _caches.clear();
+  return free_count;
+}
+
+object_pool_thread_cache& thread_cached_object_pool_base::local_cache()
+{
+  auto* cache = find_local_cache();
+  if (cache != nullptr) { return *cache; }
+
+  auto& caches = object_pool_thread_caches::local().caches;
+  std::lock_guard<std::mutex> registry_lock(registry_mutex());
+
+  // Drop caches of pools which have been destroyed.
+  caches.erase(std::remove_if(caches.begin(), caches.end(),
+                   [](const std::unique_ptr<object_pool_thread_cache>& c)
+                   { return c->pool.load(std::memory_order_relaxed) == nullptr; }),
+      caches.end());
+
+  caches.emplace_back(new object_pool_thread_cache());
+  cache = caches.back().get();
+  cache->pool.store(this, std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _caches.push_back(cache);
+  return *cache;
+}
+
+object_pool_thread_cache* thread_cached_object_pool_base::find_local_cache() const
+{
+  for (auto& cache : object_pool_thread_caches::local().caches)
+  {
+    if (cache->pool.load(std::memory_order_relaxed) == this) { return cache.get(); }
+  }
+  return nullptr;
+}
+
+void thread_cached_object_pool_base::refill(object_pool_thread_cache& cache)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _stats.cache_misses++;
+  if (_free.empty())
+  {
+    new_chunk();
+    _stats.chunk_allocations++;
+  }
+
+  const auto count = std::min(_batch_size, _free.size());
+  cache.objects.insert(cache.objects.end(), _free.end() - count, _free.end());
+  _free.resize(_free.size() - count);
+}
+
+void thread_cached_object_pool_base::flush(object_pool_thread_cache& cache)
+{
+  // Keep the most recently returned objects since they are the most likely to still be in the cpu cache.
+  const auto count = cache.objects.size() - _batch_size;
+  std::lock_guard<std::mutex> lock(_mutex);
+  _stats.batch_returns++;
+  _free.insert(_free.end(), cache.objects.begin(), cache.objects.begin() + count);
+  cache.objects.erase(cache.objects.begin(), cache.objects.begin() + count);
+}
+
+void thread_cached_object_pool_base::detach(object_pool_thread_cache& cache)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _free.insert(_free.end(), cache.objects.begin(), cache.objects.end());
+  cache.objects.clear();
+  _stats.get_count += cache.get_count.load(std::memory_order_relaxed);
+  _stats.cache_hits += cache.cache_hits.load(std::memory_order_relaxed);
+  _stats.return_count += cache.return_count.load(std::memory_order_relaxed);
+  _caches.erase(std::find(_caches.begin(), _caches.end(), &cache));
+  cache.pool.store(nullptr, std::memory_order_relaxed);
+}
+}  // namespace details
+}  // namespace VW
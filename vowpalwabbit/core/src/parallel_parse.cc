@@ -0,0 +1,393 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/parallel_parse.h"
+
+#include "vw/core/example.h"
+#include "vw/core/global_data.h"
+#include "vw/core/parse_example.h"
+#include "vw/core/parse_example_json.h"
+#include "vw/core/parser.h"
+#include "vw/core/reduction_profiler.h"
+#include "vw/core/shared_data.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#  include <poll.h>
+#endif
+
+namespace
+{
+// Lines are handed to workers in chunks to amortize the synchronization, but kept small since every line in flight
+// holds examples taken from the pool.
+constexpr size_t LINES_PER_CHUNK = 16;
+constexpr size_t CHUNKS_IN_FLIGHT_PER_THREAD = 2;
+// How often the reader checks whether it was stopped while waiting for more input on stdin.
+constexpr int STOP_POLL_INTERVAL_MS = 100;
+
+// Workers take examples from the pool without going through its counter, since they finish lines out of order.
+// parse_chunk numbers them by line before parsing and next() renumbers them as it hands them out in input order.
+VW::example& get_unnumbered_example(void* all)
+{
+  return *static_cast<VW::workspace*>(all)->example_parser->example_pool.get_object();
+}
+
+bool parse_text_line(VW::workspace& all, VW::details::line_parse_scratch& scratch, char* line, size_t num_chars,
+    VW::multi_ex& examples)
+{
+  substring_to_example(&all, examples[0], VW::string_view(line, num_chars), scratch.words, scratch.reuse_mem,
+      scratch.hash_cache.get());
+  return true;
+}
+
+template <bool audit>
+bool parse_json_line(VW::workspace& all, VW::details::line_parse_scratch& scratch, char* line, size_t num_chars,
+    VW::multi_ex& examples)
+{
+  // Mirrors read_features_json for plain json, using the thread's scratch space instead of the parser's.
+  VW::read_line_json_s<audit>(all.example_parser->lbl_parser, all.example_parser->hasher, all.hash_seed,
+      all.parse_mask, all.chain_hash_json, &scratch.reuse_mem, all.sd->ldict.get(), examples, line, num_chars,
+      &get_unnumbered_example, &all, all.logger,
+      &all.ignore_features_dsjson, nullptr, scratch.hash_cache.get());
+
+  if (examples.size() > 1)
+  {
+    auto& ae = get_unnumbered_example(&all);
+    substring_to_example(&all, &ae, VW::string_view(), scratch.words, scratch.reuse_mem);
+    ae.is_newline = true;
+    examples.push_back(&ae);
+  }
+  return true;
+}
+
+// The workers parse json with rapidjson, so input which asked for simdjson stays on the parser thread.
+bool uses_simdjson(const parser& p)
+{
+#ifdef VW_BUILD_SIMDJSON
+  return p.simdjson_parser != nullptr;
+#else
+  _UNUSED(p);
+  return false;
+#endif
+}
+}  // namespace
+
+namespace VW
+{
+namespace details
+{
+void parallel_parse_pipeline::chunk::clear()
+{
+  text.clear();
+  lines.clear();
+  results.clear();
+  error = nullptr;
+  error_line = 0;
+  first_example_number = 0;
+  end_of_input = false;
+  parsed = false;
+}
+
+parallel_parse_pipeline::parallel_parse_pipeline(VW::workspace& all, size_t num_threads, line_parser_func line_parser)
+    : _all(all)
+    , _num_threads(num_threads)
+    , _line_parser(line_parser)
+    , _lines_per_chunk(LINES_PER_CHUNK)
+    , _max_chunks_in_flight(CHUNKS_IN_FLIGHT_PER_THREAD * num_threads)
+{
+}
+
+parallel_parse_pipeline::~parallel_parse_pipeline() { stop(); }
+
+int parallel_parse_pipeline::next(io_buf& input, VW::multi_ex& examples)
+{
+  if (!_running)
+  {
+    // The first line gets the number of the placeholder, as next() hands it the placeholder's number below.
+    _next_example_number = examples.empty()
+        ? static_cast<size_t>(_all.example_parser->num_examples_taken_from_pool.load(std::memory_order_relaxed))
+        : examples[0]->example_counter;
+    _running = true;
+    _reader = std::thread(&parallel_parse_pipeline::reader_loop, this, std::ref(input));
+    for (size_t i = 0; i < _num_threads; i++) { _workers.emplace_back(&parallel_parse_pipeline::worker_loop, this); }
+  }
+
+  while (true)
+  {
+    chunk* front = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _chunk_parsed.wait(lock, [this] { return !_in_flight.empty() && _in_flight.front()->parsed; });
+      front = _in_flight.front().get();
+    }
+
+    // A parsed chunk at the front is only touched by this thread until it is recycled.
+    if (front->error != nullptr && _next_line == front->error_line)
+    {
+      auto error = front->error;
+      front->error = nullptr;
+      std::rethrow_exception(error);
+    }
+
+    if (_next_line < front->lines.size())
+    {
+      auto& result = front->results[_next_line++];
+      if (result.empty()) { continue; }
+
+      // Swap the placeholder example the caller passed in for the parsed ones. The first takes over the number of the
+      // placeholder and the others are numbered after it, as they would be when parsing on one thread.
+      auto& counter = _all.example_parser->num_examples_taken_from_pool;
+      const uint64_t first_counter =
+          examples.empty() ? counter.fetch_add(1, std::memory_order_relaxed) : examples[0]->example_counter;
+      VW::return_multiple_example(_all, examples);
+      examples.swap(result);
+      examples[0]->example_counter = static_cast<size_t>(first_counter);
+      for (size_t i = 1; i < examples.size(); i++)
+      { examples[i]->example_counter = static_cast<size_t>(counter.fetch_add(1, std::memory_order_relaxed)); }
+      return 1;
+    }
+
+    const bool end_of_input = front->end_of_input;
+    recycle_front_chunk();
+    if (end_of_input)
+    {
+      // The reader has exited, the remaining threads are stopped by the next reset_source or end_parser.
+      return 0;
+    }
+  }
+}
+
+void parallel_parse_pipeline::stop()
+{
+  if (!_running) { return; }
+
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _space_available.notify_all();
+  _work_available.notify_all();
+
+  if (_reader.joinable()) { _reader.join(); }
+  for (auto& worker : _workers) { worker.join(); }
+  _workers.clear();
+
+  for (auto& c : _in_flight)
+  {
+    for (auto& result : c->results) { VW::return_multiple_example(_all, result); }
+    c->clear();
+    _free_chunks.push_back(std::move(c));
+  }
+  _in_flight.clear();
+  _work.clear();
+  _next_line = 0;
+  _stopping = false;
+  _running = false;
+}
+
+void parallel_parse_pipeline::reader_loop(io_buf& input)
+{
+  const VW::details::profile_frame* read_frame =
+      _all.profiler != nullptr ? _all.profiler->get_frame("parse_reader") : nullptr;
+  // Only stdin is not resettable here, daemon connections never use the pipeline.
+  const bool from_stdin = !input.is_resettable();
+  while (true)
+  {
+    std::unique_ptr<chunk> current;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _space_available.wait(lock, [this] { return _stopping || _in_flight.size() < _max_chunks_in_flight; });
+      if (_stopping) { return; }
+      if (_free_chunks.empty()) { current = VW::make_unique<chunk>(); }
+      else
+      {
+        current = std::move(_free_chunks.back());
+        _free_chunks.pop_back();
+      }
+    }
+
+    // This thread is the only user of the io_buf while the pipeline is running.
+    VW::details::profile_scope profile(_all.profiler.get(), read_frame, 0);
+    try
+    {
+      while (current->lines.size() < _lines_per_chunk)
+      {
+        if (from_stdin && !wait_for_line(input)) { return; }
+
+        char* line = nullptr;
+        size_t num_chars = 0;
+        if (read_features(input, line, num_chars) < 1)
+        {
+          current->end_of_input = true;
+          break;
+        }
+
+        // The line points into the io_buf so it must be copied before the next read. Null terminate it since the
+        // json parser expects it.
+        const size_t offset = current->text.size();
+        current->text.insert(current->text.end(), line, line + num_chars);
+        current->text.push_back('\0');
+        current->lines.emplace_back(offset, num_chars);
+      }
+    }
+    catch (...)
+    {
+      current->error = std::current_exception();
+      current->error_line = current->lines.size();
+      current->end_of_input = true;
+    }
+
+    profile.set_examples(current->lines.size());
+    current->first_example_number = _next_example_number;
+    _next_example_number += current->lines.size();
+    const bool end_of_input = current->end_of_input;
+    current->results.resize(current->lines.size());
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      auto* raw = current.get();
+      if (raw->lines.empty()) { raw->parsed = true; }
+      else
+      {
+        _work.push_back(raw);
+      }
+      _in_flight.push_back(std::move(current));
+    }
+    _work_available.notify_one();
+    _chunk_parsed.notify_all();
+
+    if (end_of_input) { return; }
+  }
+}
+
+bool parallel_parse_pipeline::wait_for_line(io_buf& input)
+{
+#ifndef _WIN32
+  // A blocking read would keep stop() waiting for as long as nothing is written to stdin, so only read once poll says
+  // the read returns right away. Compressed input can still block inside zlib until it has a full block.
+  while (!input.has_buffered('\n'))
+  {
+    pollfd fd{fileno(stdin), POLLIN, 0};
+    const int ready = poll(&fd, 1, STOP_POLL_INTERVAL_MS);
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (_stopping) { return false; }
+    }
+    if (ready == 0 || (ready < 0 && errno == EINTR)) { continue; }
+    // Either the input is readable, closed or in error, and the error is left to the read to report.
+    if (ready < 0 || !input.load_more()) { break; }
+  }
+#else
+  // Pipes cannot be polled on Windows, stop() waits for the pending read there.
+  _UNUSED(input);
+#endif
+  return true;
+}
+
+void parallel_parse_pipeline::worker_loop()
+{
+  line_parse_scratch scratch;
+  if (_all.example_parser->hash_cache != nullptr)
+  {
+    scratch.hash_cache = VW::make_unique<feature_hash_cache>(
+        _all.example_parser->hasher, _all.example_parser->hash_cache->capacity());
+  }
+  const VW::details::profile_frame* parse_frame =
+      _all.profiler != nullptr ? _all.profiler->get_frame("parse_worker") : nullptr;
+  while (true)
+  {
+    chunk* current = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _work_available.wait(lock, [this] { return _stopping || !_work.empty(); });
+      if (_stopping)
+      {
+        if (scratch.hash_cache != nullptr)
+        { _all.example_parser->worker_hash_cache_stats += scratch.hash_cache->stats(); }
+        return;
+      }
+      current = _work.front();
+      _work.pop_front();
+    }
+
+    {
+      VW::details::profile_scope profile(_all.profiler.get(), parse_frame, current->lines.size());
+      parse_chunk(*current, scratch);
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      current->parsed = true;
+    }
+    _chunk_parsed.notify_all();
+  }
+}
+
+void parallel_parse_pipeline::parse_chunk(chunk& c, line_parse_scratch& scratch)
+{
+  const size_t num_lines = c.error != nullptr ? c.error_line : c.lines.size();
+  for (size_t i = 0; i < num_lines; i++)
+  {
+    auto& examples = c.results[i];
+    examples.push_back(&get_unnumbered_example(&_all));
+    // Each line of text is a single example, so this is the number it has when parsing on one thread, which TC_parser
+    // warnings refer to. Lines holding several json examples are renumbered by next().
+    examples[0]->example_counter = c.first_example_number + i;
+    try
+    {
+      if (!_line_parser(_all, scratch, c.text.data() + c.lines[i].first, c.lines[i].second, examples))
+      { VW::return_multiple_example(_all, examples); }
+    }
+    catch (...)
+    {
+      VW::return_multiple_example(_all, examples);
+      c.error = std::current_exception();
+      c.error_line = i;
+      return;
+    }
+  }
+}
+
+void parallel_parse_pipeline::recycle_front_chunk()
+{
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto front = std::move(_in_flight.front());
+    _in_flight.pop_front();
+    front->clear();
+    _free_chunks.push_back(std::move(front));
+  }
+  _next_line = 0;
+  _space_available.notify_one();
+}
+
+bool enable_parallel_parsing(VW::workspace& all, size_t num_threads)
+{
+  auto* p = all.example_parser;
+  line_parser_func line_parser = nullptr;
+  if (p->reader == read_features_string) { line_parser = parse_text_line; }
+  else if (p->reader == &read_features_json<true> && !p->decision_service_json && !uses_simdjson(*p))
+  {
+    line_parser = parse_json_line<true>;
+  }
+  else if (p->reader == &read_features_json<false> && !p->decision_service_json && !uses_simdjson(*p))
+  {
+    line_parser = parse_json_line<false>;
+  }
+
+  if (line_parser == nullptr) { return false; }
+
+  p->parallel_parse = VW::make_unique<parallel_parse_pipeline>(all, num_threads, line_parser);
+  p->reader = read_features_parallel;
+  return true;
+}
+
+int read_features_parallel(VW::workspace* all, io_buf& buf, VW::multi_ex& examples)
+{
+  return all->example_parser->parallel_parse->next(buf, examples);
+}
+}  // namespace details
+}  // namespace VW
@@ -14,6 +14,7 @@
 #include "vw/core/best_constant.h"
 #include "vw/core/constant.h"
 #include "vw/core/crossplat_compat.h"
+#include "vw/core/daemon_server.h"
 #include "vw/core/global_data.h"
 #include "vw/core/interactions.h"
 #include "vw/core/kskip_ngram_transformer.h"
@@ -21,6 +22,7 @@
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
 #include "vw/core/memory.h"
+#include "vw/core/model_checkpoint.h"
 #include "vw/core/named_labels.h"
 #include "vw/core/numeric_casts.h"
 #include "vw/core/parse_example.h"
@@ -30,6 +32,7 @@
 #include "vw/core/prediction_type.h"
 #include "vw/core/rand48.h"
 #include "vw/core/rand_state.h"
+#include "vw/core/reduction_profiler.h"
 #include "vw/core/reduction_stack.h"
 #include "vw/core/reductions/metrics.h"
 #include "vw/core/scope_exit.h"
@@ -303,6 +306,7 @@ void parse_diagnostics(options_i& options, VW::workspace& all)
   bool help = false;
   bool skip_driver = false;
   std::string progress_arg;
+  std::string profile_file;
   option_group_definition diagnostic_group("Diagnostic");
   diagnostic_group.add(make_option("version", version_arg).help("Version information"))
       .add(make_option("audit", all.audit).short_name("a").help("Print weights of features"))
@@ -311,6 +315,10 @@ void parse_diagnostics(options_i& options, VW::workspace& all)
                .help("Progress update frequency. int: additive, float: multiplicative"))
       .add(make_option("dry_run", skip_driver)
                .help("Parse arguments and print corresponding metadata. Will not execute driver"))
+      .add(make_option("profile_reductions", profile_file)
+               .experimental()
+               .help("Time the calls of each reduction, the parser and prediction output. A summary is printed at the "
+                     "end and the folded call stacks, for flame graphs, are written to this file"))
       .add(make_option("help", help)
                .short_name("h")
                .help("More information on vowpal wabbit can be found here https://vowpalwabbit.org"));
@@ -327,6 +335,9 @@ void parse_diagnostics(options_i& options, VW::workspace& all)
     all.trace_message = VW::make_unique<std::ostream>(nullptr);
   }
 
+  if (options.was_supplied("profile_reductions"))
+  { all.profiler = VW::make_unique<VW::reduction_profiler>(profile_file); }
+
   // pass all.quiet around
   if (all.all_reduce) { all.all_reduce->quiet = all.quiet; }
 
@@ -385,10 +396,23 @@ input_options parse_source(VW::workspace& all, options_i& options)
       .add(make_option("num_children", all.num_children).help("Number of children for persistent daemon mode"))
       .add(make_option("pid_file", parsed_options.pid_file).help("Write pid file in persistent daemon mode"))
       .add(make_option("port_file", parsed_options.port_file).help("Write port used in persistent daemon mode"))
+      .add(make_option("daemon_server", parsed_options.daemon_server)
+               .default_value("fork")
+               .one_of({"fork", "epoll"})
+               .help("How persistent daemon mode serves connections. Fork serves one connection per child process, "
+                     "epoll serves many concurrent connections from a single process with a shared model and only "
+                     "predicts")
+               .experimental())
       .add(make_option("cache", parsed_options.cache).short_name("c").help("Use a cache.  The default is <data>.cache"))
       .add(make_option("cache_file", parsed_options.cache_files).help("The location(s) of cache_file"))
       .add(make_option("json", parsed_options.json).help("Enable JSON parsing"))
       .add(make_option("dsjson", parsed_options.dsjson).help("Enable Decision Service JSON parsing"))
+      .add(make_option("json_parser", parsed_options.json_parser)
+               .default_value("rapidjson")
+               .one_of({"rapidjson", "simdjson"})
+               .help("Parser used for --json and --dsjson input. simdjson requires VW to be built with "
+                     "VW_BUILD_SIMDJSON and leaves lines using less common parts of the format to rapidjson")
+               .experimental())
       .add(make_option("kill_cache", parsed_options.kill_cache)
                .short_name("k")
                .help("Do not reuse existing cache: create a new one always"))
@@ -407,6 +431,21 @@ input_options parse_source(VW::workspace& all, options_i& options)
                      "hashed as A^B^C."))
       .add(make_option("flatbuffer", parsed_options.flatbuffer)
                .help("Data file will be interpreted as a flatbuffer file")
+               .experimental())
+      .add(make_option("parse_threads", parsed_options.parse_threads)
+               .default_value(1)
+               .help("Number of threads used to parse text or JSON input. Examples are still handed to the learner in "
+                     "input order")
+               .experimental())
+      .add(make_option("mmap_cache", parsed_options.mmap_cache)
+               .help("Memory map cache files and read examples directly from the mapping instead of copying them. "
+                     "Later passes are served from memory")
+               .experimental())
+      .add(make_option("cache_format", parsed_options.cache_format)
+               .default_value("row")
+               .one_of({"row", "block"})
+               .help("Format of newly created cache files. Block caches group examples into compressed blocks "
+                     "with labels, feature indices and feature values in separate streams")
                .experimental());
 #ifdef VW_BUILD_CSV
   parsed_options.csv_opts = VW::make_unique<VW::parsers::csv_parser_options>();
@@ -440,9 +479,22 @@ input_options parse_source(VW::workspace& all, options_i& options)
     all.numpasses = static_cast<size_t>(1e5);
   }
 
+  if (parsed_options.daemon_server == "epoll")
+  {
+    if (!all.daemon) { THROW("--daemon_server epoll requires --daemon") }
+    if (all.active) { THROW("--daemon_server epoll cannot be used with active learning") }
+    if (all.training) { THROW("--daemon_server epoll only serves predictions, use -t") }
+    if (!VW::details::epoll_daemon_supported()) { THROW("--daemon_server epoll is not supported on this platform") }
+    all.epoll_daemon = true;
+    // Every connection is served by the event loop, the parser only ever sees the single empty pass.
+    all.numpasses = 1;
+  }
+
   // Add an implicit cache file based on the data filename.
   if (parsed_options.cache) { parsed_options.cache_files.push_back(all.data_filename + ".cache"); }
 
+  if (parsed_options.parse_threads == 0) { THROW("parse_threads must be at least 1") }
+
   if ((parsed_options.cache || options.was_supplied("cache_file")) && options.was_supplied("invert_hash"))
     THROW("invert_hash is incompatible with a cache file.  Use it in single pass mode only.")
 
@@ -612,6 +664,7 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
   bool noconstant;
   bool leave_duplicate_interactions;
   std::string affix;
+  uint64_t feature_hash_cache_capacity = 0;
 
   option_group_definition feature_options("Feature");
   feature_options
@@ -621,6 +674,10 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
                .one_of({"strings", "all"})
                .help("How to hash the features"))
       .add(make_option("hash_seed", all.hash_seed).keep().default_value(0).help("Seed for hash function"))
+      .add(make_option("feature_hash_cache", feature_hash_cache_capacity)
+               .default_value(0)
+               .help("Memoize the hashes of up to <arg> namespace and feature names, 0 disables the cache")
+               .experimental())
       .add(make_option("ignore", ignores).keep().help("Ignore namespaces beginning with character <arg>"))
       .add(make_option("ignore_linear", ignore_linears)
                .keep()
@@ -684,6 +741,11 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
 
   // feature manipulation
   all.example_parser->hasher = getHasher(hash_function);
+  if (feature_hash_cache_capacity > 0)
+  {
+    all.example_parser->hash_cache = VW::make_unique<VW::details::feature_hash_cache>(
+        all.example_parser->hasher, static_cast<size_t>(feature_hash_cache_capacity));
+  }
 
   if (options.was_supplied("spelling"))
   {
@@ -1079,6 +1141,8 @@ void parse_example_tweaks(options_i& options, VW::workspace& all)
   uint64_t numpasses;
   int64_t pass_length;
   int64_t max_examples;
+  float min_prediction = all.sd->min_label;
+  float max_prediction = all.sd->max_label;
 
   option_group_definition example_options("Example");
   example_options.add(make_option("testonly", test_only).short_name("t").help("Ignore label information and just test"))
@@ -1096,8 +1160,8 @@ void parse_example_tweaks(options_i& options, VW::workspace& all)
                .default_value(-1)
                .help("Initial number of examples per pass. -1 for no limit"))
       .add(make_option("examples", max_examples).default_value(-1).help("Number of examples to parse. -1 for no limit"))
-      .add(make_option("min_prediction", all.sd->min_label).help("Smallest prediction to output"))
-      .add(make_option("max_prediction", all.sd->max_label).help("Largest prediction to output"))
+      .add(make_option("min_prediction", min_prediction).help("Smallest prediction to output"))
+      .add(make_option("max_prediction", max_prediction).help("Largest prediction to output"))
       .add(make_option("sort_features", all.example_parser->sort_features)
                .help("Turn this on to disregard order in which features have been defined. This will lead to smaller "
                      "cache sizes"))
@@ -1125,6 +1189,8 @@ void parse_example_tweaks(options_i& options, VW::workspace& all)
                      "labels, comma-sep, eg \"--named_labels Noun,Verb,Adj,Punc\""));
   options.add_and_parse(example_options);
 
+  all.sd->min_label = min_prediction;
+  all.sd->max_label = max_prediction;
   all.numpasses = VW::cast_to_smaller_type<size_t>(numpasses);
   if (pass_length < -1) { THROW("pass_length must be -1 or positive"); }
 
@@ -1314,6 +1380,11 @@ void parse_output_model(options_i& options, VW::workspace& all)
 {
   bool predict_only_model = false;
   bool save_resume = false;
+  bool async_checkpoint = false;
+  uint64_t checkpoint_every_examples = 0;
+  float checkpoint_every_seconds = 0.f;
+  bool checkpoint_deltas = false;
+  uint32_t delta_block_bits = 10;
 
   option_group_definition output_model_options("Output Model");
   output_model_options
@@ -1342,6 +1413,32 @@ void parse_output_model(options_i& options, VW::workspace& all)
                .help("Prevent the default behavior of resetting counters when loading a model. Has no effect when "
                      "writing a model."))
       .add(make_option("save_per_pass", all.save_per_pass).help("Save the model after every pass over data"))
+      .add(make_option("async_checkpoint", async_checkpoint)
+               .experimental()
+               .help("Write the models saved by --save_per_pass and periodic checkpoints on a background thread. "
+                     "Learning only pauses to copy the model into memory"))
+      .add(make_option("checkpoint_every_examples", checkpoint_every_examples)
+               .experimental()
+               .help("Save the model to the final regressor after every n learned examples"))
+      .add(make_option("checkpoint_every_seconds", checkpoint_every_seconds)
+               .experimental()
+               .help("Save the model to the final regressor when at least this many seconds passed since the last "
+                     "checkpoint"))
+      .add(make_option("checkpoint_deltas", checkpoint_deltas)
+               .experimental()
+               .help("Save periodic checkpoints to <final regressor>.0, .1, ... where .0 is a full model and every "
+                     "later file only holds the weight blocks changed since the previous one. Requires dense weights "
+                     "and the gd base learner. Load the chain with -i <f>.0 --initial_deltas <f>.1 ..."))
+      .add(make_option("delta_block_bits", delta_block_bits)
+               .default_value(10)
+               .experimental()
+               .help("Log2 of the number of weight rows tracked together for --checkpoint_deltas"))
+      .add(make_option("page_aligned_weights", all.page_aligned_weights)
+               .experimental()
+               .help("Save dense weights as a page aligned array at the end of binary models. Predict only runs (-t) "
+                     "map the array from the file instead of parsing it, so startup does not depend on model size "
+                     "and processes serving the same model share its memory. Older versions can not read these "
+                     "models"))
       .add(make_option("output_feature_regularizer_binary", all.per_feature_regularizer_output)
                .help("Per feature regularization output file"))
       .add(make_option("output_feature_regularizer_text", all.per_feature_regularizer_text)
@@ -1361,6 +1458,19 @@ void parse_output_model(options_i& options, VW::workspace& all)
   }
   if (predict_only_model) { all.save_resume = false; }
 
+  if (checkpoint_every_seconds < 0.f) { THROW("--checkpoint_every_seconds must not be negative"); }
+  if ((checkpoint_every_examples > 0 || checkpoint_every_seconds > 0.f) && all.final_regressor_name.empty())
+  { THROW("--checkpoint_every_examples and --checkpoint_every_seconds require a final regressor (-f)"); }
+  if (checkpoint_deltas && checkpoint_every_examples == 0 && checkpoint_every_seconds == 0.f)
+  { THROW("--checkpoint_deltas requires --checkpoint_every_examples or --checkpoint_every_seconds"); }
+  if (delta_block_bits > 62) { THROW("--delta_block_bits must be at most 62"); }
+  if (async_checkpoint || checkpoint_every_examples > 0 || checkpoint_every_seconds > 0.f)
+  {
+    all.checkpointer = VW::make_unique<VW::details::model_checkpointer>(
+        all.final_regressor_name, checkpoint_every_examples, checkpoint_every_seconds, async_checkpoint);
+    if (checkpoint_deltas) { all.checkpointer->enable_deltas(delta_block_bits); }
+  }
+
   if ((options.was_supplied("invert_hash") || options.was_supplied("readable_model")) && all.save_resume)
   {
     all.logger.err_info(
@@ -1498,12 +1608,19 @@ std::unique_ptr<VW::workspace> parse_args(std::unique_ptr<options_i, options_del
   bool strict_parse = false;
   int ring_size_tmp;
   int64_t example_queue_limit_tmp;
+  std::string example_queue_type;
   option_group_definition vw_args("Parser");
   vw_args.add(make_option("ring_size", ring_size_tmp).default_value(256).help("Size of example ring"))
       .add(make_option("example_queue_limit", example_queue_limit_tmp)
                .default_value(256)
                .help("Max number of examples to store after parsing but before the learner has processed. Rarely "
                      "needs to be changed."))
+      .add(make_option("example_queue_type", example_queue_type)
+               .default_value("locked")
+               .one_of({"locked", "spsc"})
+               .help("Queue between the parser and learner threads. 'spsc' uses a lock-free single producer/single "
+                     "consumer ring and reports queue occupancy through --extra_metrics")
+               .experimental())
       .add(make_option("strict_parse", strict_parse).help("Throw on malformed examples"));
   all->options->add_and_parse(vw_args);
 
@@ -1523,12 +1640,18 @@ std::unique_ptr<VW::workspace> parse_args(std::unique_ptr<options_i, options_del
     }
   }
 
-  all->example_parser = new parser{final_example_queue_limit, strict_parse};
+  auto example_queue_mode = example_queue_type == "spsc" ? VW::queue_mode::spsc : VW::queue_mode::locked;
+  all->example_parser = new parser{final_example_queue_limit, strict_parse, example_queue_mode};
   all->example_parser->_shared_data = all->sd;
 
+  std::string weight_huge_pages;
+  std::string weight_numa_policy;
   option_group_definition weight_args("Weight");
   weight_args
       .add(make_option("initial_regressor", all->initial_regressors).help("Initial regressor(s)").short_name("i"))
+      .add(make_option("initial_deltas", all->initial_deltas)
+               .help("Delta snapshots saved by --checkpoint_deltas to apply in order over the initial regressor")
+               .experimental())
       .add(make_option("initial_weight", all->initial_weight)
                .default_value(0.f)
                .help("Set all weights to an initial value of arg"))
@@ -1537,8 +1660,22 @@ std::unique_ptr<VW::workspace> parse_args(std::unique_ptr<options_i, options_del
       .add(make_option("truncated_normal_weights", all->tnormal_weights).help("Make initial weights truncated normal"))
       .add(make_option("sparse_weights", all->weights.sparse).help("Use a sparse datastructure for weights"))
       .add(make_option("input_feature_regularizer", all->per_feature_regularizer_input)
-               .help("Per feature regularization input file"));
+               .help("Per feature regularization input file"))
+      .add(make_option("weight_huge_pages", weight_huge_pages)
+               .default_value("off")
+               .one_of({"off", "transparent", "hugetlb"})
+               .help("Back the dense weight array with huge pages. hugetlb uses the reserved huge page pool and falls "
+                     "back to transparent huge pages if it is exhausted")
+               .experimental())
+      .add(make_option("weight_numa_policy", weight_numa_policy)
+               .default_value("off")
+               .one_of({"off", "interleave", "first_touch"})
+               .help("Placement of the dense weight array across NUMA nodes. interleave spreads pages over all nodes, "
+                     "first_touch leaves pages untouched until the first thread writes them")
+               .experimental());
   all->options->add_and_parse(weight_args);
+  all->weights.dense_allocation.huge_pages = VW::huge_page_policy_from_string(weight_huge_pages);
+  all->weights.dense_allocation.numa = VW::numa_policy_from_string(weight_numa_policy);
 
   std::string span_server_arg;
   int32_t span_server_port_arg;
@@ -1555,9 +1692,18 @@ std::unique_ptr<VW::workspace> parse_args(std::unique_ptr<options_i, options_del
       .add(make_option("node", node_arg).default_value(0).help("Node number in cluster parallel job"))
       .add(make_option("span_server_port", span_server_port_arg)
                .default_value(26543)
-               .help("Port of the server for setting up spanning tree"));
+               .help("Port of the server for setting up spanning tree"))
+      .add(make_option("learn_threads", all->learn_threads)
+               .default_value(1)
+               .help("Number of threads learning from the parsed examples. The threads share one dense weight array "
+                     "which they update without locking (Hogwild)")
+               .experimental());
   all->options->add_and_parse(parallelization_args);
 
+  if (all->learn_threads == 0) { THROW("learn_threads must be at least 1") }
+  if (all->learn_threads > 1 && all->example_parser->ready_parsed_examples.mode() == VW::queue_mode::spsc)
+  { THROW("--learn_threads can not be used with --example_queue_type spsc, which supports a single consumer") }
+
   // total, unique_id and node must be specified together.
   if ((all->options->was_supplied("total") || all->options->was_supplied("node") ||
           all->options->was_supplied("unique_id")) &&
@@ -1811,6 +1957,31 @@ void free_args(int argc, char* argv[])
   free(argv);
 }
 
+// Learning from several threads is only safe for reductions which keep no per example state outside of the weights.
+void check_learn_threads_supported(VW::workspace& all, const std::vector<std::string>& enabled_reductions)
+{
+  if (all.l->is_multiline()) { THROW("--learn_threads does not support multiline reductions") }
+  if (all.weights.sparse) { THROW("--learn_threads can not be used with --sparse_weights") }
+  // Truncated gradient and l2 shrinkage rescale every weight through shared_data on each update.
+  if (all.l1_lambda > 0.f || all.l2_lambda > 0.f) { THROW("--learn_threads can not be used with --l1 or --l2") }
+  // Without adaptive updates the learning rate decays with the example count, which finish_example advances.
+  if (!all.weights.adaptive) { THROW("--learn_threads requires adaptive updates") }
+  // The report accumulates the error of every prediction in the gd state.
+  if (all.options->was_supplied("quantization_report"))
+  { THROW("--learn_threads can not be used with --quantization_report") }
+  // Marking the weight blocks a thread wrote is not atomic.
+  if (all.checkpointer != nullptr && all.checkpointer->deltas())
+  { THROW("--learn_threads can not be used with --checkpoint_deltas") }
+
+  const std::vector<std::string> supported = {"gd", "scorer", "count_label"};
+  for (const auto& reduction : enabled_reductions)
+  {
+    const auto base_name = reduction.substr(0, reduction.find('-'));
+    if (std::find(supported.begin(), supported.end(), base_name) == supported.end())
+    { THROW("--learn_threads does not support the " << reduction << " reduction") }
+  }
+}
+
 void print_enabled_reductions(VW::workspace& all, std::vector<std::string>& enabled_reductions)
 {
   // output list of enabled reductions
@@ -1861,6 +2032,7 @@ std::unique_ptr<VW::workspace> initialize_internal(std::unique_ptr<options_i, op
     parse_modules(*all->options, *all, interactions_settings_duplicated, dictionary_namespaces);
     instantiate_learner(*all, std::move(learner_builder));
     parse_sources(*all->options, *all, *model, skip_model_load);
+    for (const auto& delta : all->initial_deltas) { VW::load_predictor_delta(*all, delta); }
   }
   catch (VW::save_load_model_exception& e)
   {
@@ -1871,6 +2043,13 @@ std::unique_ptr<VW::workspace> initialize_internal(std::unique_ptr<options_i, op
   if (!all->quiet)
   {
     *(all->trace_message) << "Num weight bits = " << all->num_bits << endl;
+    if (!all->weights.sparse && !all->weights.dense_allocation.is_default())
+    {
+      // The applied policies can be weaker than the requested ones when the system does not support them.
+      const auto& applied = all->weights.dense_weights.allocation();
+      *(all->trace_message) << "Weight allocation = huge pages: " << VW::to_string(applied.huge_pages)
+                            << ", NUMA: " << VW::to_string(applied.numa) << endl;
+    }
     *(all->trace_message) << "learning rate = " << all->eta << endl;
     *(all->trace_message) << "initial_t = " << all->sd->t << endl;
     *(all->trace_message) << "power_t = " << all->power_t << endl;
@@ -1886,6 +2065,14 @@ std::unique_ptr<VW::workspace> initialize_internal(std::unique_ptr<options_i, op
 
   std::vector<std::string> enabled_reductions;
   if (all->l != nullptr) { all->l->get_enabled_reductions(enabled_reductions); }
+  if (all->l != nullptr && all->profiler != nullptr) { all->l->set_profiler(*all->profiler); }
+  if (all->checkpointer != nullptr && all->checkpointer->deltas())
+  {
+    // Only gd marks the weight blocks it writes.
+    if (all->weights.sparse || enabled_reductions.empty() || enabled_reductions.front() != "gd")
+    { THROW("--checkpoint_deltas requires dense weights and the gd base learner"); }
+    all->weights.dense_weights.enable_dirty_tracking(all->checkpointer->delta_block_bits());
+  }
 
   // upon direct query for help -- spit it out to stdout;
   if (all->options->get_typed_option<bool>("help").value())
@@ -1918,6 +2105,8 @@ std::unique_ptr<VW::workspace> initialize_internal(std::unique_ptr<options_i, op
     std::exit(0);
   }
 
+  if (all->learn_threads > 1) { check_learn_threads_supported(*all, enabled_reductions); }
+
   print_enabled_reductions(*all, enabled_reductions);
 
   if (!all->quiet)
@@ -2049,7 +2238,8 @@ VW::workspace* seed_vw_model(
     {
       // ignore no_stdin since it will be added by vw::initialize, and ignore -i since we don't want to reload the
       // model.
-      if (option->m_name == "no_stdin" || option->m_name == "initial_regressor") { continue; }
+      if (option->m_name == "no_stdin" || option->m_name == "initial_regressor" || option->m_name == "initial_deltas")
+      { continue; }
 
       serializer.add(*option);
     }
@@ -2099,6 +2289,16 @@ void finish(VW::workspace& all, bool delete_all)
   if (!all.quiet && !all.options->was_supplied("audit_regressor"))
   { all.sd->print_summary(*all.trace_message, *all.sd, *all.loss, all.current_pass, all.holdout_set_off); }
 
+  if (!all.quiet && all.example_parser->hash_cache != nullptr)
+  {
+    const auto stats = all.example_parser->hash_cache_stats();
+    const uint64_t lookups = stats.hits + stats.misses + stats.uncacheable;
+    *all.trace_message << "feature hash cache hit rate = "
+                       << (lookups == 0 ? 0. : static_cast<double>(stats.hits) / static_cast<double>(lookups))
+                       << " (" << stats.hits << " hits, " << stats.misses << " misses, " << stats.evictions
+                       << " evictions, " << stats.uncacheable << " uncacheable)" << std::endl;
+  }
+
   finalize_regressor(all, all.final_regressor_name);
   if (all.options->was_supplied("dump_json_weights_experimental"))
   {
@@ -2107,6 +2307,7 @@ void finish(VW::workspace& all, bool delete_all)
     writer->write(content.c_str(), content.length());
   }
   VW::reductions::output_metrics(all);
+  if (all.profiler != nullptr) { all.profiler->report(*all.trace_message); }
   all.logger.log_summary();
 }
 }  // namespace VW
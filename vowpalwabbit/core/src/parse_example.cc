@@ -9,10 +9,12 @@
 #include "vw/common/string_view.h"
 #include "vw/common/text_utils.h"
 #include "vw/core/constant.h"
+#include "vw/core/feature_hash_cache.h"
 #include "vw/core/global_data.h"
 #include "vw/core/parse_primitives.h"
 #include "vw/core/parser.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/text_structural_index.h"
 #include "vw/core/unique_sort.h"
 #include "vw/io/logger.h"
 
@@ -59,6 +61,7 @@ class TC_parser
 {
 public:
   VW::string_view _line;
+  VW::details::structural_scanner _structural;
   size_t _read_idx;
   float _cur_channel_v;
   bool _new_index;
@@ -78,6 +81,7 @@ public:
   uint64_t _parse_mask;
   std::array<std::vector<std::shared_ptr<feature_dict>>, NUM_NAMESPACES>* _namespace_dictionaries;
   VW::io::logger* logger;
+  VW::details::feature_hash_cache* _hash_cache;
 
   ~TC_parser() {}
 
@@ -107,6 +111,12 @@ public:
     }
   }
 
+  inline FORCE_INLINE uint64_t hash_name(VW::string_view name, uint64_t seed)
+  {
+    return _hash_cache != nullptr ? _hash_cache->hash(name.data(), name.length(), seed)
+                                  : _p->hasher(name.data(), name.length(), seed);
+  }
+
   inline FORCE_INLINE VW::string_view stringFeatureValue(VW::string_view sv)
   {
     size_t start_idx = sv.find_first_not_of(" \t\r\n");
@@ -161,9 +171,7 @@ public:
   inline FORCE_INLINE VW::string_view read_name()
   {
     size_t name_start = _read_idx;
-    while (!(_read_idx >= _line.size() || _line[_read_idx] == ' ' || _line[_read_idx] == ':' ||
-        _line[_read_idx] == '\t' || _line[_read_idx] == '|' || _line[_read_idx] == '\r'))
-    { ++_read_idx; }
+    _read_idx = _structural.next(_read_idx);
 
     return _line.substr(name_start, _read_idx - name_start);
   }
@@ -199,14 +207,12 @@ public:
       if (!string_feature_value.empty())
       {
         // chain hash is hash(feature_value, hash(feature_name, namespace_hash)) & parse_mask
-        word_hash = (_p->hasher(string_feature_value.data(), string_feature_value.length(),
-                         _p->hasher(feature_name.data(), feature_name.length(), _channel_hash)) &
-            _parse_mask);
+        word_hash = (hash_name(string_feature_value, hash_name(feature_name, _channel_hash)) & _parse_mask);
       }
       // Case where string:float
       else if (!feature_name.empty())
       {
-        word_hash = (_p->hasher(feature_name.data(), feature_name.length(), _channel_hash) & _parse_mask);
+        word_hash = (hash_name(feature_name, _channel_hash) & _parse_mask);
       }
       // Case where :float
       else
@@ -408,7 +414,7 @@ public:
       if (_ae->feature_space[_index].size() == 0) { _new_index = true; }
       VW::string_view name = read_name();
       if (audit) { _base = name; }
-      _channel_hash = _p->hasher(name.data(), name.length(), this->_hash_seed);
+      _channel_hash = hash_name(name, this->_hash_seed);
       nameSpaceInfoValue();
     }
   }
@@ -489,7 +495,8 @@ public:
     }
   }
 
-  TC_parser(VW::string_view line, VW::workspace& all, VW::example* ae) : _line(line)
+  TC_parser(VW::string_view line, VW::workspace& all, VW::example* ae, VW::details::feature_hash_cache* hash_cache)
+      : _line(line), _structural(line), _hash_cache(hash_cache)
   {
     if (!_line.empty())
     {
@@ -514,6 +521,14 @@ public:
 };
 
 void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example)
+{
+  substring_to_example(all, ae, example, all->example_parser->words, all->example_parser->parser_memory_to_reuse,
+      all->example_parser->hash_cache.get());
+}
+
+void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example,
+    std::vector<VW::string_view>& words, VW::label_parser_reuse_mem& reuse_mem,
+    VW::details::feature_hash_cache* hash_cache)
 {
   if (example.empty()) { ae->is_newline = true; }
 
@@ -521,7 +536,7 @@ void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view e
 
   size_t bar_idx = example.find('|');
 
-  all->example_parser->words.clear();
+  words.clear();
   if (bar_idx != 0)
   {
     VW::string_view label_space(example);
@@ -534,31 +549,30 @@ void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view e
     size_t tab_idx = label_space.find('\t');
     if (tab_idx != VW::string_view::npos) { label_space.remove_prefix(tab_idx + 1); }
 
-    VW::tokenize(' ', label_space, all->example_parser->words);
-    if (all->example_parser->words.size() > 0 &&
-        ((all->example_parser->words.back().data() + all->example_parser->words.back().size()) ==
-                (label_space.data() + label_space.size()) ||
-            all->example_parser->words.back().front() == '\''))  // The last field is a tag, so record and strip it off
+    VW::tokenize(' ', label_space, words);
+    if (words.size() > 0 &&
+        ((words.back().data() + words.back().size()) == (label_space.data() + label_space.size()) ||
+            words.back().front() == '\''))  // The last field is a tag, so record and strip it off
     {
-      VW::string_view tag = all->example_parser->words.back();
-      all->example_parser->words.pop_back();
+      VW::string_view tag = words.back();
+      words.pop_back();
       if (tag.front() == '\'') { tag.remove_prefix(1); }
       ae->tag.insert(ae->tag.end(), tag.begin(), tag.end());
     }
   }
 
-  if (!all->example_parser->words.empty())
+  if (!words.empty())
   {
-    all->example_parser->lbl_parser.parse_label(ae->l, ae->_reduction_features,
-        all->example_parser->parser_memory_to_reuse, all->sd->ldict.get(), all->example_parser->words, all->logger);
+    all->example_parser->lbl_parser.parse_label(
+        ae->l, ae->_reduction_features, reuse_mem, all->sd->ldict.get(), words, all->logger);
   }
 
   if (bar_idx != VW::string_view::npos)
   {
-    if (all->audit || all->hash_inv) { TC_parser<true> parser_line(example.substr(bar_idx), *all, ae); }
+    if (all->audit || all->hash_inv) { TC_parser<true> parser_line(example.substr(bar_idx), *all, ae, hash_cache); }
     else
     {
-      TC_parser<false> parser_line(example.substr(bar_idx), *all, ae);
+      TC_parser<false> parser_line(example.substr(bar_idx), *all, ae, hash_cache);
     }
   }
 }
@@ -0,0 +1,773 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/parse_example_simdjson.h"
+
+#include "vw/core/example.h"
+#include "vw/core/parse_example_json.h"
+#include "vw/core/vw.h"
+
+#include <simdjson.h>
+
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace od = simdjson::ondemand;
+
+namespace
+{
+// A number as rapidjson reports it. Non negative integers which fit in 32 bits are Uint events, and every state which
+// accepts them as floats uses the float conversion of the integer.
+struct json_number
+{
+  float value;
+  bool is_uint;
+  unsigned uint_value;
+};
+
+bool read_number(od::value& v, json_number& out)
+{
+  od::number number;
+  if (v.get_number().get(number) != simdjson::SUCCESS) { return false; }
+  switch (number.get_number_type())
+  {
+    case od::number_type::signed_integer:
+    {
+      const int64_t i = number.get_int64();
+      out.value = static_cast<float>(i);
+      out.is_uint = i >= 0 && i <= static_cast<int64_t>(std::numeric_limits<unsigned>::max());
+      out.uint_value = static_cast<unsigned>(i);
+      return true;
+    }
+    case od::number_type::unsigned_integer:
+      out.value = static_cast<float>(number.get_uint64());
+      out.is_uint = false;
+      return true;
+    case od::number_type::floating_point_number:
+      out.value = static_cast<float>(number.get_double());
+      out.is_uint = false;
+      return true;
+    default:
+      // rapidjson reads integers beyond 64 bits as doubles, leave them to it.
+      return false;
+  }
+}
+
+bool read_string(od::value& v, VW::string_view& out)
+{
+  std::string_view str;
+  if (v.get_string().get(str) != simdjson::SUCCESS) { return false; }
+  out = VW::string_view(str.data(), str.size());
+  return true;
+}
+
+bool is_json_space(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+// Consumes a null, which is validated unlike a skipped value.
+bool read_null(od::value& v)
+{
+  bool is_null = false;
+  return v.is_null().get(is_null) == simdjson::SUCCESS && is_null;
+}
+
+// Matches _stricmp(str, "NaN") == 0 on the null terminated string rapidjson hands out.
+bool is_nan_string(VW::string_view str)
+{
+  return str.size() >= 3 && (str[0] == 'N' || str[0] == 'n') && (str[1] == 'A' || str[1] == 'a') &&
+      (str[2] == 'N' || str[2] == 'n') && (str.size() == 3 || str[3] == '\0');
+}
+
+// Drives the states of a rapidjson Context from a simdjson document. Each method mirrors the events rapidjson would
+// send for a value and returns false for anything outside the handled subset, in which case the line is parsed again
+// with rapidjson.
+template <bool audit>
+class line_walker
+{
+public:
+  line_walker(Context<audit>& ctx, std::vector<char>& key_arena, std::string& scratch, const char* line_end)
+      : _ctx(ctx), _key_arena(key_arena), _scratch(scratch), _line_end(line_end)
+  {
+  }
+
+  bool example_root(od::document& doc)
+  {
+    od::object obj;
+    if (doc.get_object().get(obj) != simdjson::SUCCESS) { return false; }
+    _ctx.default_state.StartObject(_ctx);
+    return object_body(obj) && _ctx.default_state.EndObject(_ctx, 0) != nullptr;
+  }
+
+  bool decision_service_root(od::document& doc, DecisionServiceInteraction& data)
+  {
+    od::object obj;
+    if (doc.get_object().get(obj) != simdjson::SUCCESS) { return false; }
+    for (auto field_result : obj)
+    {
+      od::field field;
+      const char* key;
+      size_t length;
+      if (std::move(field_result).get(field) != simdjson::SUCCESS || !store_key(field, key, length)) { return false; }
+      if (!decision_service_field(key, length, field, data)) { return false; }
+    }
+    return true;
+  }
+
+private:
+  // Keys are copied with a null terminator into the arena, which is never reallocated while a line is parsed since
+  // namespaces keep pointers to their names.
+  bool store_key(od::field& field, const char*& key, size_t& length)
+  {
+    std::string_view str;
+    if (field.unescaped_key().get(str) != simdjson::SUCCESS) { return false; }
+    if (_key_offset + str.size() + 1 > _key_arena.size() || std::memchr(str.data(), '\0', str.size()) != nullptr)
+    { return false; }
+
+    char* dest = _key_arena.data() + _key_offset;
+    std::memcpy(dest, str.data(), str.size());
+    dest[str.size()] = '\0';
+    _key_offset += str.size() + 1;
+
+    key = dest;
+    length = str.size();
+    return true;
+  }
+
+  void set_key(const char* key, size_t length)
+  {
+    _ctx.key = key;
+    _ctx.key_length = static_cast<rapidjson::SizeType>(length);
+  }
+
+  // A null terminated copy of a string value.
+  char* terminated_copy(VW::string_view str)
+  {
+    _scratch.assign(str.data(), str.size());
+    return &_scratch[0];
+  }
+
+  bool object_body(od::object& obj)
+  {
+    for (auto field_result : obj)
+    {
+      od::field field;
+      const char* key;
+      size_t length;
+      if (std::move(field_result).get(field) != simdjson::SUCCESS || !store_key(field, key, length)) { return false; }
+      set_key(key, length);
+      const bool handled =
+          length > 0 && key[0] == '_' ? special_field(key, length, field) : feature_value(field.value());
+      if (!handled) { return false; }
+    }
+    return true;
+  }
+
+  // DefaultState handling of a value whose key is in ctx.key.
+  bool feature_value(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    switch (type)
+    {
+      case od::json_type::object:
+      {
+        od::object obj;
+        if (v.get_object().get(obj) != simdjson::SUCCESS) { return false; }
+        _ctx.default_state.StartObject(_ctx);
+        return object_body(obj) && _ctx.default_state.EndObject(_ctx, 0) != nullptr;
+      }
+      case od::json_type::array:
+        return feature_array(v);
+      case od::json_type::string:
+        return string_feature(v);
+      case od::json_type::number:
+      {
+        json_number number;
+        if (!read_number(v, number)) { return false; }
+        _ctx.default_state.Float(_ctx, number.value);
+        return true;
+      }
+      case od::json_type::boolean:
+      {
+        bool b;
+        if (v.get_bool().get(b) != simdjson::SUCCESS) { return false; }
+        _ctx.default_state.Bool(_ctx, b);
+        return true;
+      }
+      default:
+        return read_null(v);
+    }
+  }
+
+  bool string_feature(od::value& v)
+  {
+    VW::string_view str;
+    if (!read_string(v, str) || std::memchr(str.data(), '\0', str.size()) != nullptr) { return false; }
+
+    // DefaultState::String escapes the value in place and, without --chain_hash, moves the key in front of it. Lay out
+    // "key\0", room for the key and "value\0" so that works on the copy as it does on the rapidjson buffer.
+    const char* key = _ctx.key;
+    const size_t key_length = _ctx.key_length;
+    _scratch.resize(2 * key_length + str.size() + 2);
+    char* buffer = &_scratch[0];
+    std::memcpy(buffer, key, key_length);
+    buffer[key_length] = '\0';
+    char* value = buffer + 2 * key_length + 1;
+    std::memcpy(value, str.data(), str.size());
+    value[str.size()] = '\0';
+
+    _ctx.key = buffer;
+    _ctx.default_state.String(_ctx, value, static_cast<rapidjson::SizeType>(str.size()), false);
+    _ctx.key = key;
+    return true;
+  }
+
+  // ArrayState, elements are numbers or objects in the namespace of the array.
+  bool feature_array(od::value& v)
+  {
+    od::array arr;
+    if (v.get_array().get(arr) != simdjson::SUCCESS) { return false; }
+    _ctx.previous_state = &_ctx.default_state;
+    _ctx.array_state.StartArray(_ctx);
+    for (auto element_result : arr)
+    {
+      od::value element;
+      od::json_type type;
+      if (element_result.get(element) != simdjson::SUCCESS || element.type().get(type) != simdjson::SUCCESS)
+      { return false; }
+      if (type == od::json_type::number)
+      {
+        json_number number;
+        if (!read_number(element, number)) { return false; }
+        _ctx.array_state.Float(_ctx, number.value);
+      }
+      else if (type == od::json_type::object)
+      {
+        od::object obj;
+        if (element.get_object().get(obj) != simdjson::SUCCESS) { return false; }
+        _ctx.array_state.StartObject(_ctx);
+        if (!object_body(obj) || _ctx.default_state.EndObject(_ctx, 0) == nullptr) { return false; }
+      }
+      else if (type != od::json_type::null || !read_null(element))
+      {
+        return false;
+      }
+    }
+    _ctx.array_state.EndArray(_ctx, 0);
+    return true;
+  }
+
+  // DefaultState::Key for keys starting with '_'.
+  bool special_field(const char* key, size_t length, od::field& field)
+  {
+    od::value& v = field.value();
+    if (length >= 6 && !strncmp(key, "_label", 6))
+    {
+      if (length >= 7 && key[6] == '_')
+      {
+        // Continuous action labels are left to rapidjson.
+        if (length >= 9 && !strncmp(&key[7], "ca", 2)) { return false; }
+        return label_property(v);
+      }
+      if (length == 6) { return label(v); }
+      if (length == 11 && !_stricmp(key, "_labelIndex")) { return label_index(v); }
+      return false;
+    }
+    if (length == 5 && !strcmp(key, "_text")) { return text(v); }
+    if (length == 6 && !strcmp(key, "_multi")) { return multi(v); }
+    if (length == 6 && !strcmp(key, "_slots")) { return slots(v); }
+    if (length == 4 && !_stricmp(key, "_tag")) { return tag(v); }
+    if (length == 4 && !_stricmp(key, "_inc")) { return to_vector(v, _ctx.label_object_state.inc); }
+    if (length == 2 && key[1] == 'a') { return to_vector(v, _ctx.label_object_state.actions); }
+    if (length == 2 && key[1] == 'p')
+    {
+      // rapidjson rewrites "_p" in the top level decision service context as a 0, leave that to it.
+      if (_ctx.root_state == &_ctx.decision_service_state) { return false; }
+      return to_vector(v, _ctx.label_object_state.probs);
+    }
+    if (length == 8 && !strncmp(key, "_slot_id", 8)) { return false; }
+    if (length == 20 && !strncmp(key, "_original_label_cost", 20))
+    {
+      if (_ctx.decision_service_data == nullptr) { return false; }
+      return original_label_cost(v, *_ctx.decision_service_data);
+    }
+    if (length == 5 && !_stricmp(key, "__aid")) { return false; }
+
+    // Any other key starting with '_' is ignored.
+    return ignored_field(field);
+  }
+
+  // DefaultState::Ignore skips the value of an ignored key by scanning the line for the ',', '}' or ']' which ends it,
+  // and needs the ':' right after the key. The field is only skipped here if that scan ends at the same place, lines on
+  // which the two disagree are left to rapidjson so both accept the same input.
+  bool ignored_field(od::field& field)
+  {
+    // The scan is placed using the length of the unescaped key, which is only right for keys without escapes.
+    const std::string_view key = field.key_raw_json_token();
+    if (key.back() != '"' || std::memchr(key.data(), '\\', key.size()) != nullptr) { return false; }
+    const char* colon = key.data() + key.size();
+    if (colon >= _line_end || *colon != ':') { return false; }
+
+    std::string_view value;
+    if (field.value().raw_json().get(value) != simdjson::SUCCESS) { return false; }
+    const char* value_end = value.data() + value.size();
+    while (value_end < _line_end && is_json_space(*value_end)) { value_end++; }
+    return ignore_scan_end(colon + 1) == value_end;
+  }
+
+  // Where the scan of DefaultState::Ignore starting at head stops, or nullptr where it reports an error.
+  const char* ignore_scan_end(const char* head) const
+  {
+    int depth = 0;
+    int sq_depth = 0;
+    for (; head < _line_end && *head != '\0'; head++)
+    {
+      switch (*head)
+      {
+        case '"':
+          for (head++; head < _line_end && *head != '"'; head++)
+          {
+            if (*head == '\0') { return nullptr; }
+            if (*head == '\\') { head++; }
+          }
+          if (head >= _line_end) { return nullptr; }
+          break;
+        case '{':
+          depth++;
+          break;
+        case '[':
+          sq_depth++;
+          break;
+        case '}':
+        case ']':
+          if (depth == 0 && sq_depth == 0) { return head; }
+          // The scan does not tell the brackets apart.
+          if (*head == '}') { depth--; }
+          else
+          {
+            sq_depth--;
+          }
+          break;
+        case ',':
+          if (depth == 0 && sq_depth == 0) { return head; }
+          break;
+      }
+    }
+    return nullptr;
+  }
+
+  // LabelSinglePropertyState, "_label_<property>": value
+  bool label_property(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::number)
+    {
+      json_number number;
+      return read_number(v, number) && _ctx.label_single_property_state.Float(_ctx, number.value) != nullptr;
+    }
+    if (type == od::json_type::string)
+    {
+      VW::string_view str;
+      if (!read_string(v, str)) { return false; }
+      return _ctx.label_single_property_state.String(
+                 _ctx, terminated_copy(str), static_cast<rapidjson::SizeType>(str.size()), false) != nullptr;
+    }
+    return type == od::json_type::null && read_null(v);
+  }
+
+  // LabelState, "_label": value
+  bool label(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    switch (type)
+    {
+      case od::json_type::number:
+      {
+        json_number number;
+        if (!read_number(v, number)) { return false; }
+        _ctx.label_state.Float(_ctx, number.value);
+        return true;
+      }
+      case od::json_type::string:
+      {
+        VW::string_view str;
+        if (!read_string(v, str)) { return false; }
+        _ctx.label_state.String(_ctx, terminated_copy(str), static_cast<rapidjson::SizeType>(str.size()), false);
+        return true;
+      }
+      case od::json_type::object:
+        return label_object(v);
+      case od::json_type::null:
+        return read_null(v);
+      default:
+        return false;
+    }
+  }
+
+  // LabelObjectState, "_label": { ... }
+  bool label_object(od::value& v)
+  {
+    od::object obj;
+    if (v.get_object().get(obj) != simdjson::SUCCESS) { return false; }
+    _ctx.previous_state = &_ctx.label_state;
+    _ctx.label_object_state.StartObject(_ctx);
+    for (auto field_result : obj)
+    {
+      od::field field;
+      const char* key;
+      size_t length;
+      od::json_type type;
+      if (std::move(field_result).get(field) != simdjson::SUCCESS || !store_key(field, key, length)) { return false; }
+      set_key(key, length);
+      od::value& property = field.value();
+      if (property.type().get(type) != simdjson::SUCCESS) { return false; }
+      if (type == od::json_type::number)
+      {
+        json_number number;
+        if (!read_number(property, number) || _ctx.label_object_state.Float(_ctx, number.value) == nullptr)
+        { return false; }
+      }
+      else if (type == od::json_type::string)
+      {
+        VW::string_view str;
+        if (!read_string(property, str) ||
+            _ctx.label_object_state.String(
+                _ctx, terminated_copy(str), static_cast<rapidjson::SizeType>(str.size()), false) == nullptr)
+        { return false; }
+      }
+      else if (type != od::json_type::null || !read_null(property))
+      {
+        return false;
+      }
+    }
+    _ctx.label_object_state.EndObject(_ctx, 0);
+    return true;
+  }
+
+  // LabelIndexState, only an unsigned integer is accepted.
+  bool label_index(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::null) { return read_null(v); }
+    json_number number;
+    if (type != od::json_type::number || !read_number(v, number) || !number.is_uint) { return false; }
+    _ctx.label_index_state.Uint(_ctx, number.uint_value);
+    return true;
+  }
+
+  // TextState, "_text": "a b c"
+  bool text(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::null) { return read_null(v); }
+    VW::string_view str;
+    if (type != od::json_type::string || !read_string(v, str)) { return false; }
+    _ctx.text_state.String(_ctx, terminated_copy(str), static_cast<rapidjson::SizeType>(str.size()), false);
+    return true;
+  }
+
+  // TagState, "_tag": "abc"
+  bool tag(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::null) { return read_null(v); }
+    VW::string_view str;
+    if (type != od::json_type::string || !read_string(v, str)) { return false; }
+    _ctx.tag_state.String(_ctx, str.data(), static_cast<rapidjson::SizeType>(str.size()), false);
+    return true;
+  }
+
+  // Arrays of example objects. start_object allocates the example and pushes its default namespace.
+  template <typename StartObject>
+  bool example_array(od::value& v, StartObject start_object)
+  {
+    od::array arr;
+    if (v.get_array().get(arr) != simdjson::SUCCESS) { return false; }
+    for (auto element_result : arr)
+    {
+      od::value element;
+      od::object obj;
+      if (element_result.get(element) != simdjson::SUCCESS || element.get_object().get(obj) != simdjson::SUCCESS)
+      { return false; }
+      start_object();
+      if (!object_body(obj) || _ctx.default_state.EndObject(_ctx, 0) == nullptr) { return false; }
+    }
+    return true;
+  }
+
+  // MultiState, "_multi": [ {...}, ... ]
+  bool multi(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::null) { return read_null(v); }
+    if (type != od::json_type::array) { return false; }
+
+    _ctx.multi_state.StartArray(_ctx);
+    Context<audit>& ctx = _ctx;
+    if (!example_array(v, [&ctx]() { ctx.multi_state.StartObject(ctx); })) { return false; }
+    _ctx.multi_state.EndArray(_ctx, 0);
+    return true;
+  }
+
+  // SlotsState, "_slots": [ {...}, ... ]
+  bool slots(od::value& v)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::null) { return read_null(v); }
+    if (type != od::json_type::array) { return false; }
+
+    _ctx.slots_state.StartArray(_ctx);
+    Context<audit>& ctx = _ctx;
+    if (!example_array(v, [&ctx]() { ctx.slots_state.StartObject(ctx); })) { return false; }
+    _ctx.slots_state.EndArray(_ctx, 0);
+    return true;
+  }
+
+  // SlotOutcomeList, "_outcomes": [ {...}, ... ]
+  bool outcomes(od::value& v, DecisionServiceInteraction& data)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::null) { return read_null(v); }
+    if (type != od::json_type::array) { return false; }
+
+    _ctx.slot_outcome_list_state.interactions = &data;
+    _ctx.slot_outcome_list_state.StartArray(_ctx);
+    Context<audit>& ctx = _ctx;
+    if (!example_array(v, [&ctx]() { ctx.slot_outcome_list_state.StartObject(ctx); })) { return false; }
+    _ctx.slot_outcome_list_state.EndArray(_ctx, 0);
+    return true;
+  }
+
+  // ArrayToVectorState, an array or a single value.
+  template <typename T>
+  bool to_vector_element(od::value& v, od::json_type type, std::vector<T>& output)
+  {
+    switch (type)
+    {
+      case od::json_type::number:
+      {
+        json_number number;
+        if (!read_number(v, number)) { return false; }
+        output.push_back(number.is_uint ? static_cast<T>(number.uint_value) : static_cast<T>(number.value));
+        return true;
+      }
+      case od::json_type::string:
+      {
+        VW::string_view str;
+        if (!read_string(v, str) || !is_nan_string(str)) { return false; }
+        output.push_back(std::numeric_limits<T>::quiet_NaN());
+        return true;
+      }
+      case od::json_type::null:
+        return read_null(v);
+      default:
+        return false;
+    }
+  }
+
+  template <typename T>
+  bool to_vector(od::value& v, std::vector<T>& output)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type != od::json_type::array) { return to_vector_element(v, type, output); }
+
+    od::array arr;
+    if (v.get_array().get(arr) != simdjson::SUCCESS) { return false; }
+    for (auto element_result : arr)
+    {
+      od::value element;
+      od::json_type element_type;
+      if (element_result.get(element) != simdjson::SUCCESS || element.type().get(element_type) != simdjson::SUCCESS ||
+          !to_vector_element(element, element_type, output))
+      { return false; }
+    }
+    return true;
+  }
+
+  // FloatToFloatState_OriginalLabelCostHack
+  bool original_label_cost(od::value& v, DecisionServiceInteraction& data)
+  {
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+    if (type == od::json_type::null) { return read_null(v); }
+    json_number number;
+    if (type != od::json_type::number || !read_number(v, number)) { return false; }
+    _ctx.original_label_cost_state.aggr_float = &data.originalLabelCost;
+    _ctx.original_label_cost_state.first_slot_float = &data.originalLabelCostFirstSlot;
+    _ctx.original_label_cost_state.Float(_ctx, number.value);
+    return true;
+  }
+
+  // DecisionServiceState::Key
+  bool decision_service_field(const char* key, size_t length, od::field& field, DecisionServiceInteraction& data)
+  {
+    od::value& v = field.value();
+    od::json_type type;
+    if (v.type().get(type) != simdjson::SUCCESS) { return false; }
+
+    if (length == 1)
+    {
+      switch (key[0])
+      {
+        case 'a':
+          return to_vector(v, data.actions);
+        case 'p':
+          data.probabilities.clear();
+          return to_vector(v, data.probabilities);
+        case 'c':
+          set_key(" ", 1);
+          return feature_value(v);
+        default:
+          return ignored_field(field);
+      }
+    }
+    if (length == 3 && !strcmp(key, "pdf")) { return false; }
+    if (length == 5 && !strcmp(key, "pdrop"))
+    {
+      if (type == od::json_type::null)
+      {
+        data.probabilityOfDrop = 0.f;
+        return read_null(v);
+      }
+      json_number number;
+      if (type != od::json_type::number || !read_number(v, number)) { return false; }
+      data.probabilityOfDrop = number.value;
+      return true;
+    }
+    if ((length == 7 && !strcmp(key, "EventId")) || (length == 9 && !strcmp(key, "Timestamp")))
+    {
+      if (type == od::json_type::null) { return read_null(v); }
+      VW::string_view str;
+      if (type != od::json_type::string || !read_string(v, str)) { return false; }
+      (key[0] == 'E' ? data.eventId : data.timestamp).assign(str.data(), str.size());
+      return true;
+    }
+    if (length > 0 && key[0] == '_')
+    {
+      if (length >= 6 && !strncmp(key, "_label", 6))
+      {
+        set_key(key, length);
+        if (length >= 7 && key[6] == '_')
+        {
+          if (length >= 9 && !strncmp(&key[7], "ca", 2)) { return false; }
+          return label_property(v);
+        }
+        if (length == 6) { return label(v); }
+        if (length == 11 && !_stricmp(key, "_labelIndex")) { return label_index(v); }
+        return ignored_field(field);
+      }
+      if (length == 10 && !strncmp(key, "_skipLearn", 10))
+      {
+        if (type == od::json_type::null) { return read_null(v); }
+        return type == od::json_type::boolean && v.get_bool().get(data.skipLearn) == simdjson::SUCCESS;
+      }
+      if (length == 9 && !strncmp(key, "_outcomes", 9)) { return outcomes(v, data); }
+      if (length == 2 && !strncmp(key, "_p", 2))
+      {
+        data.probabilities.clear();
+        return to_vector(v, data.probabilities);
+      }
+      if (length == 20 && !strncmp(key, "_original_label_cost", 20)) { return original_label_cost(v, data); }
+      if (length == 3 && !strncmp(key, "_ba", 3)) { return to_vector(v, data.baseline_actions); }
+    }
+
+    // Unknown properties are ignored.
+    return ignored_field(field);
+  }
+
+  Context<audit>& _ctx;
+  std::vector<char>& _key_arena;
+  size_t _key_offset = 0;
+  std::string& _scratch;
+  const char* _line_end;
+};
+}  // namespace
+
+namespace VW
+{
+namespace details
+{
+struct simdjson_line_parser::impl
+{
+  od::parser parser;
+  // Copy of the line followed by the padding simdjson reads past the end.
+  std::vector<char> padded_line;
+  std::vector<char> key_arena;
+  std::string scratch;
+  uint64_t fallbacks = 0;
+};
+
+simdjson_line_parser::simdjson_line_parser() : _impl(VW::make_unique<impl>()) {}
+simdjson_line_parser::~simdjson_line_parser() = default;
+
+uint64_t simdjson_line_parser::fallback_count() const { return _impl->fallbacks; }
+
+template <bool audit>
+bool simdjson_line_parser::parse_line(VW::workspace& all, VW::multi_ex& examples, const char* line, size_t length,
+    DecisionServiceInteraction* data)
+{
+  auto& p = *all.example_parser;
+  if (p.lbl_parser.label_type == VW::label_type_t::slates)
+  {
+    _impl->fallbacks++;
+    return false;
+  }
+
+  if (_impl->padded_line.size() < length + simdjson::SIMDJSON_PADDING)
+  { _impl->padded_line.resize(length + simdjson::SIMDJSON_PADDING); }
+  std::memcpy(_impl->padded_line.data(), line, length);
+  // Unescaped keys are never longer than in the line, and each one had at least two quotes to make room for the null.
+  if (_impl->key_arena.size() < length + 1) { _impl->key_arena.resize(length + 1); }
+
+  // Same setup as VWReaderHandler::init and read_line_decision_service_json.
+  Context<audit> ctx;
+  ctx.init(p.lbl_parser, p.hasher, all.hash_seed, all.parse_mask, all.chain_hash_json, &p.parser_memory_to_reuse,
+      all.sd->ldict.get(), &all.logger, p.hash_cache.get());
+  ctx.examples = &examples;
+  ctx.ex = examples[0];
+  p.lbl_parser.default_label(ctx.ex->l);
+  ctx.stream = nullptr;
+  ctx.stream_end = nullptr;
+  ctx.example_factory = reinterpret_cast<VW::example_factory_t>(&VW::get_unused_example);
+  ctx.example_factory_context = &all;
+  ctx.ignore_features = &all.ignore_features_dsjson;
+  if (data != nullptr)
+  {
+    ctx.SetStartStateToDecisionService(data);
+    ctx.decision_service_data = data;
+  }
+
+  od::document doc;
+  line_walker<audit> walker(ctx, _impl->key_arena, _impl->scratch, _impl->padded_line.data() + length);
+  const bool parsed =
+      _impl->parser.iterate(_impl->padded_line.data(), length, _impl->padded_line.size()).get(doc) ==
+          simdjson::SUCCESS &&
+      (data != nullptr ? walker.decision_service_root(doc, *data) : walker.example_root(doc)) && doc.at_end();
+  if (parsed) { return true; }
+
+  // Undo everything so rapidjson starts from the same state.
+  _impl->fallbacks++;
+  VW::return_multiple_example(all, examples);
+  examples.push_back(&VW::get_unused_example(&all));
+  if (data != nullptr) { *data = DecisionServiceInteraction(); }
+  return false;
+}
+
+template bool simdjson_line_parser::parse_line<true>(
+    VW::workspace&, VW::multi_ex&, const char*, size_t, DecisionServiceInteraction*);
+template bool simdjson_line_parser::parse_line<false>(
+    VW::workspace&, VW::multi_ex&, const char*, size_t, DecisionServiceInteraction*);
+}  // namespace details
+}  // namespace VW
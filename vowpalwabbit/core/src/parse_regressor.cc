@@ -19,7 +19,9 @@
 #include "vw/core/global_data.h"
 #include "vw/core/kskip_ngram_transformer.h"
 #include "vw/core/learner.h"
+#include "vw/core/model_checkpoint.h"
 #include "vw/core/rand48.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw_validate.h"
 #include "vw/core/vw_versions.h"
@@ -60,6 +62,17 @@ double calculate_sd(VW::workspace& /* all */, T& weights)
   double sq_sum = inner_product(diff.begin(), diff.end(), diff.begin(), 0.0);
   return std::sqrt(sq_sum / my_size);
 }
+
+void construct_weights(VW::workspace&, sparse_parameters& weights, size_t length, uint32_t stride_shift)
+{
+  new (&weights) sparse_parameters(length, stride_shift);
+}
+
+void construct_weights(VW::workspace& all, dense_parameters& weights, size_t length, uint32_t stride_shift)
+{
+  new (&weights) dense_parameters(length, stride_shift, all.weights.dense_allocation);
+}
+
 template <class T>
 void initialize_regressor(VW::workspace& all, T& weights)
 {
@@ -71,7 +84,7 @@ void initialize_regressor(VW::workspace& all, T& weights)
   {
     uint32_t ss = weights.stride_shift();
     weights.~T();  // dealloc so that we can realloc, now with a known size
-    new (&weights) T(length, ss);
+    construct_weights(all, weights, length, ss);
   }
   catch (const VW::vw_exception&)
   {
@@ -169,13 +182,17 @@ void save_load_header(VW::workspace& all, io_buf& model_file, bool read, bool te
     bytes_read_write += bin_text_read_write_fixed_validated(model_file, &model, 1, read, msg, text);
     if (model != 'm') { THROW("file is not a model file") }
 
-    msg << "Min label:" << all.sd->min_label << "\n";
+    float min_label = all.sd->min_label;
+    msg << "Min label:" << min_label << "\n";
     bytes_read_write += bin_text_read_write_fixed_validated(
-        model_file, reinterpret_cast<char*>(&all.sd->min_label), sizeof(all.sd->min_label), read, msg, text);
+        model_file, reinterpret_cast<char*>(&min_label), sizeof(min_label), read, msg, text);
+    all.sd->min_label = min_label;
 
-    msg << "Max label:" << all.sd->max_label << "\n";
+    float max_label = all.sd->max_label;
+    msg << "Max label:" << max_label << "\n";
     bytes_read_write += bin_text_read_write_fixed_validated(
-        model_file, reinterpret_cast<char*>(&all.sd->max_label), sizeof(all.sd->max_label), read, msg, text);
+        model_file, reinterpret_cast<char*>(&max_label), sizeof(max_label), read, msg, text);
+    all.sd->max_label = max_label;
 
     msg << "bits:" << all.num_bits << "\n";
     uint32_t local_num_bits = all.num_bits;
@@ -492,6 +509,13 @@ void save_predictor(VW::workspace& all, const std::string& reg_name, size_t curr
   dump_regressor(all, filename.str(), false);
 }
 
+void save_pass_checkpoint(VW::workspace& all, const std::string& reg_name, size_t current_pass)
+{
+  if (all.checkpointer == nullptr) { return save_predictor(all, reg_name, current_pass); }
+  if (reg_name.empty()) { return; }
+  all.checkpointer->save(all, reg_name + "." + std::to_string(current_pass), false);
+}
+
 void finalize_regressor(VW::workspace& all, const std::string& reg_name)
 {
   if (!all.early_terminate)
@@ -511,6 +535,7 @@ void finalize_regressor(VW::workspace& all, const std::string& reg_name)
       all.print_invert = false;
     }
   }
+  if (all.checkpointer != nullptr) { all.checkpointer->wait(); }
 }
 
 void read_regressor_file(VW::workspace& all, const std::vector<std::string>& all_intial, io_buf& io_temp)
@@ -576,4 +601,39 @@ namespace VW
 void save_predictor(VW::workspace& all, const std::string& reg_name) { dump_regressor(all, reg_name, false); }
 
 void save_predictor(VW::workspace& all, io_buf& buf) { dump_regressor(all, buf, false); }
+
+void save_predictor_delta(VW::workspace& all, const std::string& reg_name)
+{
+  all.model_delta = true;
+  auto reset_delta = VW::scope_exit([&all] { all.model_delta = false; });
+  dump_regressor(all, reg_name, false);
+}
+
+void save_predictor_delta(VW::workspace& all, io_buf& buf)
+{
+  all.model_delta = true;
+  auto reset_delta = VW::scope_exit([&all] { all.model_delta = false; });
+  dump_regressor(all, buf, false);
+}
+
+void load_predictor_delta(VW::workspace& all, io_buf& buf)
+{
+  if (all.weights.sparse) { THROW("Delta snapshots require dense weights"); }
+  all.model_delta = true;
+  auto reset_delta = VW::scope_exit([&all] { all.model_delta = false; });
+  const uint32_t num_bits = all.num_bits;
+  std::string unused;
+  save_load_header(all, buf, true, false, unused, *all.options);
+  if (all.num_bits != num_bits)
+  { THROW("Delta snapshot has " << all.num_bits << " bits but the model has " << num_bits << " bits"); }
+  all.l->save_load(buf, true, false);
+  buf.close_file();
+}
+
+void load_predictor_delta(VW::workspace& all, const std::string& reg_name)
+{
+  io_buf buf;
+  buf.add_file(VW::io::open_file_reader(reg_name));
+  load_predictor_delta(all, buf);
+}
 }  // namespace VW
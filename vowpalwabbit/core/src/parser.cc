@@ -60,6 +60,7 @@ int VW_getpid() { return (int)::GetCurrentProcessId(); }
 #include "vw/core/cache.h"
 #include "vw/core/constant.h"
 #include "vw/core/interactions.h"
+#include "vw/core/parallel_parse.h"
 #include "vw/core/parse_args.h"
 #include "vw/core/parse_dispatch_loop.h"
 #include "vw/core/parse_example.h"
@@ -80,6 +81,10 @@ int VW_getpid() { return (int)::GetCurrentProcessId(); }
 #  include "vw/csv_parser/parse_example_csv.h"
 #endif
 
+#ifdef VW_BUILD_SIMDJSON
+#  include "vw/core/parse_example_simdjson.h"
+#endif
+
 // OSX doesn't expects you to use IPPROTO_TCP instead of SOL_TCP
 #if !defined(SOL_TCP) && defined(IPPROTO_TCP)
 #  define SOL_TCP IPPROTO_TCP
@@ -92,9 +97,9 @@ bool got_sigterm;
 
 void handle_sigterm(int) { got_sigterm = true; }
 
-parser::parser(size_t example_queue_limit, bool strict_parse_)
-    : example_pool{example_queue_limit}
-    , ready_parsed_examples{example_queue_limit}
+parser::parser(size_t example_queue_limit, bool strict_parse_, VW::queue_mode example_queue_mode)
+    : example_pool{example_queue_limit, VW::details::example_pool_initializer{&example_pool}}
+    , ready_parsed_examples{example_queue_limit, example_queue_mode}
     , example_queue_limit{example_queue_limit}
     , num_examples_taken_from_pool(0)
     , num_setup_examples(0)
@@ -104,6 +109,9 @@ parser::parser(size_t example_queue_limit, bool strict_parse_)
   this->lbl_parser = simple_label_parser;
 }
 
+// The pipeline may still hold examples from the pool, so it must be stopped before any other member is destroyed.
+parser::~parser() { parallel_parse.reset(); }
+
 namespace VW
 {
 void parse_example_label(string_view label, const VW::label_parser& lbl_parser, const named_labels* ldict,
@@ -130,44 +138,24 @@ bool is_test_only(uint32_t counter, uint32_t period, uint32_t after, bool holdou
   }
 }
 
-uint32_t cache_numbits(VW::io::reader& cache_reader)
+uint32_t cache_numbits(VW::io::reader& cache_reader, VW::cache_format& format)
 {
-  size_t version_buffer_length;
-  if (static_cast<size_t>(cache_reader.read(reinterpret_cast<char*>(&version_buffer_length),
-          sizeof(version_buffer_length))) < sizeof(version_buffer_length))
-  { THROW("failed to read: version_buffer_length"); }
-
-  if (version_buffer_length > 61) THROW("cache version too long, cache file is probably invalid");
-  if (version_buffer_length == 0) THROW("cache version too short, cache file is probably invalid");
+  return VW::details::read_cache_header(cache_reader, format);
+}
 
-  std::vector<char> version_buffer(version_buffer_length);
-  if (static_cast<size_t>(cache_reader.read(version_buffer.data(), version_buffer_length)) < version_buffer_length)
-  { THROW("failed to read: version buffer"); }
-  VW::version_struct cache_version(version_buffer.data());
-  if (cache_version != VW::version)
+void set_cache_reader(VW::workspace& all, VW::cache_format format)
+{
+  if (format == VW::cache_format::block)
   {
-    auto msg = fmt::format(
-        "Cache file version does not match current VW version. Cache files must be produced by the version consuming "
-        "them. Cache version: {} VW version: {}",
-        cache_version.to_string(), VW::version.to_string());
-    THROW(msg);
+    all.example_parser->block_cache_reader = VW::make_unique<VW::details::block_cache_reader>();
+    all.example_parser->reader = VW::read_example_from_block_cache;
+  }
+  else
+  {
+    all.example_parser->reader = VW::read_example_from_cache;
   }
-
-  char marker;
-  if (static_cast<size_t>(cache_reader.read(&marker, sizeof(marker))) < sizeof(marker)) { THROW("failed to read"); }
-
-  if (marker != 'c') THROW("data file is not a cache file");
-
-  uint32_t cache_numbits;
-  if (static_cast<size_t>(cache_reader.read(reinterpret_cast<char*>(&cache_numbits), sizeof(cache_numbits))) <
-      sizeof(cache_numbits))
-  { THROW("failed to read"); }
-
-  return cache_numbits;
 }
 
-void set_cache_reader(VW::workspace& all) { all.example_parser->reader = VW::read_example_from_cache; }
-
 void set_string_reader(VW::workspace& all)
 {
   all.example_parser->reader = read_features_string;
@@ -225,13 +213,28 @@ void set_daemon_reader(VW::workspace& all, bool json = false, bool dsjson = fals
   }
 }
 
+std::unique_ptr<VW::io::reader> open_cache_file_reader(const VW::workspace& all, const std::string& file_name)
+{
+  return all.example_parser->mmap_cache ? VW::io::open_mmap_file_reader(file_name)
+                                        : VW::io::open_file_reader(file_name);
+}
+
 void reset_source(VW::workspace& all, size_t numbits)
 {
   io_buf& input = all.example_parser->input;
 
+  // Any lines read ahead by the parse threads belong to the pass that just ended.
+  if (all.example_parser->parallel_parse != nullptr) { all.example_parser->parallel_parse->stop(); }
+
   // If in write cache mode then close all of the input files then open the written cache as the new input.
   if (all.example_parser->write_cache)
   {
+    const auto format = all.example_parser->block_cache ? VW::cache_format::block : VW::cache_format::row;
+    if (all.example_parser->block_cache_writer != nullptr)
+    {
+      all.example_parser->block_cache_writer->flush(all.example_parser->output);
+      all.example_parser->block_cache_writer.reset();
+    }
     all.example_parser->output.flush();
     // Turn off write_cache as we are now reading it instead of writing!
     all.example_parser->write_cache = false;
@@ -246,8 +249,8 @@ void reset_source(VW::workspace& all, size_t numbits)
           << all.example_parser->currentname << " to " << all.example_parser->finalname);
     input.close_files();
     // Now open the written cache as the new input file.
-    input.add_file(VW::io::open_file_reader(all.example_parser->finalname));
-    set_cache_reader(all);
+    input.add_file(open_cache_file_reader(all, all.example_parser->finalname));
+    set_cache_reader(all, format);
   }
 
   if (all.example_parser->resettable == true)
@@ -288,9 +291,11 @@ void reset_source(VW::workspace& all, size_t numbits)
     {
       if (!input.is_resettable()) { THROW("Cannot reset source as it is a non-resettable input type.") }
       input.reset();
+      if (all.example_parser->block_cache_reader != nullptr) { all.example_parser->block_cache_reader->reset(); }
       for (auto& file : input.get_input_files())
       {
-        const auto num_bits_cachefile = cache_numbits(*file);
+        VW::cache_format format;
+        const auto num_bits_cachefile = cache_numbits(*file, format);
         if (num_bits_cachefile < numbits)
         {
           auto message =
@@ -323,12 +328,15 @@ void make_write_cache(VW::workspace& all, std::string& newname, bool quiet)
     return;
   }
 
-  size_t v_length = static_cast<uint64_t>(VW::version.to_string().length()) + 1;
-
-  output.bin_write_fixed(reinterpret_cast<const char*>(&v_length), sizeof(v_length));
-  output.bin_write_fixed(VW::version.to_string().c_str(), v_length);
-  output.bin_write_fixed("c", 1);
-  output.bin_write_fixed(reinterpret_cast<const char*>(&all.num_bits), sizeof(all.num_bits));
+  if (all.example_parser->block_cache)
+  {
+    VW::details::write_cache_header(output, all.num_bits, VW::cache_format::block);
+    all.example_parser->block_cache_writer = VW::make_unique<VW::details::block_cache_writer>();
+  }
+  else
+  {
+    VW::details::write_cache_header(output, all.num_bits, VW::cache_format::row);
+  }
   output.flush();
 
   all.example_parser->finalname = newname;
@@ -339,6 +347,8 @@ void make_write_cache(VW::workspace& all, std::string& newname, bool quiet)
 void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool kill_cache, bool quiet)
 {
   all.example_parser->write_cache = false;
+  bool format_seen = false;
+  VW::cache_format input_format = VW::cache_format::row;
 
   for (auto& file : cache_files)
   {
@@ -347,7 +357,7 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
     {
       try
       {
-        all.example_parser->input.add_file(VW::io::open_file_reader(file));
+        all.example_parser->input.add_file(open_cache_file_reader(all, file));
         cache_file_opened = true;
       }
       catch (const std::exception&)
@@ -358,7 +368,8 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
     if (cache_file_opened == false) { make_write_cache(all, file, quiet); }
     else
     {
-      uint64_t c = cache_numbits(*all.example_parser->input.get_input_files().back());
+      VW::cache_format format;
+      uint64_t c = cache_numbits(*all.example_parser->input.get_input_files().back(), format);
       if (c < all.num_bits)
       {
         if (!quiet)
@@ -368,8 +379,12 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
       }
       else
       {
+        if (format_seen && format != input_format)
+        { THROW("Cache files of the row and block formats cannot be read together."); }
+        format_seen = true;
+        input_format = format;
         if (!quiet) { *(all.trace_message) << "using cache_file = " << file.c_str() << endl; }
-        set_cache_reader(all);
+        set_cache_reader(all, format);
         all.example_parser->resettable = true;
       }
     }
@@ -389,6 +404,18 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
 
 void enable_sources(VW::workspace& all, bool quiet, size_t passes, input_options& input_options)
 {
+  all.example_parser->mmap_cache = input_options.mmap_cache;
+  all.example_parser->block_cache = input_options.cache_format == "block";
+  if (input_options.json_parser == "simdjson")
+  {
+#ifdef VW_BUILD_SIMDJSON
+    // Text and cache input never reach it.
+    if (input_options.json || input_options.dsjson)
+    { all.example_parser->simdjson_parser = VW::make_unique<VW::details::simdjson_line_parser>(); }
+#else
+    THROW("--json_parser simdjson requires VW to be built with VW_BUILD_SIMDJSON");
+#endif
+  }
   parse_cache(all, input_options.cache_files, input_options.kill_cache, quiet);
 
   // default text reader
@@ -427,7 +454,7 @@ void enable_sources(VW::workspace& all, bool quiet, size_t passes, input_options
       THROWERRNO("bind");
 
     // listen on socket
-    if (listen(all.example_parser->bound_sock, 1) < 0) THROWERRNO("listen");
+    if (listen(all.example_parser->bound_sock, all.epoll_daemon ? SOMAXCONN : 1) < 0) THROWERRNO("listen");
 
     // write port file
     if (all.options->was_supplied("port_file"))
@@ -463,6 +490,16 @@ void enable_sources(VW::workspace& all, bool quiet, size_t passes, input_options
       pid_file.close();
     }
 
+    if (all.epoll_daemon)
+    {
+      // Connections are accepted and read by the event loop in run_epoll_daemon, the parser sees no input.
+      fclose(stdin);
+      set_daemon_reader(all, input_options.json, input_options.dsjson);
+      all.chain_hash_json = input_options.chain_hash_json;
+      if (!all.quiet) { *(all.trace_message) << "serving predictions on port " << port << endl; }
+      return;
+    }
+
     if (all.daemon && !all.active)
     {
 #ifdef _WIN32
@@ -642,6 +679,22 @@ void enable_sources(VW::workspace& all, bool quiet, size_t passes, input_options
   if (passes > 1 && !all.example_parser->resettable)
     THROW("need a cache file for multiple passes : try using  --cache or --cache_file <name>");
 
+  if (input_options.parse_threads > 1)
+  {
+    // Daemon connections replace the reader on every accept, so they stay single threaded.
+    const bool is_daemon = !all.no_daemon && (all.daemon || all.active);
+    if (is_daemon || !VW::details::enable_parallel_parsing(all, input_options.parse_threads))
+    {
+      all.logger.err_warn(
+          "--parse_threads is only supported for text and JSON input read from a file or stdin, and not with "
+          "--json_parser simdjson. Parsing on a single thread.");
+    }
+    else if (!quiet)
+    {
+      *(all.trace_message) << "parse threads = " << input_options.parse_threads << endl;
+    }
+  }
+
   if (!quiet && !all.daemon)
   { *(all.trace_message) << "num sources = " << all.example_parser->input.num_files() << endl; }
 }
@@ -700,8 +753,16 @@ void setup_example(VW::workspace& all, VW::example* ae)
 
   if (all.example_parser->write_cache)
   {
-    VW::write_example_to_cache(all.example_parser->output, ae, all.example_parser->lbl_parser, all.parse_mask,
-        all.example_parser->_cache_temp_buffer);
+    if (all.example_parser->block_cache_writer != nullptr)
+    {
+      all.example_parser->block_cache_writer->write(
+          all.example_parser->output, *ae, all.example_parser->lbl_parser, all.parse_mask);
+    }
+    else
+    {
+      VW::write_example_to_cache(all.example_parser->output, ae, all.example_parser->lbl_parser, all.parse_mask,
+          all.example_parser->_cache_temp_buffer);
+    }
   }
 
   // Require all extents to be complete in an VW::example.
@@ -991,10 +1052,14 @@ void free_parser(VW::workspace& all)
 
 namespace VW
 {
-void end_parser(VW::workspace& all) { all.parse_thread.join(); }
+void end_parser(VW::workspace& all)
+{
+  all.parse_thread.join();
+  if (all.example_parser->parallel_parse != nullptr) { all.example_parser->parallel_parse->stop(); }
+}
 
 bool is_ring_example(const VW::workspace& all, const example* ae)
 {
-  return all.example_parser->example_pool.is_from_pool(ae);
+  return ae->owning_pool == &all.example_parser->example_pool;
 }
 }  // namespace VW
@@ -0,0 +1,291 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/reduction_profiler.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/memory.h"
+#include "vw/core/metric_sink.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define VW_PROFILER_TSC
+#  include <x86intrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  define VW_PROFILER_TSC
+#  include <intrin.h>
+#endif
+
+namespace
+{
+uint64_t steady_clock_ns()
+{
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+inline uint64_t read_ticks()
+{
+#ifdef VW_PROFILER_TSC
+  return __rdtsc();
+#else
+  return steady_clock_ns();
+#endif
+}
+
+uint64_t next_profiler_id()
+{
+  static std::atomic<uint64_t> next_id{1};
+  return next_id++;
+}
+}  // namespace
+
+namespace VW
+{
+struct reduction_profiler::call_node
+{
+  const details::profile_frame* frame;
+  call_node* parent;
+  uint64_t calls = 0;
+  uint64_t examples = 0;
+  uint64_t inclusive_ticks = 0;
+  uint64_t nested_ticks = 0;
+  std::vector<std::unique_ptr<call_node>> children;
+
+  call_node(const details::profile_frame* frame, call_node* parent) : frame(frame), parent(parent) {}
+
+  call_node* child(const details::profile_frame* child_frame)
+  {
+    // A learner calls few distinct frames, so a linear search is the fastest lookup.
+    for (auto& node : children)
+    {
+      if (node->frame == child_frame) { return node.get(); }
+    }
+    children.push_back(VW::make_unique<call_node>(child_frame, this));
+    return children.back().get();
+  }
+};
+
+struct reduction_profiler::thread_state
+{
+  struct active_call
+  {
+    call_node* node;
+    uint64_t start_ticks;
+  };
+
+  std::thread::id thread;
+  call_node root{nullptr, nullptr};
+  call_node* current = &root;
+  std::vector<active_call> calls;
+};
+
+reduction_profiler::reduction_profiler(std::string folded_stacks_file)
+    : _id(next_profiler_id())
+    , _folded_stacks_file(std::move(folded_stacks_file))
+    , _start_ticks(read_ticks())
+    , _start_ns(steady_clock_ns())
+{
+  if (!_folded_stacks_file.empty())
+  {
+    std::ofstream check(_folded_stacks_file, std::ios::trunc);
+    if (!check) { THROW("Could not open profile output file: " << _folded_stacks_file); }
+  }
+}
+
+reduction_profiler::~reduction_profiler() = default;
+
+const details::profile_frame* reduction_profiler::get_frame(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (const auto& frame : _frames)
+  {
+    if (frame->name == name) { return frame.get(); }
+  }
+  _frames.push_back(VW::make_unique<details::profile_frame>(details::profile_frame{name}));
+  return _frames.back().get();
+}
+
+reduction_profiler::thread_state& reduction_profiler::current_thread_state()
+{
+  struct cached_state
+  {
+    uint64_t profiler_id = 0;
+    thread_state* state = nullptr;
+  };
+  static thread_local cached_state cache;
+  if (cache.profiler_id == _id) { return *cache.state; }
+
+  const auto this_thread = std::this_thread::get_id();
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = std::find_if(_threads.begin(), _threads.end(),
+      [this_thread](const std::unique_ptr<thread_state>& state) { return state->thread == this_thread; });
+  if (it == _threads.end())
+  {
+    _threads.push_back(VW::make_unique<thread_state>());
+    _threads.back()->thread = this_thread;
+    it = _threads.end() - 1;
+  }
+  cache.profiler_id = _id;
+  cache.state = it->get();
+  return *cache.state;
+}
+
+void reduction_profiler::enter(const details::profile_frame* frame)
+{
+  auto& state = current_thread_state();
+  call_node* node = state.current->child(frame);
+  state.current = node;
+  state.calls.push_back({node, read_ticks()});
+}
+
+void reduction_profiler::exit(size_t examples)
+{
+  const uint64_t end_ticks = read_ticks();
+  auto& state = current_thread_state();
+  assert(!state.calls.empty());
+  const auto call = state.calls.back();
+  state.calls.pop_back();
+
+  const uint64_t elapsed = end_ticks - call.start_ticks;
+  call.node->calls++;
+  call.node->examples += examples;
+  call.node->inclusive_ticks += elapsed;
+  call.node->parent->nested_ticks += elapsed;
+  state.current = call.node->parent;
+}
+
+double reduction_profiler::ns_per_tick() const
+{
+#ifdef VW_PROFILER_TSC
+  const uint64_t elapsed_ticks = read_ticks() - _start_ticks;
+  const uint64_t elapsed_ns = steady_clock_ns() - _start_ns;
+  if (elapsed_ticks == 0) { return 1.0; }
+  return static_cast<double>(elapsed_ns) / static_cast<double>(elapsed_ticks);
+#else
+  return 1.0;
+#endif
+}
+
+std::vector<reduction_profiler::frame_stats> reduction_profiler::summarize() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  const double scale = ns_per_tick();
+
+  std::vector<frame_stats> stats(_frames.size());
+  std::unordered_map<const details::profile_frame*, size_t> frame_index;
+  for (size_t i = 0; i < _frames.size(); i++)
+  {
+    stats[i].name = _frames[i]->name;
+    frame_index[_frames[i].get()] = i;
+  }
+
+  std::vector<const call_node*> pending;
+  for (const auto& state : _threads)
+  {
+    for (const auto& child : state->root.children) { pending.push_back(child.get()); }
+  }
+  while (!pending.empty())
+  {
+    const call_node* node = pending.back();
+    pending.pop_back();
+    auto& stat = stats[frame_index[node->frame]];
+    stat.calls += node->calls;
+    stat.examples += node->examples;
+    stat.inclusive_ns += static_cast<uint64_t>(static_cast<double>(node->inclusive_ticks) * scale);
+    stat.exclusive_ns += static_cast<uint64_t>(
+        static_cast<double>(node->inclusive_ticks - std::min(node->inclusive_ticks, node->nested_ticks)) * scale);
+    for (const auto& child : node->children) { pending.push_back(child.get()); }
+  }
+  return stats;
+}
+
+void reduction_profiler::write_folded_stacks(std::ostream& output) const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  const double scale = ns_per_tick();
+
+  // The same call path on several threads is reported once.
+  std::map<std::string, uint64_t> paths;
+  std::vector<std::pair<const call_node*, std::string>> pending;
+  for (const auto& state : _threads)
+  {
+    for (const auto& child : state->root.children) { pending.emplace_back(child.get(), child->frame->name); }
+  }
+  while (!pending.empty())
+  {
+    const call_node* node = pending.back().first;
+    const std::string path = std::move(pending.back().second);
+    pending.pop_back();
+    const auto exclusive_ticks = node->inclusive_ticks - std::min(node->inclusive_ticks, node->nested_ticks);
+    paths[path] += static_cast<uint64_t>(static_cast<double>(exclusive_ticks) * scale / 1000.0);
+    for (const auto& child : node->children) { pending.emplace_back(child.get(), path + ";" + child->frame->name); }
+  }
+
+  for (const auto& path : paths)
+  {
+    if (path.second > 0) { output << path.first << ' ' << path.second << '\n'; }
+  }
+}
+
+void reduction_profiler::persist_metrics(metric_sink& metrics) const
+{
+  for (const auto& stat : summarize())
+  {
+    const std::string prefix = "profile_" + stat.name;
+    metrics.set_uint(prefix + "_calls", stat.calls);
+    metrics.set_uint(prefix + "_examples", stat.examples);
+    metrics.set_uint(prefix + "_inclusive_ns", stat.inclusive_ns);
+    metrics.set_uint(prefix + "_exclusive_ns", stat.exclusive_ns);
+  }
+}
+
+void reduction_profiler::report(std::ostream& output) const
+{
+  const auto stats = summarize();
+  size_t name_width = 5;
+  for (const auto& stat : stats) { name_width = std::max(name_width, stat.name.size()); }
+
+  const auto old_flags = output.flags();
+  const auto old_precision = output.precision();
+  output << "Reduction profile:\n"
+         << std::left << std::setw(static_cast<int>(name_width)) << "frame" << std::right << std::setw(12) << "calls"
+         << std::setw(12) << "examples" << std::setw(16) << "inclusive ms" << std::setw(16) << "exclusive ms" << '\n';
+  output << std::fixed << std::setprecision(3);
+  for (const auto& stat : stats)
+  {
+    output << std::left << std::setw(static_cast<int>(name_width)) << stat.name << std::right << std::setw(12)
+           << stat.calls << std::setw(12) << stat.examples << std::setw(16) << stat.inclusive_ns / 1e6
+           << std::setw(16) << stat.exclusive_ns / 1e6 << '\n';
+  }
+  output.flags(old_flags);
+  output.precision(old_precision);
+
+  if (!_folded_stacks_file.empty())
+  {
+    std::ofstream folded_stacks(_folded_stacks_file, std::ios::trunc);
+    write_folded_stacks(folded_stacks);
+  }
+}
+
+const details::profile_frame* details::get_profile_frame(reduction_profiler& profiler, const std::string& name)
+{
+  return profiler.get_frame(name);
+}
+
+void details::enter_profile_frame(reduction_profiler& profiler, const profile_frame* frame) { profiler.enter(frame); }
+
+void details::exit_profile_frame(reduction_profiler& profiler, size_t examples) { profiler.exit(examples); }
+}  // namespace VW
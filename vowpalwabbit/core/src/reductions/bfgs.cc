@@ -890,7 +890,7 @@ int process_pass(VW::workspace& all, bfgs& b)
   b.net_time = static_cast<double>(
       std::chrono::duration_cast<std::chrono::milliseconds>(b.t_end_global - b.t_start_global).count());
 
-  if (all.save_per_pass) { save_predictor(all, all.final_regressor_name, b.current_pass); }
+  if (all.save_per_pass) { save_pass_checkpoint(all, all.final_regressor_name, b.current_pass); }
   return status;
 }
 
@@ -156,8 +156,8 @@ VW_WARNING_STATE_POP
 
 void set_minmax(shared_data* sd, float label, bool min_fixed, bool max_fixed)
 {
-  if (!min_fixed) { sd->min_label = std::min(label, sd->min_label); }
-  if (!max_fixed) { sd->max_label = std::max(label, sd->max_label); }
+  if (!min_fixed) { sd->min_label = std::min(label, sd->min_label.load()); }
+  if (!max_fixed) { sd->max_label = std::max(label, sd->max_label.load()); }
 }
 
 void print_audit_features(VW::workspace& all, VW::example& ec)
@@ -209,7 +209,7 @@ void predict(cbzo& data, base_learner&, VW::example& ec)
 
   float action_centroid = inference<policy>(*data.all, ec);
   set_minmax(data.all->sd, action_centroid, data.min_prediction_supplied, data.max_prediction_supplied);
-  action_centroid = VW::math::clamp(action_centroid, data.all->sd->min_label, data.all->sd->max_label);
+  action_centroid = VW::math::clamp(action_centroid, data.all->sd->min_label.load(), data.all->sd->max_label.load());
 
   approx_pmf_to_pdf(action_centroid - data.radius, action_centroid + data.radius, ec.pred.pdf);
 
@@ -21,14 +21,20 @@ struct reduction_data
 {
   shared_data* _sd;
   VW::LEARNER::base_learner* _base;
+  // Threads learning concurrently (see --learn_threads) only finish examples one at a time, so the labels are counted
+  // there instead.
+  bool _count_on_finish;
 
-  explicit reduction_data(shared_data* sd, VW::LEARNER::base_learner* base) : _sd(sd), _base(base) {}
+  explicit reduction_data(shared_data* sd, VW::LEARNER::base_learner* base, bool count_on_finish)
+      : _sd(sd), _base(base), _count_on_finish(count_on_finish)
+  {
+  }
 };
 
 template <bool is_learn>
 void count_label_single(reduction_data& data, VW::LEARNER::single_learner& base, VW::example& ec)
 {
-  VW::count_label(*data._sd, ec.l.simple.label);
+  if (!data._count_on_finish) { VW::count_label(*data._sd, ec.l.simple.label); }
 
   if VW_STD17_CONSTEXPR (is_learn) { base.learn(ec); }
   else
@@ -37,6 +43,15 @@ void count_label_single(reduction_data& data, VW::LEARNER::single_learner& base,
   }
 }
 
+void count_label_batch(reduction_data& data, VW::LEARNER::single_learner& base, VW::example** examples, size_t count)
+{
+  if (!data._count_on_finish)
+  {
+    for (size_t i = 0; i < count; i++) { VW::count_label(*data._sd, examples[i]->l.simple.label); }
+  }
+  base.predict_batch(examples, count);
+}
+
 template <bool is_learn>
 void count_label_multi(reduction_data& data, VW::LEARNER::multi_learner& base, VW::multi_ex& ec_seq)
 {
@@ -56,6 +71,7 @@ void finish_example_multi(VW::workspace& all, reduction_data& data, VW::multi_ex
 }
 void finish_example_single(VW::workspace& all, reduction_data& data, VW::example& ec)
 {
+  if (data._count_on_finish) { VW::count_label(*data._sd, ec.l.simple.label); }
   VW::LEARNER::as_singleline(data._base)->finish_example(all, ec);
 }
 }  // namespace
@@ -93,7 +109,7 @@ VW::LEARNER::base_learner* VW::reductions::count_label_setup(VW::setup_base_i& s
   // constructed but it works because we aren't part of it
   if (base_label_type != label_type_t::simple) { return base; }
 
-  auto data = VW::make_unique<reduction_data>(all->sd, base);
+  auto data = VW::make_unique<reduction_data>(all->sd, base, all->learn_threads > 1);
   if (base->is_multiline())
   {
     auto* learner = VW::LEARNER::make_reduction_learner(std::move(data), VW::LEARNER::as_multiline(base),
@@ -112,6 +128,7 @@ VW::LEARNER::base_learner* VW::reductions::count_label_setup(VW::setup_base_i& s
                       .set_output_prediction_type(base->get_output_prediction_type())
                       .set_input_label_type(label_type_t::simple)
                       .set_finish_example(finish_example_single)
+                      .set_predict_batch(count_label_batch)
                       .build();
   return VW::LEARNER::make_base(*learner);
 }
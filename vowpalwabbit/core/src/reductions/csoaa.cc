@@ -9,6 +9,7 @@
 #include "vw/core/vw.h"
 #include "vw/io/logger.h"
 
+#include <algorithm>
 #include <utility>
 
 using namespace VW::LEARNER;
@@ -66,6 +67,16 @@ inline void inner_loop(single_learner& base, VW::example& ec, uint32_t i, float
 
 #define DO_MULTIPREDICT true
 
+inline uint32_t class_offset(const csoaa& c, uint32_t i) { return c.indexing == 0 ? i : i - 1; }
+
+// Whether scoring every class with multipredict is worthwhile for the costs of a test example and covers all of them.
+bool use_multipredict(const csoaa& c, const COST_SENSITIVE::label& ld)
+{
+  if (2 * ld.costs.size() < c.num_classes) { return false; }
+  return std::all_of(ld.costs.begin(), ld.costs.end(),
+      [&c](const COST_SENSITIVE::wclass& cl) { return class_offset(c, cl.class_index) < c.num_classes; });
+}
+
 template <bool is_learn>
 void predict_or_learn(csoaa& c, single_learner& base, VW::example& ec)
 {
@@ -114,7 +125,24 @@ void predict_or_learn(csoaa& c, single_learner& base, VW::example& ec)
 
   bool dont_learn = DO_MULTIPREDICT && !is_learn;
 
-  if (!ld.costs.empty())
+  if (!ld.costs.empty() && dont_learn && use_multipredict(c, ld))
+  {
+    base.multipredict(ec, 0, c.num_classes, c.pred, false);
+    for (auto& cl : ld.costs)
+    {
+      const uint32_t i = cl.class_index;
+      const float partial_prediction = c.pred[class_offset(c, i)].scalar;
+      cl.partial_prediction = partial_prediction;
+      if (partial_prediction < score || (partial_prediction == score && i < prediction))
+      {
+        score = partial_prediction;
+        prediction = i;
+      }
+      add_passthrough_feature(ec, i, partial_prediction);
+    }
+    ec.partial_prediction = score;
+  }
+  else if (!ld.costs.empty())
   {
     for (auto& cl : ld.costs)
     { inner_loop<is_learn>(base, ec, cl.class_index, cl.x, prediction, score, cl.partial_prediction, c.indexing); }
@@ -72,6 +72,47 @@ void predict(freegrad& b, base_learner& /* base */, VW::example& ec)
   if (audit) { GD::print_audit_features(*(b.all), ec); }
 }
 
+template <bool audit>
+void multipredict(freegrad& b, base_learner&, VW::example& ec, size_t count, size_t step, VW::polyprediction* pred,
+    bool finalize_predictions)
+{
+  VW::workspace& all = *b.all;
+  const auto& simple_red_features = ec._reduction_features.template get<simple_label_reduction_features>();
+  for (size_t c = 0; c < count; c++) { pred[c].scalar = simple_red_features.initial; }
+
+  size_t num_features_from_interactions = 0;
+  if (all.weights.sparse)
+  {
+    GD::multipredict_info<sparse_parameters> mp = {
+        count, step, pred, all.weights.sparse_weights, static_cast<float>(all.sd->gravity)};
+    GD::foreach_feature<GD::multipredict_info<sparse_parameters>, uint64_t, GD::vec_add_multipredict>(
+        all, ec, mp, num_features_from_interactions);
+  }
+  else
+  {
+    GD::multipredict_info<dense_parameters> mp = {
+        count, step, pred, all.weights.dense_weights, static_cast<float>(all.sd->gravity)};
+    GD::foreach_feature<GD::multipredict_info<dense_parameters>, uint64_t, GD::vec_add_multipredict>(
+        all, ec, mp, num_features_from_interactions);
+  }
+  ec.num_features_from_interactions = num_features_from_interactions;
+
+  if (finalize_predictions)
+  {
+    for (size_t c = 0; c < count; c++) { pred[c].scalar = GD::finalize_prediction(all.sd, all.logger, pred[c].scalar); }
+  }
+  if (audit)
+  {
+    for (size_t c = 0; c < count; c++)
+    {
+      ec.pred.scalar = pred[c].scalar;
+      GD::print_audit_features(all, ec);
+      ec.ft_offset += static_cast<uint64_t>(step);
+    }
+    ec.ft_offset -= static_cast<uint64_t>(step * count);
+  }
+}
+
 void inner_freegrad_predict(freegrad_update_data& d, float x, float& wref)
 {
   float* w = &wref;
@@ -382,11 +423,13 @@ base_learner* VW::reductions::freegrad_setup(VW::setup_base_i& stack_builder)
   }
 
   auto predict_ptr = (fg_ptr->all->audit || fg_ptr->all->hash_inv) ? predict<true> : predict<false>;
+  auto multipredict_ptr = (fg_ptr->all->audit || fg_ptr->all->hash_inv) ? multipredict<true> : multipredict<false>;
   auto learn_ptr = (fg_ptr->all->audit || fg_ptr->all->hash_inv) ? learn_freegrad<true> : learn_freegrad<false>;
   auto* l = VW::LEARNER::make_base_learner(std::move(fg_ptr), learn_ptr, predict_ptr,
       stack_builder.get_setupfn_name(freegrad_setup), VW::prediction_type_t::scalar, VW::label_type_t::simple)
                 .set_learn_returns_prediction(true)
                 .set_params_per_weight(UINT64_ONE << stack_builder.get_all_pointer()->weights.stride_shift())
+                .set_multipredict(multipredict_ptr)
                 .set_save_load(save_load)
                 .set_end_pass(end_pass)
                 .build();
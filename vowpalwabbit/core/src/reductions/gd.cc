@@ -11,6 +11,7 @@
 #include "vw/core/setup_base.h"
 
 #include <cfloat>
+#include <limits>
 
 #if !defined(VW_NO_INLINE_SIMD)
 #  if !defined(__SSE2__) && (defined(_M_AMD64) || defined(_M_X64))
@@ -24,6 +25,14 @@
 #  endif
 #endif
 
+#if defined(__GNUC__) || defined(__clang__)
+#  define VW_PREFETCH(address) __builtin_prefetch(address)
+#elif !defined(VW_NO_INLINE_SIMD) && defined(__SSE2__)
+#  define VW_PREFETCH(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+#  define VW_PREFETCH(address)
+#endif
+
 #include "vw/core/accumulate.h"
 #include "vw/core/debug_log.h"
 #include "vw/core/label_parser.h"
@@ -128,6 +137,35 @@ static inline float InvSqrt(float x)
 
   return x;
 }
+template <class DataT, void (*FuncT)(DataT&, float, float&)>
+struct dirty_tracking_data
+{
+  DataT& data;
+  dense_parameters& weights;
+};
+
+template <class DataT, void (*FuncT)(DataT&, float, float&)>
+inline void track_dirty_feature(dirty_tracking_data<DataT, FuncT>& d, float x, float& fw)
+{
+  FuncT(d.data, x, fw);
+  d.weights.mark_dirty(&fw);
+}
+
+// foreach_feature which also marks the blocks of the visited weights as dirty when delta snapshots are taken.
+template <class DataT, void (*FuncT)(DataT&, float, float&)>
+inline void foreach_feature_tracked(VW::workspace& all, VW::example& ec, DataT& dat)
+{
+  if (!all.weights.sparse && all.weights.dense_weights.dirty_tracking())
+  {
+    dirty_tracking_data<DataT, FuncT> tracked{dat, all.weights.dense_weights};
+    foreach_feature<dirty_tracking_data<DataT, FuncT>, track_dirty_feature<DataT, FuncT>>(all, ec, tracked);
+  }
+  else
+  {
+    foreach_feature<DataT, FuncT>(all, ec, dat);
+  }
+}
+
 VW_WARNING_STATE_PUSH
 VW_WARNING_DISABLE_COND_CONST_EXPR
 template <bool sqrt_rate, bool feature_mask_off, size_t adaptive, size_t normalized, size_t spare>
@@ -165,12 +203,30 @@ float average_update(float total_weight, float normalized_sum_norm_x, float neg_
   return 1.f;
 }
 
+// Locks the normalized totals in per_model_states, if other threads may be learning at the same time.
+std::unique_lock<std::mutex> lock_per_model_states(gd& g)
+{
+  return g.concurrent_learn ? std::unique_lock<std::mutex>(g.per_model_states_mutex) : std::unique_lock<std::mutex>();
+}
+
+// The update multiplier of the current totals, for updates of examples which did not add to them.
+template <bool sqrt_rate, size_t adaptive, size_t normalized>
+float current_update_multiplier(gd& g)
+{
+  auto lock = lock_per_model_states(g);
+  const auto& state = g.per_model_states[0];
+  if (state.total_weight == 0.) { return 0.f; }
+  return average_update<sqrt_rate, adaptive, normalized>(static_cast<float>(state.total_weight),
+      static_cast<float>(state.normalized_sum_norm_x), g.neg_norm_power);
+}
+
 template <bool sqrt_rate, bool feature_mask_off, size_t adaptive, size_t normalized, size_t spare>
-void train(gd& g, VW::example& ec, float update)
+void train(gd& g, VW::example& ec, float update, float update_multiplier)
 {
-  if VW_STD17_CONSTEXPR (normalized != 0) { update *= g.update_multiplier; }
+  if VW_STD17_CONSTEXPR (normalized != 0) { update *= update_multiplier; }
   VW_DBG(ec) << "gd: train() spare=" << spare << std::endl;
-  foreach_feature<float, update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare>>(*g.all, ec, update);
+  foreach_feature_tracked<float, update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare>>(
+      *g.all, ec, update);
 }
 
 void end_pass(gd& g)
@@ -188,7 +244,7 @@ void end_pass(gd& g)
     }
   }
   all.eta *= all.eta_decay_rate;
-  if (all.save_per_pass) { save_predictor(all, all.final_regressor_name, all.current_pass); }
+  if (all.save_per_pass) { save_pass_checkpoint(all, all.final_regressor_name, all.current_pass); }
 
   if (!all.holdout_set_off)
   {
@@ -429,6 +485,122 @@ inline void vec_add_print(float& p, const float fx, float& fw)
   std::cerr << " + " << fw << "*" << fx;
 }
 
+// Compares the score of the float weights with the score of each quantized copy of them.
+void record_quantization_errors(gd& g, VW::example& ec, float score)
+{
+  VW::workspace& all = *g.all;
+  const auto& simple_red_features = ec._reduction_features.template get<simple_label_reduction_features>();
+  for (auto& error : g.quantization_errors)
+  {
+    // The weights are only known once the model is loaded, and do not change afterwards without learning.
+    if (error.weights == nullptr)
+    {
+      auto& weights = all.weights.dense_weights;
+      error.weights = VW::make_unique<VW::quantized_parameters>(
+          weights.first(), weights.mask(), weights.stride_shift(), error.quantization);
+    }
+
+    const float quantized_score = inline_predict<VW::quantized_parameters>(*error.weights, all.ignore_some_linear,
+        all.ignore_linear, *ec.interactions, *ec.extent_interactions, all.permutations, ec, all.interactions_cache(),
+        simple_red_features.initial);
+    const float abs_error = std::fabs(quantized_score - score);
+    error.sum_abs_error += abs_error;
+    error.max_abs_error = std::max(error.max_abs_error, abs_error);
+    error.predictions++;
+  }
+}
+
+void finish(gd& g)
+{
+  VW::workspace& all = *g.all;
+  if (g.quantization_errors.empty() || all.quiet) { return; }
+
+  const auto& weights = all.weights.dense_weights;
+  const uint64_t float_bytes = ((weights.mask() >> weights.stride_shift()) + 1) * sizeof(float);
+  *(all.trace_message) << "quantization report, float weights use " << float_bytes << " bytes" << std::endl;
+  for (const auto& error : g.quantization_errors)
+  {
+    *(all.trace_message) << VW::to_string(error.quantization) << ": ";
+    if (error.weights == nullptr)
+    {
+      *(all.trace_message) << "no predictions" << std::endl;
+      continue;
+    }
+    const size_t bytes = error.weights->memory_bytes();
+    *(all.trace_message) << bytes << " bytes (" << static_cast<float>(bytes) / float_bytes
+                         << " of float), mean abs score error = " << error.sum_abs_error / error.predictions
+                         << ", max abs score error = " << error.max_abs_error << std::endl;
+  }
+}
+
+inline void add_factorized_namespace(float& dotprod, const VW::shared_features::factorized_namespace& ns)
+{
+  const auto& values = ns.shared->values;
+  for (size_t i = 0; i < values.size(); i++) { vec_add(dotprod, values[i], ns.weights[i]); }
+}
+
+// Scores an action of --factorize_shared_features with the same additions, in the same order, as the action with every
+// shared namespace merged into it. The weights of the shared features are looked up once for all actions.
+template <class WeightsT>
+float factorized_predict(VW::workspace& all, WeightsT& weights, VW::example& ec,
+    const VW::shared_features::reduction_features& shared, size_t& num_interacted_features)
+{
+  auto& factorized = *shared.factorized;
+  const uint64_t offset = ec.ft_offset;
+  const WeightsT& const_weights = weights;
+  if (!factorized.has_weights || factorized.weights_offset != offset)
+  {
+    for (auto& ns : factorized.namespaces)
+    {
+      ns.weights.resize(ns.shared->size());
+      for (size_t i = 0; i < ns.weights.size(); i++)
+      { ns.weights[i] = const_weights[static_cast<size_t>(ns.shared->indices[i] + offset)]; }
+    }
+    factorized.has_weights = true;
+    factorized.weights_offset = offset;
+  }
+
+  const auto is_linear = [&all](VW::namespace_index idx) { return !all.ignore_some_linear || !all.ignore_linear[idx]; };
+  const auto add_own_features = [&](float& dotprod, const features& fs, size_t count)
+  {
+    for (size_t i = 0; i < count; i++)
+    { vec_add(dotprod, fs.values[i], const_weights[static_cast<size_t>(fs.indices[i] + offset)]); }
+  };
+
+  float dotprod = ec._reduction_features.template get<simple_label_reduction_features>().initial;
+  const auto own_begin = ec.indices.begin();
+  const auto own_end = own_begin + shared.num_own_indices;
+  // Merging appends the shared features of a namespace the action already has to the features of the action.
+  for (auto it = own_begin; it != own_end; ++it)
+  {
+    if (!is_linear(*it)) { continue; }
+    const features& fs = ec.feature_space[*it];
+    const int position = factorized.positions[*it];
+    if (position < 0) { add_own_features(dotprod, fs, fs.size()); }
+    else
+    {
+      const auto& ns = factorized.namespaces[position];
+      add_own_features(dotprod, fs, ns.merged ? fs.size() - ns.shared->size() : fs.size());
+      add_factorized_namespace(dotprod, ns);
+    }
+  }
+  // The namespaces the action does not have follow its own ones, in the order of the shared example.
+  for (const auto& ns : factorized.namespaces)
+  {
+    if (is_linear(ns.index) && std::find(own_begin, own_end, ns.index) == own_end)
+    { add_factorized_namespace(dotprod, ns); }
+  }
+  // Namespaces added below the merger, after the merged ones.
+  for (auto it = ec.indices.begin() + shared.num_merged_indices; it != ec.indices.end(); ++it)
+  {
+    if (is_linear(*it)) { add_own_features(dotprod, ec.feature_space[*it], ec.feature_space[*it].size()); }
+  }
+
+  generate_interactions<float, float, vec_add, WeightsT>(*ec.interactions, *ec.extent_interactions, all.permutations,
+      ec, dotprod, weights, num_interacted_features, all.interactions_cache());
+  return dotprod;
+}
+
 template <bool l1, bool audit>
 void predict(gd& g, base_learner&, VW::example& ec)
 {
@@ -436,11 +608,19 @@ void predict(gd& g, base_learner&, VW::example& ec)
 
   VW::workspace& all = *g.all;
   size_t num_interacted_features = 0;
+  const auto& shared = ec._reduction_features.template get<VW::shared_features::reduction_features>();
   if (l1) { ec.partial_prediction = trunc_predict(all, ec, all.sd->gravity, num_interacted_features); }
+  else if (shared.factorized != nullptr)
+  {
+    ec.partial_prediction = all.weights.sparse
+        ? factorized_predict(all, all.weights.sparse_weights, ec, shared, num_interacted_features)
+        : factorized_predict(all, all.weights.dense_weights, ec, shared, num_interacted_features);
+  }
   else
   {
     ec.partial_prediction = inline_predict(all, ec, num_interacted_features);
   }
+  if (!g.quantization_errors.empty()) { record_quantization_errors(g, ec, ec.partial_prediction); }
 
   ec.num_features_from_interactions = num_interacted_features;
   ec.partial_prediction *= static_cast<float>(all.sd->contraction);
@@ -452,6 +632,30 @@ void predict(gd& g, base_learner&, VW::example& ec)
   if (audit) { print_audit_features(all, ec); }
 }
 
+// Requests the cache lines holding the weights of the linear features of ec. Weights of generated interaction features
+// are only known once the interactions are expanded and are not prefetched.
+inline void prefetch_linear_weights(const dense_parameters& weights, VW::example& ec)
+{
+  const uint64_t offset = ec.ft_offset;
+  for (features& fs : ec)
+  {
+    for (auto index : fs.indices) { VW_PREFETCH(&weights[index + offset]); }
+  }
+}
+
+template <bool l1, bool audit>
+void predict_batch(gd& g, base_learner& base, VW::example** examples, size_t count)
+{
+  // The weight loads of the next example overlap with scoring the current one. Sparse weights are created on lookup,
+  // so they can not be prefetched without changing the model.
+  const bool prefetch = !g.all->weights.sparse;
+  for (size_t i = 0; i < count; i++)
+  {
+    if (prefetch && i + 1 < count) { prefetch_linear_weights(g.all->weights.dense_weights, *examples[i + 1]); }
+    predict<l1, audit>(g, base, *examples[i]);
+  }
+}
+
 template <class T>
 inline void vec_add_trunc_multipredict(multipredict_info<T>& mp, const float fx, uint64_t fi)
 {
@@ -635,7 +839,7 @@ inline void pred_per_update_feature(norm_data& nd, float x, float& fw)
 bool global_print_features = false;
 template <bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive, size_t normalized, size_t spare,
     bool stateless>
-float get_pred_per_update(gd& g, VW::example& ec)
+float get_pred_per_update(gd& g, VW::example& ec, float& update_multiplier)
 {
   // We must traverse the features in _precisely_ the same order as during training.
   label_data& ld = ec.l.simple;
@@ -644,41 +848,60 @@ float get_pred_per_update(gd& g, VW::example& ec)
   float grad_squared = ec.weight;
   if (!adax) { grad_squared *= all.loss->get_square_grad(ec.pred.scalar, ld.label); }
 
-  if (grad_squared == 0 && !stateless) { return 1.; }
+  if (grad_squared == 0 && !stateless)
+  {
+    update_multiplier = current_update_multiplier<sqrt_rate, adaptive, normalized>(g);
+    return 1.;
+  }
 
   norm_data nd = {grad_squared, 0., 0., {g.neg_power_t, g.neg_norm_power}, {0}, &g.all->logger};
-  foreach_feature<norm_data,
-      pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, stateless>>(all, ec, nd);
+  // The adaptive and normalized state is updated here, even if the weight itself is not.
+  if VW_STD17_CONSTEXPR (stateless)
+  {
+    foreach_feature<norm_data,
+        pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, stateless>>(all, ec, nd);
+  }
+  else
+  {
+    foreach_feature_tracked<norm_data,
+        pred_per_update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare, stateless>>(all, ec, nd);
+  }
   if VW_STD17_CONSTEXPR (normalized != 0)
   {
+    auto lock = lock_per_model_states(g);
+    auto& state = g.per_model_states[0];
     if (!stateless)
     {
-      g.per_model_states[0].normalized_sum_norm_x += (static_cast<double>(ec.weight)) * nd.norm_x;
-      g.per_model_states[0].total_weight += ec.weight;
-      g.update_multiplier =
-          average_update<sqrt_rate, adaptive, normalized>(static_cast<float>(g.per_model_states[0].total_weight),
-              static_cast<float>(g.per_model_states[0].normalized_sum_norm_x), g.neg_norm_power);
+      state.normalized_sum_norm_x += (static_cast<double>(ec.weight)) * nd.norm_x;
+      state.total_weight += ec.weight;
+      update_multiplier = average_update<sqrt_rate, adaptive, normalized>(
+          static_cast<float>(state.total_weight), static_cast<float>(state.normalized_sum_norm_x), g.neg_norm_power);
     }
     else
     {
-      float nsnx = (static_cast<float>(g.per_model_states[0].normalized_sum_norm_x)) + ec.weight * nd.norm_x;
-      float tw = static_cast<float>(g.per_model_states[0].total_weight) + ec.weight;
-      g.update_multiplier = average_update<sqrt_rate, adaptive, normalized>(tw, nsnx, g.neg_norm_power);
+      float nsnx = (static_cast<float>(state.normalized_sum_norm_x)) + ec.weight * nd.norm_x;
+      float tw = static_cast<float>(state.total_weight) + ec.weight;
+      update_multiplier = average_update<sqrt_rate, adaptive, normalized>(tw, nsnx, g.neg_norm_power);
     }
-    nd.pred_per_update *= g.update_multiplier;
+    if (lock.owns_lock()) { lock.unlock(); }
+    nd.pred_per_update *= update_multiplier;
   }
   return nd.pred_per_update;
 }
 
 template <bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive, size_t normalized, size_t spare,
     bool stateless>
-float sensitivity(gd& g, VW::example& ec)
+float sensitivity(gd& g, VW::example& ec, float& update_multiplier)
 {
   if VW_STD17_CONSTEXPR (adaptive || normalized)
-  { return get_pred_per_update<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, stateless>(g, ec); }
+  {
+    return get_pred_per_update<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, stateless>(
+        g, ec, update_multiplier);
+  }
   else
   {
     _UNUSED(g);
+    update_multiplier = 1.f;
     return ec.get_total_sum_feat_sq();
   }
 }
@@ -700,13 +923,14 @@ float get_scale(gd& g, VW::example& /* ec */, float weight)
 template <bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive, size_t normalized, size_t spare>
 float sensitivity(gd& g, base_learner& /* base */, VW::example& ec)
 {
+  float update_multiplier = 0.f;
   return get_scale<adaptive>(g, ec, 1.) *
-      sensitivity<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, true>(g, ec);
+      sensitivity<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, true>(g, ec, update_multiplier);
 }
 
 template <bool sparse_l2, bool invariant, bool sqrt_rate, bool feature_mask_off, bool adax, size_t adaptive,
     size_t normalized, size_t spare>
-float compute_update(gd& g, VW::example& ec)
+float compute_update(gd& g, VW::example& ec, float& update_multiplier)
 {
   // invariant: not a test label, importance weight > 0
   const label_data& ld = ec.l.simple;
@@ -716,7 +940,8 @@ float compute_update(gd& g, VW::example& ec)
   ec.updated_prediction = ec.pred.scalar;
   if (all.loss->get_loss(all.sd, ec.pred.scalar, ld.label) > 0.)
   {
-    float pred_per_update = sensitivity<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, false>(g, ec);
+    float pred_per_update =
+        sensitivity<sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare, false>(g, ec, update_multiplier);
     float update_scale = get_scale<adaptive>(g, ec, ec.weight);
     if (invariant) { update = all.loss->get_update(ec.pred.scalar, ld.label, update_scale, pred_per_update); }
     else
@@ -735,6 +960,7 @@ float compute_update(gd& g, VW::example& ec)
       all.sd->gravity += eta_bar * all.l1_lambda;
     }
   }
+  else if (sparse_l2) { update_multiplier = current_update_multiplier<sqrt_rate, adaptive, normalized>(g); }
 
   if (sparse_l2) { update -= g.sparse_l2 * ec.pred.scalar; }
 
@@ -753,9 +979,10 @@ void update(gd& g, base_learner&, VW::example& ec)
 {
   // invariant: not a test label, importance weight > 0
   float update;
+  float update_multiplier = 0.f;
   if ((update = compute_update<sparse_l2, invariant, sqrt_rate, feature_mask_off, adax, adaptive, normalized, spare>(
-           g, ec)) != 0.)
-  { train<sqrt_rate, feature_mask_off, adaptive, normalized, spare>(g, ec, update); }
+           g, ec, update_multiplier)) != 0.)
+  { train<sqrt_rate, feature_mask_off, adaptive, normalized, spare>(g, ec, update, update_multiplier); }
 
   if (g.all->sd->contraction < 1e-9 || g.all->sd->gravity > 1e3)
   {  // updating weights now to avoid numerical instability
@@ -791,6 +1018,7 @@ void sync_weights(VW::workspace& all)
   {
     for (weight& w : all.weights.dense_weights)
     { w = trunc_weight(w, static_cast<float>(all.sd->gravity)) * static_cast<float>(all.sd->contraction); }
+    all.weights.dense_weights.mark_all_dirty();
   }
 
   all.sd->gravity = 0.;
@@ -817,6 +1045,133 @@ size_t write_index(io_buf& model_file, std::stringstream& msg, bool text, uint32
   return brw;
 }
 
+// Calls write_row for every row of the blocks which changed since the last snapshot, for delta snapshots.
+template <class WriteRowT>
+void for_each_dirty_row(sparse_parameters&, WriteRowT&&)
+{
+  THROW("Delta snapshots require dense weights");
+}
+
+template <class WriteRowT>
+void for_each_dirty_row(dense_parameters& weights, WriteRowT&& write_row)
+{
+  const uint64_t rows = (weights.mask() + 1) >> weights.stride_shift();
+  for (uint64_t row = weights.next_dirty_row(0); row < rows; row = weights.next_dirty_row(row + 1))
+  {
+    auto v = weights.begin();
+    v += row;
+    write_row(v);
+  }
+}
+
+// With --page_aligned_weights the weight records are replaced by the in-memory weight array. It starts with an
+// index no model can contain, followed by a header, zero padding and the array itself at an offset which is a
+// multiple of WEIGHT_ARRAY_ALIGNMENT. The alignment is a multiple of every common page size, so predict only runs can
+// map the array straight from the file instead of parsing it.
+constexpr uint64_t WEIGHT_ARRAY_ALIGNMENT = 1 << 16;
+constexpr size_t WEIGHT_ARRAY_CHUNK_BYTES = 1 << 20;
+
+bool is_weight_array_marker(uint32_t num_bits, uint64_t i)
+{
+  return num_bits < 31 ? i == std::numeric_limits<uint32_t>::max() : i == std::numeric_limits<uint64_t>::max();
+}
+
+bool writes_weight_array(VW::workspace& all, bool text)
+{
+  return all.page_aligned_weights && !text && !all.model_delta && !all.weights.sparse;
+}
+
+size_t write_weight_array(VW::workspace&, io_buf&, sparse_parameters&)
+{
+  THROW("--page_aligned_weights requires dense weights");
+}
+
+size_t write_weight_array(VW::workspace& all, io_buf& model_file, dense_parameters& weights)
+{
+  size_t brw = all.num_bits < 31 ? model_file.write_value(std::numeric_limits<uint32_t>::max())
+                                 : model_file.write_value(std::numeric_limits<uint64_t>::max());
+
+  const uint32_t stride_shift = weights.stride_shift();
+  const uint64_t num_weights = weights.mask() + 1;
+  const uint64_t header_end = model_file.output_position() + sizeof(stride_shift) + 3 * sizeof(uint64_t);
+  const uint64_t array_offset =
+      (header_end + WEIGHT_ARRAY_ALIGNMENT - 1) / WEIGHT_ARRAY_ALIGNMENT * WEIGHT_ARRAY_ALIGNMENT;
+  const uint64_t padding = array_offset - header_end;
+  brw += model_file.write_value(stride_shift);
+  brw += model_file.write_value(padding);
+  brw += model_file.write_value(array_offset);
+  brw += model_file.write_value(num_weights);
+
+  const std::vector<char> zeros(static_cast<size_t>(padding), 0);
+  brw += model_file.bin_write_fixed(zeros.data(), zeros.size());
+  assert(model_file.output_position() == array_offset);
+
+  // Written in chunks, io_buf would otherwise grow its buffer to the size of the array.
+  const char* data = reinterpret_cast<const char*>(weights.first());
+  const uint64_t num_bytes = num_weights * sizeof(weight);
+  for (uint64_t written = 0; written < num_bytes; written += WEIGHT_ARRAY_CHUNK_BYTES)
+  {
+    const size_t chunk = static_cast<size_t>(std::min<uint64_t>(WEIGHT_ARRAY_CHUNK_BYTES, num_bytes - written));
+    brw += model_file.bin_write_fixed(data + written, chunk);
+  }
+  return brw;
+}
+
+void read_weight_array(VW::workspace&, io_buf&, sparse_parameters&)
+{
+  THROW("Models saved with --page_aligned_weights require dense weights");
+}
+
+void read_weight_array(VW::workspace& all, io_buf& model_file, dense_parameters& weights)
+{
+  const auto stride_shift = model_file.read_value<uint32_t>("weight array stride shift");
+  const auto padding = model_file.read_value<uint64_t>("weight array padding");
+  const auto array_offset = model_file.read_value<uint64_t>("weight array offset");
+  const auto num_weights = model_file.read_value<uint64_t>("weight array length");
+  if (stride_shift != weights.stride_shift() || num_weights != weights.mask() + 1)
+  {
+    THROW("Model content is corrupted, weight array of " << num_weights << " weights with stride shift "
+                                                         << stride_shift << " does not match the " << weights.mask() + 1
+                                                         << " weights with stride shift " << weights.stride_shift()
+                                                         << " of this model");
+  }
+  const uint64_t num_bytes = num_weights * sizeof(weight);
+
+#ifndef _WIN32
+  // Predict only runs never write the weights, so every process serving the model shares the pages of the file.
+  // Writes which do happen, such as loading --initial_deltas, only copy the pages they touch.
+  if (!all.training && model_file.num_input_files() == 1 && !weights.seeded() && !weights.dirty_tracking())
+  {
+    void* mapped = model_file.get_input_files()[0]->map_private(array_offset, static_cast<size_t>(num_bytes));
+    if (mapped != nullptr)
+    {
+      weights.use_mapped_weights(static_cast<weight*>(mapped), static_cast<size_t>(num_bytes));
+      // The array is the last part of a model, so the rest of the file is not needed.
+      return;
+    }
+  }
+#else
+  _UNUSED(all);
+  _UNUSED(array_offset);
+#endif
+
+  char skipped[4096];
+  for (uint64_t remaining = padding; remaining > 0;)
+  {
+    const size_t chunk = static_cast<size_t>(std::min<uint64_t>(sizeof(skipped), remaining));
+    if (model_file.bin_read_fixed(skipped, chunk) != chunk)
+    { THROW("Model content is corrupted, weight array is truncated"); }
+    remaining -= chunk;
+  }
+  char* data = reinterpret_cast<char*>(weights.first());
+  for (uint64_t read = 0; read < num_bytes; read += WEIGHT_ARRAY_CHUNK_BYTES)
+  {
+    const size_t chunk = static_cast<size_t>(std::min<uint64_t>(WEIGHT_ARRAY_CHUNK_BYTES, num_bytes - read));
+    if (model_file.bin_read_fixed(data + read, chunk) != chunk)
+    { THROW("Model content is corrupted, weight array is truncated"); }
+  }
+}
+
 std::string to_string(const VW::details::invert_hash_info& info)
 {
   std::ostringstream ss;
@@ -882,6 +1237,11 @@ void save_load_regressor(VW::workspace& all, io_buf& model_file, bool read, bool
       }
       if (brw > 0)
       {
+        if (is_weight_array_marker(all.num_bits, i))
+        {
+          read_weight_array(all, model_file, weights);
+          break;
+        }
         if (i >= length)
           THROW("Model content is corrupted, weight vector index " << i << " must be less than total vector length "
                                                                    << length);
@@ -892,9 +1252,9 @@ void save_load_regressor(VW::workspace& all, io_buf& model_file, bool read, bool
   }
   else  // write
   {
-    for (typename T::iterator v = weights.begin(); v != weights.end(); ++v)
-    {
-      if (*v != 0.)
+    // A delta snapshot also writes the zero weights of changed blocks, they may have been non zero before.
+    auto write_row = [&](typename T::iterator& v, bool write_zero) {
+      if (write_zero || *v != 0.)
       {
         i = v.index() >> weights.stride_shift();
         std::stringstream msg;
@@ -902,6 +1262,15 @@ void save_load_regressor(VW::workspace& all, io_buf& model_file, bool read, bool
         msg << ":" << *v << "\n";
         brw += bin_text_write_fixed(model_file, (char*)&(*v), sizeof(*v), msg, text);
       }
+    };
+    if (writes_weight_array(all, text)) { brw += write_weight_array(all, model_file, weights); }
+    else if (all.model_delta)
+    {
+      for_each_dirty_row(weights, [&](typename T::iterator& v) { write_row(v, true); });
+    }
+    else
+    {
+      for (typename T::iterator v = weights.begin(); v != weights.end(); ++v) { write_row(v, false); }
     }
   }
 }
@@ -941,6 +1310,11 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
       }
       if (brw > 0)
       {
+        if (is_weight_array_marker(all.num_bits, i))
+        {
+          read_weight_array(all, model_file, weights);
+          break;
+        }
         if (i >= length)
           THROW("Model content is corrupted, weight vector index " << i << " must be less than total vector length "
                                                                    << length);
@@ -967,8 +1341,8 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
   }
   else
   {  // write binary or text
-    for (typename T::iterator v = weights.begin(); v != weights.end(); ++v)
-    {
+    // A delta snapshot also writes the zero weights of changed blocks, they may have been non zero before.
+    auto write_row = [&](typename T::iterator& v, bool write_zero) {
       i = v.index() >> weights.stride_shift();
 
       if (all.print_invert)  // write readable model with feature names
@@ -986,7 +1360,7 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
 
       if (ftrl_size == 3)
       {
-        if (*v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0.)
+        if (write_zero || *v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0.)
         {
           brw = write_index(model_file, msg, text, all.num_bits, i);
           msg << ":" << *v << " " << (&(*v))[1] << " " << (&(*v))[2] << "\n";
@@ -995,7 +1369,7 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
       }
       else if (ftrl_size == 4)
       {
-        if (*v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0. || (&(*v))[3] != 0.)
+        if (write_zero || *v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0. || (&(*v))[3] != 0.)
         {
           brw = write_index(model_file, msg, text, all.num_bits, i);
           msg << ":" << *v << " " << (&(*v))[1] << " " << (&(*v))[2] << " " << (&(*v))[3] << "\n";
@@ -1004,8 +1378,8 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
       }
       else if (ftrl_size == 6)
       {
-        if (*v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0. || (&(*v))[3] != 0. || (&(*v))[4] != 0. ||
-            (&(*v))[5] != 0.)
+        if (write_zero || *v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0. || (&(*v))[3] != 0. ||
+            (&(*v))[4] != 0. || (&(*v))[5] != 0.)
         {
           brw = write_index(model_file, msg, text, all.num_bits, i);
           msg << ":" << *v << " " << (&(*v))[1] << " " << (&(*v))[2] << " " << (&(*v))[3] << " " << (&(*v))[4] << " "
@@ -1015,7 +1389,7 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
       }
       else if (g == nullptr || (!all.weights.adaptive && !all.weights.normalized))
       {
-        if (*v != 0.)
+        if (write_zero || *v != 0.)
         {
           brw = write_index(model_file, msg, text, all.num_bits, i);
           msg << ":" << *v << "\n";
@@ -1025,7 +1399,7 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
       else if ((all.weights.adaptive && !all.weights.normalized) || (!all.weights.adaptive && all.weights.normalized))
       {
         // either adaptive or normalized
-        if (*v != 0. || (&(*v))[1] != 0.)
+        if (write_zero || *v != 0. || (&(*v))[1] != 0.)
         {
           brw = write_index(model_file, msg, text, all.num_bits, i);
           msg << ":" << *v << " " << (&(*v))[1] << "\n";
@@ -1035,13 +1409,22 @@ void save_load_online_state_weights(VW::workspace& all, io_buf& model_file, bool
       else
       {
         // adaptive and normalized
-        if (*v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0.)
+        if (write_zero || *v != 0. || (&(*v))[1] != 0. || (&(*v))[2] != 0.)
         {
           brw = write_index(model_file, msg, text, all.num_bits, i);
           msg << ":" << *v << " " << (&(*v))[1] << " " << (&(*v))[2] << "\n";
           brw += bin_text_write_fixed(model_file, (char*)&(*v), 3 * sizeof(*v), msg, text);
         }
       }
+    };
+    if (writes_weight_array(all, text)) { brw += write_weight_array(all, model_file, weights); }
+    else if (all.model_delta)
+    {
+      for_each_dirty_row(weights, [&](typename T::iterator& v) { write_row(v, true); });
+    }
+    else
+    {
+      for (typename T::iterator v = weights.begin(); v != weights.end(); ++v) { write_row(v, false); }
     }
   }
 }
@@ -1079,13 +1462,15 @@ void save_load_online_state(VW::workspace& all, io_buf& model_file, bool read, b
     all.sd->dump_interval = dump_interval;
   }
 
-  msg << "min_label " << all.sd->min_label << "\n";
-  bin_text_read_write_fixed(
-      model_file, reinterpret_cast<char*>(&all.sd->min_label), sizeof(all.sd->min_label), read, msg, text);
+  float min_label = all.sd->min_label;
+  msg << "min_label " << min_label << "\n";
+  bin_text_read_write_fixed(model_file, reinterpret_cast<char*>(&min_label), sizeof(min_label), read, msg, text);
+  all.sd->min_label = min_label;
 
-  msg << "max_label " << all.sd->max_label << "\n";
-  bin_text_read_write_fixed(
-      model_file, reinterpret_cast<char*>(&all.sd->max_label), sizeof(all.sd->max_label), read, msg, text);
+  float max_label = all.sd->max_label;
+  msg << "max_label " << max_label << "\n";
+  bin_text_read_write_fixed(model_file, reinterpret_cast<char*>(&max_label), sizeof(max_label), read, msg, text);
+  all.sd->max_label = max_label;
 
   msg << "weighted_labeled_examples " << all.sd->weighted_labeled_examples << "\n";
   bin_text_read_write_fixed(model_file, reinterpret_cast<char*>(&all.sd->weighted_labeled_examples),
@@ -1190,7 +1575,8 @@ void save_load_online_state(VW::workspace& all, io_buf& model_file, bool read, b
 void save_load(gd& g, io_buf& model_file, bool read, bool text)
 {
   VW::workspace& all = *g.all;
-  if (read)
+  // A delta snapshot is read over the current weights.
+  if (read && !all.model_delta)
   {
     initialize_regressor(all);
 
@@ -1351,6 +1737,7 @@ base_learner* VW::reductions::gd_setup(VW::setup_base_i& stack_builder)
   all.sd->contraction = L2_STATE_DEFAULT;
   float local_gravity = 0;
   float local_contraction = 0;
+  bool quantization_report = false;
 
   option_group_definition new_options("[Reduction] Gradient Descent");
   new_options.add(make_option("sgd", sgd).help("Use regular stochastic gradient descent update").keep(all.save_resume))
@@ -1368,9 +1755,26 @@ base_learner* VW::reductions::gd_setup(VW::setup_base_i& stack_builder)
       .add(make_option("l2_state", local_contraction)
                .allow_override()
                .default_value(L2_STATE_DEFAULT)
-               .help("Amount of accumulated implicit l2 regularization"));
+               .help("Amount of accumulated implicit l2 regularization"))
+      .add(make_option("quantization_report", quantization_report)
+               .experimental()
+               .help("Report the size of the weights and the prediction error when they are stored as fp16, bf16 or "
+                     "int8. Requires -t and dense weights"));
   options.add_and_parse(new_options);
 
+  if (quantization_report)
+  {
+    if (all.training) { THROW("--quantization_report requires a predict only run, use -t"); }
+    if (all.weights.sparse) { THROW("--quantization_report is not supported with --sparse_weights"); }
+    for (auto quantization :
+        {VW::weight_quantization::fp16, VW::weight_quantization::bf16, VW::weight_quantization::int8})
+    {
+      GD::quantization_error error;
+      error.quantization = quantization;
+      g->quantization_errors.push_back(std::move(error));
+    }
+  }
+
   if (options.was_supplied("l1_state")) { all.sd->gravity = local_gravity; }
   if (options.was_supplied("l2_state")) { all.sd->contraction = local_contraction; }
 
@@ -1384,6 +1788,7 @@ base_learner* VW::reductions::gd_setup(VW::setup_base_i& stack_builder)
   all.weights.normalized = true;
   g->neg_norm_power = (all.weights.adaptive ? (all.power_t - 1.f) : -1.f);
   g->neg_power_t = -all.power_t;
+  g->concurrent_learn = all.learn_threads > 1;
 
   if (all.initial_t > 0)  // for the normalized update: if initial_t is bigger than 1 we interpret this as if we had
                           // seen (all.initial_t) previous fake datapoints all with norm 1
@@ -1454,22 +1859,26 @@ base_learner* VW::reductions::gd_setup(VW::setup_base_i& stack_builder)
     {
       g->predict = GD::predict<true, true>;
       g->multipredict = GD::multipredict<true, true>;
+      g->predict_batch = GD::predict_batch<true, true>;
     }
     else
     {
       g->predict = GD::predict<true, false>;
       g->multipredict = GD::multipredict<true, false>;
+      g->predict_batch = GD::predict_batch<true, false>;
     }
   }
   else if (all.audit || all.hash_inv)
   {
     g->predict = GD::predict<false, true>;
     g->multipredict = GD::multipredict<false, true>;
+    g->predict_batch = GD::predict_batch<false, true>;
   }
   else
   {
     g->predict = GD::predict<false, false>;
     g->multipredict = GD::multipredict<false, false>;
+    g->predict_batch = GD::predict_batch<false, false>;
   }
 
   uint64_t stride;
@@ -1488,10 +1897,12 @@ base_learner* VW::reductions::gd_setup(VW::setup_base_i& stack_builder)
                                         .set_params_per_weight(UINT64_ONE << all.weights.stride_shift())
                                         .set_sensitivity(bare->sensitivity)
                                         .set_multipredict(bare->multipredict)
+                                        .set_predict_batch(bare->predict_batch)
                                         .set_update(bare->update)
                                         .set_save_load(GD::save_load)
                                         .set_end_pass(GD::end_pass)
                                         .set_merge_with_all(GD::merge)
+                                        .set_finish(GD::finish)
                                         .build();
   return make_base(*l);
 }
@@ -309,7 +309,7 @@ void end_pass(gdmf& d)
   VW::workspace* all = d.all;
 
   all->eta *= all->eta_decay_rate;
-  if (all->save_per_pass) { save_predictor(*all, all->final_regressor_name, all->current_pass); }
+  if (all->save_per_pass) { save_pass_checkpoint(*all, all->final_regressor_name, all->current_pass); }
 
   if (!all->holdout_set_off)
   {
@@ -23,15 +23,22 @@
 #include "vw/core/vw_allreduce.h"
 #include "vw/io/logger.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
+#include <functional>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #define SVM_KER_LIN 0
 #define SVM_KER_RBF 1
@@ -46,20 +53,122 @@ namespace
 {
 struct svm_params;
 
-static size_t num_kernel_evals = 0;
-static size_t num_cache_evals = 0;
+// Rows shorter than this are always evaluated on the calling thread.
+constexpr size_t MIN_KERNELS_PER_THREAD = 1024;
 
 struct svm_example
 {
   VW::v_array<float> krow;
   VW::flat_example ex;
 
+  // Position in the kernel_cache recency list, only linked while this is a support vector.
+  svm_example* lru_prev;
+  svm_example* lru_next;
+  bool in_cache;
+
   ~svm_example();
   void init_svm_example(VW::flat_example* fec);
   int compute_kernels(svm_params& params);
   int clear_kernels();
 };
 
+// Accounts for the kernel rows of the support vectors and evicts the least recently used rows once they take up more
+// than budget_bytes. An evicted row is recomputed the next time it is needed.
+struct kernel_cache
+{
+  size_t budget_bytes = 0;
+  size_t used_bytes = 0;
+  svm_example* most_recent = nullptr;
+  svm_example* least_recent = nullptr;
+
+  uint64_t kernel_evals = 0;
+  uint64_t cache_hits = 0;
+  uint64_t evictions = 0;
+  // The legacy counters printed by the trace messages: kernel values reused when a row had to be extended, and when it
+  // was complete. Only kernel_evals and cache_hits are reported as metrics.
+  uint64_t num_kernel_evals = 0;
+  uint64_t num_cache_evals = 0;
+
+  // Marks the row of e as the most recently used one.
+  void touch(svm_example* e);
+  // Links the row of e as the first to be evicted.
+  void insert_least_recent(svm_example* e);
+  void unlink(svm_example* e);
+  // alloc is the change in the number of cached kernel values, as returned by the functions which modify rows.
+  void update_usage(int alloc);
+  void evict_to_budget();
+};
+
+// Threads started once for --kernel_threads which evaluate the parts of every kernel row after that.
+class kernel_thread_pool
+{
+public:
+  explicit kernel_thread_pool(size_t num_threads)
+  {
+    _workers.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; i++) { _workers.emplace_back([this] { work(); }); }
+  }
+
+  ~kernel_thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopping = true;
+    }
+    _work_available.notify_all();
+    for (auto& worker : _workers) { worker.join(); }
+  }
+
+  kernel_thread_pool(const kernel_thread_pool&) = delete;
+  kernel_thread_pool& operator=(const kernel_thread_pool&) = delete;
+
+  size_t size() const { return _workers.size() + 1; }
+
+  // Calls task with 0 to num_tasks - 1 and returns when every call finished. The calling thread runs task 0.
+  void run(size_t num_tasks, const std::function<void(size_t)>& task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _task = &task;
+      _next_task = 1;
+      _num_tasks = num_tasks;
+      _pending = num_tasks - 1;
+    }
+    _work_available.notify_all();
+    task(0);
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this] { return _pending == 0; });
+    _task = nullptr;
+  }
+
+private:
+  void work()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+      _work_available.wait(lock, [this] { return _stopping || _next_task < _num_tasks; });
+      if (_stopping) { return; }
+      const size_t task = _next_task++;
+      const auto& func = *_task;
+      lock.unlock();
+      func(task);
+      lock.lock();
+      if (--_pending == 0) { _done.notify_one(); }
+    }
+  }
+
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _work_available;
+  std::condition_variable _done;
+  const std::function<void(size_t)>* _task = nullptr;
+  size_t _next_task = 0;
+  size_t _num_tasks = 0;
+  size_t _pending = 0;
+  bool _stopping = false;
+};
+
 struct svm_model
 {
   size_t num_support;
@@ -104,8 +213,9 @@ struct svm_params
   uint64_t reprocess = 0;
 
   svm_model* model = nullptr;
-  size_t maxcache = 0;
-  // size_t curcache;
+  kernel_cache cache;
+  // Evaluates kernel rows with --kernel_threads, null when rows are evaluated on the learning thread alone.
+  std::unique_ptr<kernel_thread_pool> kernel_threads;
 
   svm_example** pool = nullptr;
   float lambda = 0.f;
@@ -145,31 +255,118 @@ svm_example::~svm_example()
   if (ex.tag_len > 0) { free(ex.tag); }
 }
 
+void kernel_cache::touch(svm_example* e)
+{
+  if (e == most_recent) { return; }
+  if (e->in_cache) { unlink(e); }
+  e->lru_prev = nullptr;
+  e->lru_next = most_recent;
+  if (most_recent != nullptr) { most_recent->lru_prev = e; }
+  most_recent = e;
+  if (least_recent == nullptr) { least_recent = e; }
+  e->in_cache = true;
+}
+
+void kernel_cache::insert_least_recent(svm_example* e)
+{
+  if (e->in_cache) { return; }
+  e->lru_next = nullptr;
+  e->lru_prev = least_recent;
+  if (least_recent != nullptr) { least_recent->lru_next = e; }
+  least_recent = e;
+  if (most_recent == nullptr) { most_recent = e; }
+  e->in_cache = true;
+}
+
+void kernel_cache::unlink(svm_example* e)
+{
+  if (!e->in_cache) { return; }
+  if (e->lru_prev != nullptr) { e->lru_prev->lru_next = e->lru_next; }
+  else
+  {
+    most_recent = e->lru_next;
+  }
+  if (e->lru_next != nullptr) { e->lru_next->lru_prev = e->lru_prev; }
+  else
+  {
+    least_recent = e->lru_prev;
+  }
+  e->lru_prev = nullptr;
+  e->lru_next = nullptr;
+  e->in_cache = false;
+}
+
+void kernel_cache::update_usage(int alloc)
+{
+  if (alloc >= 0) { used_bytes += static_cast<size_t>(alloc) * sizeof(float); }
+  else
+  {
+    used_bytes -= std::min(used_bytes, static_cast<size_t>(-alloc) * sizeof(float));
+  }
+}
+
+void kernel_cache::evict_to_budget()
+{
+  while (used_bytes > budget_bytes && least_recent != nullptr)
+  {
+    svm_example* e = least_recent;
+    unlink(e);
+    update_usage(e->clear_kernels());
+    evictions++;
+  }
+}
+
 float kernel_function(const VW::flat_example* fec1, const VW::flat_example* fec2, void* params, size_t kernel_type);
 
+// Evaluates the kernel between ex and the support vectors [begin, end) into row, split over the kernel threads.
+void compute_kernel_row(svm_params& params, const VW::flat_example& ex, size_t begin, size_t end, float* row)
+{
+  const auto& support_vec = params.model->support_vec;
+  auto evaluate = [&](size_t first, size_t last)
+  {
+    for (size_t i = first; i < last; i++)
+    { row[i] = kernel_function(&ex, &(support_vec[i]->ex), params.kernel_params, params.kernel_type); }
+  };
+
+  const size_t num_threads = params.kernel_threads == nullptr
+      ? 1
+      : std::min(params.kernel_threads->size(), (end - begin) / MIN_KERNELS_PER_THREAD);
+  if (num_threads <= 1)
+  {
+    evaluate(begin, end);
+    return;
+  }
+
+  const size_t chunk = (end - begin + num_threads - 1) / num_threads;
+  params.kernel_threads->run(num_threads,
+      [&](size_t t)
+      {
+        const size_t first = begin + t * chunk;
+        evaluate(first, std::min(end, first + chunk));
+      });
+}
+
 int svm_example::compute_kernels(svm_params& params)
 {
   int alloc = 0;
   svm_model* model = params.model;
   size_t n = model->num_support;
+  const size_t cached = krow.size();
 
-  if (krow.size() < n)
+  if (cached < n)
   {
     // computing new kernel values and caching them
-    // if(params->curcache + n > params->maxcache)
-    // trim_cache(params);
-    num_kernel_evals += krow.size();
-    for (size_t i = krow.size(); i < n; i++)
-    {
-      svm_example* sec = model->support_vec[i];
-      float kv = kernel_function(&ex, &(sec->ex), params.kernel_params, params.kernel_type);
-      krow.push_back(kv);
-      alloc += 1;
-    }
+    params.cache.num_kernel_evals += cached;
+    params.cache.cache_hits += cached;
+    params.cache.kernel_evals += n - cached;
+    krow.resize_but_with_stl_behavior(n);
+    compute_kernel_row(params, ex, cached, n, krow.begin());
+    alloc += static_cast<int>(n - cached);
   }
   else
   {
-    num_cache_evals += n;
+    params.cache.num_cache_evals += n;
+    params.cache.cache_hits += n;
   }
   return alloc;
 }
@@ -178,6 +375,7 @@ int svm_example::clear_kernels()
 {
   int rowsize = static_cast<int>(krow.size());
   krow.clear();
+  krow.shrink_to_fit();
   return -rowsize;
 }
 
@@ -189,6 +387,7 @@ static int make_hot_sv(svm_params& params, size_t svi)
   // rotate params fields
   svm_example* svi_e = model->support_vec[svi];
   int alloc = svi_e->compute_kernels(params);
+  params.cache.touch(svi_e);
   float svi_alpha = model->alpha[svi];
   float svi_delta = model->delta[svi];
   for (size_t i = svi; i > 0; --i)
@@ -216,6 +415,7 @@ static int make_hot_sv(svm_params& params, size_t svi)
       float kv = svi_e->krow[j];
       e->krow.push_back(0);
       alloc += 1;
+      params.cache.insert_least_recent(e);
       for (size_t i = e->krow.size() - 1; i > 0; --i) { e->krow[i] = e->krow[i - 1]; }
       e->krow[0] = kv;
     }
@@ -223,21 +423,6 @@ static int make_hot_sv(svm_params& params, size_t svi)
   return alloc;
 }
 
-static int trim_cache(svm_params& params)
-{
-  int sz = static_cast<int>(params.maxcache);
-  svm_model* model = params.model;
-  size_t n = model->num_support;
-  int alloc = 0;
-  for (size_t i = 0; i < n; i++)
-  {
-    svm_example* e = model->support_vec[i];
-    sz -= static_cast<int>(e->krow.size());
-    if (sz < 0) { alloc += e->clear_kernels(); }
-  }
-  return alloc;
-}
-
 void save_load_svm_model(svm_params& params, io_buf& model_file, bool read, bool text)
 {
   svm_model* model = params.model;
@@ -286,30 +471,52 @@ void save_load(svm_params& params, io_buf& model_file, bool read, bool text)
   save_load_svm_model(params, model_file, read, text);
 }
 
+// Both feature groups are sorted by index. Matching products are summed in index order.
 float linear_kernel(const VW::flat_example* fec1, const VW::flat_example* fec2)
 {
-  float dotprod = 0;
+  const features& fs_1 = fec1->fs;
+  const features& fs_2 = fec2->fs;
+  const size_t size_1 = fs_1.size();
+  const size_t size_2 = fs_2.size();
+  if (size_1 == 0 || size_2 == 0) { return 0.f; }
 
-  features& fs_1 = const_cast<features&>(fec1->fs);
-  features& fs_2 = const_cast<features&>(fec2->fs);
-  if (fs_2.indices.size() == 0) { return 0.f; }
+  const feature_index* indices_1 = fs_1.indices.begin();
+  const feature_index* indices_2 = fs_2.indices.begin();
+  const feature_value* values_1 = fs_1.values.begin();
+  const feature_value* values_2 = fs_2.values.begin();
 
-  int numint = 0;
-  for (size_t idx1 = 0, idx2 = 0; idx1 < fs_1.size() && idx2 < fs_2.size(); idx1++)
+  float dotprod = 0;
+  // When one example is much sparser than the other, binary search its features in the denser one.
+  if (size_1 * 16 < size_2 || size_2 * 16 < size_1)
   {
-    uint64_t ec1pos = fs_1.indices[idx1];
-    uint64_t ec2pos = fs_2.indices[idx2];
-    // params.all->opts_n_args.trace_message<<ec1pos<<" "<<ec2pos<<" "<<idx1<<" "<<idx2<<" "<<f->x<<" "<<ec2f->x<< endl;
-    if (ec1pos < ec2pos) { continue; }
-
-    while (ec1pos > ec2pos && ++idx2 < fs_2.size()) { ec2pos = fs_2.indices[idx2]; }
-
-    if (ec1pos == ec2pos)
+    const bool first_is_sparse = size_1 < size_2;
+    const feature_index* sparse_indices = first_is_sparse ? indices_1 : indices_2;
+    const feature_value* sparse_values = first_is_sparse ? values_1 : values_2;
+    const size_t sparse_size = first_is_sparse ? size_1 : size_2;
+    const feature_index* dense_begin = first_is_sparse ? indices_2 : indices_1;
+    const feature_index* dense_end = dense_begin + (first_is_sparse ? size_2 : size_1);
+    const feature_value* dense_values = first_is_sparse ? values_2 : values_1;
+
+    const feature_index* pos = dense_begin;
+    for (size_t i = 0; i < sparse_size && pos != dense_end; i++)
     {
-      numint++;
-      dotprod += fs_1.values[idx1] * fs_2.values[idx2];
-      ++idx2;
+      pos = std::lower_bound(pos, dense_end, sparse_indices[i]);
+      if (pos != dense_end && *pos == sparse_indices[i])
+      { dotprod += sparse_values[i] * dense_values[pos - dense_begin]; }
     }
+    return dotprod;
+  }
+
+  size_t idx1 = 0;
+  size_t idx2 = 0;
+  while (idx1 < size_1 && idx2 < size_2)
+  {
+    const feature_index ec1pos = indices_1[idx1];
+    const feature_index ec2pos = indices_2[idx2];
+    if (ec1pos == ec2pos) { dotprod += values_1[idx1] * values_2[idx2]; }
+    // Advance without branching on which of the two is smaller.
+    idx1 += static_cast<size_t>(ec1pos <= ec2pos);
+    idx2 += static_cast<size_t>(ec2pos <= ec1pos);
   }
   return dotprod;
 }
@@ -409,6 +616,8 @@ int remove(svm_params& params, size_t svi)
   if (svi >= model->num_support) { params.all->logger.err_error("Internal error at {}:{}", __FILE__, __LINE__); }
   // shift params fields
   svm_example* svi_e = model->support_vec[svi];
+  int alloc = -static_cast<int>(svi_e->krow.size());
+  params.cache.unlink(svi_e);
   for (size_t i = svi; i < model->num_support - 1; ++i)
   {
     model->support_vec[i] = model->support_vec[i + 1];
@@ -422,7 +631,6 @@ int remove(svm_params& params, size_t svi)
   model->delta.pop_back();
   model->num_support--;
   // shift cache
-  int alloc = 0;
   for (size_t j = 0; j < model->num_support; j++)
   {
     svm_example* e = model->support_vec[j];
@@ -442,6 +650,8 @@ int add(svm_params& params, svm_example* fec)
   svm_model* model = params.model;
   model->num_support++;
   model->support_vec.push_back(fec);
+  params.cache.update_usage(static_cast<int>(fec->krow.size()));
+  params.cache.touch(fec);
   model->alpha.push_back(0.);
   model->delta.push_back(0.);
   return static_cast<int>(model->support_vec.size() - 1);
@@ -453,7 +663,8 @@ bool update(svm_params& params, size_t pos)
   bool overshoot = false;
   svm_example* fec = model->support_vec[pos];
   label_data& ld = fec->ex.l.simple;
-  fec->compute_kernels(params);
+  params.cache.update_usage(fec->compute_kernels(params));
+  params.cache.touch(fec);
   float* inprods = fec->krow.begin();
   float alphaKi = dense_dot(inprods, model->alpha, model->num_support);
   model->delta[pos] = alphaKi * ld.label / params.lambda - 1;
@@ -488,7 +699,7 @@ bool update(svm_params& params, size_t pos)
     model->delta[i] += diff * inprods[i] * ldi.label / params.lambda;
   }
 
-  if (std::fabs(ai) <= 1.0e-10) { remove(params, pos); }
+  if (std::fabs(ai) <= 1.0e-10) { params.cache.update_usage(remove(params, pos)); }
   else
   {
     model->alpha[pos] = ai;
@@ -655,7 +866,8 @@ void train(svm_params& params)
             {
               if (!overshoot && max_pos == static_cast<size_t>(model_pos) && max_pos > 0 && j == 0)
               { *params.all->trace_message << "Shouldn't reprocess right after process." << endl; }
-              if (max_pos * model->num_support <= params.maxcache) { make_hot_sv(params, max_pos); }
+              if (max_pos * model->num_support * sizeof(float) <= params.cache.budget_bytes)
+              { params.cache.update_usage(make_hot_sv(params, max_pos)); }
               update(params, max_pos);
             }
           }
@@ -691,12 +903,13 @@ void learn(svm_params& params, base_learner&, VW::example& ec)
     ec.pred.scalar = score;
     ec.loss = std::max(0.f, 1.f - score * ec.l.simple.label);
     params.loss_sum += ec.loss;
-    if (params.all->training && ec.example_counter % 100 == 0) { trim_cache(params); }
+    if (params.all->training) { params.cache.evict_to_budget(); }
     if (params.all->training && ec.example_counter % 1000 == 0 && ec.example_counter >= 2)
     {
       *params.all->trace_message << "Number of support vectors = " << params.model->num_support << endl;
-      *params.all->trace_message << "Number of kernel evaluations = " << num_kernel_evals << " "
-                                 << "Number of cache queries = " << num_cache_evals << " loss sum = " << params.loss_sum
+      *params.all->trace_message << "Number of kernel evaluations = " << params.cache.num_kernel_evals << " "
+                                 << "Number of cache queries = " << params.cache.num_cache_evals
+                                 << " loss sum = " << params.loss_sum
                                  << " " << params.model->alpha[params.model->num_support - 1] << " "
                                  << params.model->alpha[params.model->num_support - 2] << endl;
     }
@@ -716,11 +929,20 @@ void finish_kernel_svm(svm_params& params)
   if (params.all != nullptr)
   {
     *(params.all->trace_message) << "Num support = " << params.model->num_support << endl;
-    *(params.all->trace_message) << "Number of kernel evaluations = " << num_kernel_evals << " "
-                                 << "Number of cache queries = " << num_cache_evals << endl;
+    *(params.all->trace_message) << "Number of kernel evaluations = " << params.cache.num_kernel_evals << " "
+                                 << "Number of cache queries = " << params.cache.num_cache_evals << endl;
     *(params.all->trace_message) << "Total loss = " << params.loss_sum << endl;
   }
 }
+
+void persist_metrics(svm_params& params, VW::metric_sink& metrics)
+{
+  metrics.set_uint("ksvm_num_support", params.model->num_support);
+  metrics.set_uint("ksvm_kernel_evals", params.cache.kernel_evals);
+  metrics.set_uint("ksvm_cache_hits", params.cache.cache_hits);
+  metrics.set_uint("ksvm_cache_evictions", params.cache.evictions);
+  metrics.set_uint("ksvm_cache_bytes", params.cache.used_bytes);
+}
 }  // namespace
 
 VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& stack_builder)
@@ -735,6 +957,8 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
   uint64_t pool_size;
   uint64_t reprocess;
   uint64_t subsample;
+  uint64_t cache_mb;
+  uint64_t kernel_threads;
 
   bool ksvm = false;
 
@@ -751,13 +975,28 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
                .one_of({"linear", "rbf", "poly"})
                .help("Type of kernel"))
       .add(make_option("bandwidth", bandwidth).keep().default_value(1.f).help("Bandwidth of rbf kernel"))
-      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"));
+      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"))
+      .add(make_option("kernel_cache_mb", cache_mb)
+               .default_value(4096)
+               .experimental()
+               .help("Memory budget in MiB for the cached kernel rows of the support vectors. Least recently used "
+                     "rows are evicted first"))
+      .add(make_option("kernel_threads", kernel_threads)
+               .default_value(1)
+               .experimental()
+               .help("Number of threads used to evaluate the kernels of an example against the support vectors"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
   params->pool_size = VW::cast_to_smaller_type<size_t>(pool_size);
   params->reprocess = VW::cast_to_smaller_type<size_t>(reprocess);
   params->subsample = VW::cast_to_smaller_type<size_t>(subsample);
+  if (kernel_threads == 0) { THROW("--kernel_threads must be at least 1") }
+  if (kernel_threads > 1)
+  { params->kernel_threads = VW::make_unique<kernel_thread_pool>(VW::cast_to_smaller_type<size_t>(kernel_threads)); }
+  params->cache.budget_bytes = cache_mb >= (std::numeric_limits<size_t>::max() >> 20)
+      ? std::numeric_limits<size_t>::max()
+      : static_cast<size_t>(cache_mb << 20);
 
   std::string loss_function = "hinge";
   float loss_parameter = 0.0;
@@ -766,7 +1005,6 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
   params->model = &calloc_or_throw<svm_model>();
   new (params->model) svm_model();
   params->model->num_support = 0;
-  params->maxcache = 1024 * 1024 * 1024;
   params->loss_sum = 0.;
   params->all = &all;
   params->_random_state = all.get_random_state();
@@ -813,6 +1051,7 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
       VW::prediction_type_t::scalar, VW::label_type_t::simple)
                 .set_save_load(save_load)
                 .set_finish(finish_kernel_svm)
+                .set_persist_metrics(persist_metrics)
                 .build();
 
   return make_base(*l);
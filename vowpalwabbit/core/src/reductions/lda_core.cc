@@ -1338,8 +1338,9 @@ base_learner* VW::reductions::lda_setup(VW::setup_base_i& stack_builder)
   if (minibatch2 > all.example_parser->example_queue_limit)
   {
     bool previous_strict_parse = all.example_parser->strict_parse;
+    auto previous_queue_mode = all.example_parser->ready_parsed_examples.mode();
     delete all.example_parser;
-    all.example_parser = new parser{minibatch2, previous_strict_parse};
+    all.example_parser = new parser{minibatch2, previous_strict_parse, previous_queue_mode};
     all.example_parser->_shared_data = all.sd;
   }
 
@@ -10,10 +10,15 @@
 #include "vw/core/global_data.h"
 #include "vw/core/learner.h"
 #include "vw/core/parser.h"
+#include "vw/core/reduction_profiler.h"
 #include "vw/core/scope_exit.h"
 #include "vw/core/setup_base.h"
 #include "vw/io/logger.h"
 
+#ifdef VW_BUILD_SIMDJSON
+#  include "vw/core/parse_example_simdjson.h"
+#endif
+
 #include <rapidjson/filewritestream.h>
 #include <rapidjson/writer.h>
 
@@ -55,6 +60,55 @@ void insert_dsjson_metrics(
   }
 }
 
+void insert_queue_metrics(const VW::ptr_queue<VW::example>& queue, VW::metric_sink& metrics)
+{
+  // Occupancy counters are only collected by the lock-free queue.
+  if (queue.mode() != VW::queue_mode::spsc) { return; }
+
+  const auto stats = queue.stats();
+  metrics.set_uint("example_queue_push_count", stats.push_count);
+  metrics.set_uint("example_queue_pop_count", stats.pop_count);
+  metrics.set_uint("example_queue_full_waits", stats.full_waits);
+  metrics.set_uint("example_queue_empty_waits", stats.empty_waits);
+  metrics.set_uint("example_queue_max_occupancy", stats.max_occupancy);
+  metrics.set_float("example_queue_mean_occupancy",
+      stats.push_count == 0 ? 0.f
+                            : static_cast<float>(static_cast<double>(stats.occupancy_sum) / stats.push_count));
+}
+
+void insert_example_pool_metrics(const VW::details::example_pool& pool, VW::metric_sink& metrics)
+{
+  const auto stats = pool.stats();
+  metrics.set_uint("example_pool_size", pool.size());
+  metrics.set_uint("example_pool_get_count", stats.get_count);
+  metrics.set_uint("example_pool_cache_hits", stats.cache_hits);
+  metrics.set_uint("example_pool_cache_misses", stats.cache_misses);
+  metrics.set_uint("example_pool_chunk_allocations", stats.chunk_allocations);
+  metrics.set_uint("example_pool_return_count", stats.return_count);
+  metrics.set_uint("example_pool_batch_returns", stats.batch_returns);
+}
+
+void insert_feature_hash_cache_metrics(const parser& p, VW::metric_sink& metrics)
+{
+  if (p.hash_cache == nullptr) { return; }
+
+  const auto stats = p.hash_cache_stats();
+  metrics.set_uint("feature_hash_cache_hits", stats.hits);
+  metrics.set_uint("feature_hash_cache_misses", stats.misses);
+  metrics.set_uint("feature_hash_cache_evictions", stats.evictions);
+  metrics.set_uint("feature_hash_cache_uncacheable", stats.uncacheable);
+}
+
+void insert_json_parser_metrics(const parser& p, VW::metric_sink& metrics)
+{
+#ifdef VW_BUILD_SIMDJSON
+  if (p.simdjson_parser != nullptr) { metrics.set_uint("json_parser_fallbacks", p.simdjson_parser->fallback_count()); }
+#else
+  _UNUSED(p);
+  _UNUSED(metrics);
+#endif
+}
+
 struct metrics_data
 {
   std::string out_file;
@@ -148,6 +202,17 @@ void VW::reductions::output_metrics(VW::workspace& all)
     std::vector<std::string> enabled_reductions;
     if (all.l != nullptr) { all.l->get_enabled_reductions(enabled_reductions); }
     insert_dsjson_metrics(all.example_parser->metrics.get(), list_metrics, enabled_reductions);
+    // These depend on thread timing, on the cache size or on the JSON parser, so they are opt-in to keep the metrics
+    // output the same across runs and settings by default.
+    if (all.options->was_supplied("example_queue_metrics"))
+    { insert_queue_metrics(all.example_parser->ready_parsed_examples, list_metrics); }
+    if (all.options->was_supplied("example_pool_metrics"))
+    { insert_example_pool_metrics(all.example_parser->example_pool, list_metrics); }
+    if (all.options->was_supplied("feature_hash_cache_metrics"))
+    { insert_feature_hash_cache_metrics(*all.example_parser, list_metrics); }
+    if (all.options->was_supplied("json_parser_metrics"))
+    { insert_json_parser_metrics(*all.example_parser, list_metrics); }
+    if (all.profiler != nullptr) { all.profiler->persist_metrics(list_metrics); }
 
     list_to_json_file(filename, list_metrics, all.logger);
   }
@@ -157,11 +222,29 @@ VW::LEARNER::base_learner* VW::reductions::metrics_setup(VW::setup_base_i& stack
 {
   options_i& options = *stack_builder.get_options();
   auto data = VW::make_unique<metrics_data>();
+  bool example_queue_metrics = false;
+  bool example_pool_metrics = false;
+  bool feature_hash_cache_metrics = false;
+  bool json_parser_metrics = false;
 
   option_group_definition new_options("[Reduction] Debug Metrics");
-  new_options.add(make_option("extra_metrics", data->out_file)
-                      .necessary()
-                      .help("Specify filename to write metrics to. Note: There is no fixed schema"));
+  new_options
+      .add(make_option("extra_metrics", data->out_file)
+               .necessary()
+               .help("Specify filename to write metrics to. Note: There is no fixed schema"))
+      .add(make_option("example_queue_metrics", example_queue_metrics)
+               .help("Include example queue wait counts and occupancy in extra_metrics. Only collected with "
+                     "--example_queue_type spsc")
+               .experimental())
+      .add(make_option("example_pool_metrics", example_pool_metrics)
+               .help("Include example pool cache hit and miss counts in extra_metrics")
+               .experimental())
+      .add(make_option("feature_hash_cache_metrics", feature_hash_cache_metrics)
+               .help("Include feature hash cache hit, miss and eviction counts in extra_metrics")
+               .experimental())
+      .add(make_option("json_parser_metrics", json_parser_metrics)
+               .help("Include the number of lines --json_parser simdjson left to rapidjson in extra_metrics")
+               .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
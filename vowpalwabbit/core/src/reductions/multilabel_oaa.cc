@@ -15,6 +15,7 @@
 
 #include <cfloat>
 #include <sstream>
+#include <vector>
 
 using namespace VW::config;
 
@@ -25,6 +26,7 @@ struct multi_oaa
   size_t k = 0;
   bool probabilities = false;
   std::string link = "";
+  std::vector<VW::polyprediction> pred;  // for multipredict
   VW::io::logger logger;
 
   explicit multi_oaa(VW::io::logger logger) : logger(std::move(logger)) {}
@@ -39,9 +41,13 @@ void predict_or_learn(multi_oaa& o, VW::LEARNER::single_learner& base, VW::examp
 
   ec.l.simple = {FLT_MAX};
   ec._reduction_features.template get<simple_label_reduction_features>().reset_to_default();
+  // All k scores are computed with a single pass over the features when only predicting.
+  if (!is_learn) { base.multipredict(ec, 0, o.k, o.pred.data(), true); }
+
   uint32_t multilabel_index = 0;
   for (uint32_t i = 0; i < o.k; i++)
   {
+    float score;
     if (is_learn)
     {
       ec.l.simple.label = -1.f;
@@ -51,14 +57,14 @@ void predict_or_learn(multi_oaa& o, VW::LEARNER::single_learner& base, VW::examp
         multilabel_index++;
       }
       base.learn(ec, i);
+      score = ec.pred.scalar;
     }
     else
     {
-      base.predict(ec, i);
+      score = o.pred[i].scalar;
     }
-    if ((o.link == "logistic" && ec.pred.scalar > 0.5) || (o.link != "logistic" && ec.pred.scalar > 0.0))
-    { preds.label_v.push_back(i); }
-    if (o.probabilities) { ec.pred.scalars.push_back(std::move(ec.pred.scalar)); }
+    if ((o.link == "logistic" && score > 0.5) || (o.link != "logistic" && score > 0.0)) { preds.label_v.push_back(i); }
+    if (o.probabilities) { ec.pred.scalars.push_back(score); }
   }
   if (is_learn)
   {
@@ -118,6 +124,7 @@ VW::LEARNER::base_learner* VW::reductions::multilabel_oaa_setup(VW::setup_base_i
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
   data->k = VW::cast_to_smaller_type<size_t>(k);
+  data->pred.resize(data->k);
   std::string name_addition;
   VW::prediction_type_t pred_type;
   size_t ws = data->k;
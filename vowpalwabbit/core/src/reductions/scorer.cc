@@ -27,6 +27,18 @@ struct scorer
   VW::workspace* all;
 };  // for set_minmax, loss
 
+template <float (*link)(float in)>
+void apply_link(scorer& s, VW::example& ec)
+{
+  if (ec.weight > 0 && ec.l.simple.label != FLT_MAX)
+  { ec.loss = s.all->loss->get_loss(s.all->sd, ec.pred.scalar, ec.l.simple.label) * ec.weight; }
+
+  ec.pred.scalar = link(ec.pred.scalar);
+  VW_DBG(ec) << "ex#= " << ec.example_counter << ", offset=" << ec.ft_offset << ", lbl=" << ec.l.simple.label
+             << ", pred= " << ec.pred.scalar << ", wt=" << ec.weight << ", gd.raw=" << ec.partial_prediction
+             << ", loss=" << ec.loss << std::endl;
+}
+
 template <bool is_learn, float (*link)(float in)>
 void predict_or_learn(scorer& s, VW::LEARNER::single_learner& base, VW::example& ec)
 {
@@ -40,13 +52,14 @@ void predict_or_learn(scorer& s, VW::LEARNER::single_learner& base, VW::example&
     base.predict(ec);
   }
 
-  if (ec.weight > 0 && ec.l.simple.label != FLT_MAX)
-  { ec.loss = s.all->loss->get_loss(s.all->sd, ec.pred.scalar, ec.l.simple.label) * ec.weight; }
+  apply_link<link>(s, ec);
+}
 
-  ec.pred.scalar = link(ec.pred.scalar);
-  VW_DBG(ec) << "ex#= " << ec.example_counter << ", offset=" << ec.ft_offset << ", lbl=" << ec.l.simple.label
-             << ", pred= " << ec.pred.scalar << ", wt=" << ec.weight << ", gd.raw=" << ec.partial_prediction
-             << ", loss=" << ec.loss << std::endl;
+template <float (*link)(float in)>
+void predict_batch(scorer& s, VW::LEARNER::single_learner& base, VW::example** examples, size_t count)
+{
+  base.predict_batch(examples, count);
+  for (size_t i = 0; i < count; i++) { apply_link<link>(s, *examples[i]); }
 }
 
 template <float (*link)(float in)>
@@ -94,7 +107,9 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
   using predict_or_learn_fn_t = void (*)(scorer&, VW::LEARNER::single_learner&, VW::example&);
   using multipredict_fn_t =
       void (*)(scorer&, VW::LEARNER::single_learner&, VW::example&, size_t, size_t, VW::polyprediction*, bool);
+  using predict_batch_fn_t = void (*)(scorer&, VW::LEARNER::single_learner&, VW::example**, size_t);
   multipredict_fn_t multipredict_f = multipredict<id>;
+  predict_batch_fn_t predict_batch_f = predict_batch<id>;
   predict_or_learn_fn_t learn_fn;
   predict_or_learn_fn_t predict_fn;
   std::string name = stack_builder.get_setupfn_name(scorer_setup);
@@ -111,6 +126,7 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
     predict_fn = predict_or_learn<false, logistic>;
     name += "-logistic";
     multipredict_f = multipredict<logistic>;
+    predict_batch_f = predict_batch<logistic>;
   }
   else if (link == "glf1")
   {
@@ -118,6 +134,7 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
     predict_fn = predict_or_learn<false, glf1>;
     name += "-glf1";
     multipredict_f = multipredict<glf1>;
+    predict_batch_f = predict_batch<glf1>;
   }
   else if (link == "poisson")
   {
@@ -125,6 +142,7 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
     predict_fn = predict_or_learn<false, expf>;
     name += "-poisson";
     multipredict_f = multipredict<expf>;
+    predict_batch_f = predict_batch<expf>;
   }
   else
   {
@@ -139,6 +157,7 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
                 .set_input_label_type(VW::label_type_t::simple)
                 .set_output_prediction_type(VW::prediction_type_t::scalar)
                 .set_multipredict(multipredict_f)
+                .set_predict_batch(predict_batch_f)
                 .set_update(update)
                 .build();
 
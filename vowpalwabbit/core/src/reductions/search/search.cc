@@ -5,6 +5,7 @@
 
 #include "vw/common/text_utils.h"
 #include "vw/common/vw_exception.h"
+#include "vw/config/cli_options_serializer.h"
 #include "vw/core/crossplat_compat.h"
 #include "vw/core/label_dictionary.h"
 #include "vw/core/named_labels.h"
@@ -28,10 +29,16 @@
 #include "vw/io/logger.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cfloat>
 #include <cmath>
+#include <condition_variable>
 #include <cstring>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 // needed for printing ranges of objects (eg: all elements of a vector)
 #include <fmt/ranges.h>
 
@@ -140,6 +147,58 @@ std::ostream& operator<<(std::ostream& os, const action_cache& x)
   return os;
 }
 
+// The outcome of rolling out every action at one timestep, which is learned from once all timesteps are rolled out.
+struct rollout_result
+{
+  VW::polylabel losses;
+  std::vector<VW::example> learn_ec;
+  size_t learn_learner_id = 0;
+  VW::v_array<ptag> learn_condition_on;
+  std::vector<action_repr> learn_condition_on_act;
+  VW::v_array<char> learn_condition_on_names;
+};
+
+// Rolls out the timesteps of an example on several threads for --search_rollout_threads. Each worker thread has its own
+// workspace, seeded from the main one: it predicts with the same weights but has its own learner stack, task data and
+// search state. The calling thread rolls out timesteps too, with the main search state. The weights must not change
+// while run() executes, the updates from the rollouts are made afterwards.
+class rollout_executor
+{
+public:
+  rollout_executor(VW::workspace& all, size_t num_workers);
+  ~rollout_executor();
+
+  // Fills results with the rollouts of every timestep in the order of sch.priv->timesteps.
+  void run(search& sch, VW::multi_ex& ec_seq, std::vector<rollout_result>& results);
+
+private:
+  struct worker
+  {
+    VW::workspace* all = nullptr;
+    search* sch = nullptr;
+    // copies of the example being learned, see prepare()
+    std::vector<VW::example> examples;
+    VW::multi_ex ec_seq;
+  };
+
+  void prepare(search_private& priv, const VW::multi_ex& ec_seq, worker& w);
+  void rollout_timesteps(search& sch, VW::multi_ex& ec_seq);
+  void work(worker& w);
+
+  std::vector<std::unique_ptr<worker>> _workers;
+  std::vector<std::thread> _threads;
+  std::mutex _mutex;
+  std::condition_variable _start;
+  std::condition_variable _done;
+  uint64_t _generation = 0;
+  size_t _running = 0;
+  bool _stop = false;
+  std::atomic<size_t> _next_timestep{0};
+  const VW::v_array<size_t>* _timesteps = nullptr;
+  std::vector<rollout_result>* _results = nullptr;
+  std::exception_ptr _exception;
+};
+
 void clear_memo_foreach_action(search_private& priv);
 
 struct search_private
@@ -303,6 +362,10 @@ public:
   VW::v_array<VW::v_array<action_cache>*>
       memo_foreach_action;  // when foreach_action is on, we need to cache TRAIN trajectory actions for LEARN
 
+  size_t rollout_threads = 1;                        // value of --search_rollout_threads
+  std::unique_ptr<rollout_executor> rollout_workers;  // started when the first example is learned
+  std::vector<rollout_result> rollout_results;
+
   ~search_private()
   {
     if (all)
@@ -2149,6 +2212,297 @@ void advance_from_known_actions(search_private& priv)
   advance_from_known_actions(priv);
 }
 
+// Rolls out every action at timestep learn_t. Their losses are left in priv.learn_losses and the example(s) to learn
+// from in priv.learn_ec_ref.
+void rollout_timestep(search& sch, VW::multi_ex& ec_seq, size_t learn_t)
+{
+  search_private& priv = *sch.priv;
+  priv.learn_ec_ref = nullptr;
+  priv.learn_ec_ref_cnt = 0;
+
+  reset_search_structure(priv);  // TODO remove this?
+  bool skipped_all_actions = true;
+  priv.learn_a_idx = 0;
+  priv.done_with_all_actions = false;
+  // for each action, roll out to get a loss
+  while (!priv.done_with_all_actions)
+  {
+    priv.learn_t = learn_t;
+    advance_from_known_actions(priv);
+    if (priv.done_with_all_actions) { break; }
+
+    skipped_all_actions = false;
+    reset_search_structure(priv);
+
+    priv.state = SearchState::LEARN;
+    priv.learn_t = learn_t;
+    cdbg << "-------------------------------------------------------------------------------------" << endl;
+    cdbg << "learn_t = " << priv.learn_t << ", learn_a_idx = " << priv.learn_a_idx << endl;
+    run_task(sch, ec_seq);
+    float this_loss = priv.learn_loss;
+    cs_cost_push_back(priv.cb_learner, priv.learn_losses,
+        priv.is_ldf ? static_cast<uint32_t>(priv.learn_a_idx - 1) : static_cast<uint32_t>(priv.learn_a_idx),
+        this_loss);
+    //                          (priv.learn_allowed_actions.size() > 0) ?
+    //                          priv.learn_allowed_actions[priv.learn_a_idx-1] : priv.is_ldf ? (priv.learn_a_idx-1) :
+    //                          (priv.learn_a_idx),
+    //                           priv.learn_loss);
+  }
+  if (priv.active_csoaa_verify > 0.)
+  {
+    verify_active_csoaa(priv.learn_losses.cs, priv.active_known[priv.learn_t], ec_seq[0]->example_counter,
+        priv.active_csoaa_verify, priv.all->logger);
+  }
+
+  if (skipped_all_actions)
+  {
+    reset_search_structure(priv);
+    priv.state = SearchState::LEARN;
+    priv.learn_t = learn_t;
+    priv.force_setup_ec_ref = true;
+    cdbg << "<<<<<" << endl;
+    cdbg << "skipped all actions; learn_t = " << priv.learn_t << ", learn_a_idx = " << priv.learn_a_idx << endl;
+    run_task(sch, ec_seq);  // TODO: i guess we can break out of this early
+    cdbg << ">>>>>" << endl;
+  }
+  else
+    cdbg << "didn't skip all actions" << endl;
+
+  // now we can make a training example
+  if (priv.learn_allowed_actions.size() > 0)
+  {
+    for (size_t i = 0; i < priv.learn_allowed_actions.size(); i++)
+    { priv.learn_losses.cs.costs[i].class_index = priv.learn_allowed_actions[i]; }
+  }
+}
+
+// Moves what learning from the rollouts at the current timestep needs out of priv.
+void take_rollout_result(search_private& priv, rollout_result& result)
+{
+  std::swap(result.losses, priv.learn_losses);
+  if (priv.cb_learner) { priv.learn_losses.cb.costs.clear(); }
+  else
+  {
+    priv.learn_losses.cs.costs.clear();
+  }
+
+  if (priv.learn_ec_ref == priv.learn_ec_copy.data()) { std::swap(result.learn_ec, priv.learn_ec_copy); }
+  else
+  {
+    result.learn_ec.resize(priv.learn_ec_ref_cnt);
+    for (size_t i = 0; i < priv.learn_ec_ref_cnt; i++)
+    { VW::copy_example_data_with_label(&result.learn_ec[i], priv.learn_ec_ref + i); }
+  }
+  priv.learn_ec_ref = nullptr;
+  priv.learn_ec_ref_cnt = 0;
+
+  result.learn_learner_id = priv.learn_learner_id;
+  std::swap(result.learn_condition_on, priv.learn_condition_on);
+  std::swap(result.learn_condition_on_act, priv.learn_condition_on_act);
+  std::swap(result.learn_condition_on_names, priv.learn_condition_on_names);
+}
+
+void learn_from_rollout(search_private& priv, rollout_result& result)
+{
+  priv.learn_ec_ref = result.learn_ec.data();
+  priv.learn_ec_ref_cnt = result.learn_ec.size();
+  priv.learn_learner_id = result.learn_learner_id;
+  std::swap(priv.learn_condition_on, result.learn_condition_on);
+  std::swap(priv.learn_condition_on_act, result.learn_condition_on_act);
+  std::swap(priv.learn_condition_on_names, result.learn_condition_on_names);
+
+  generate_training_example(priv, result.losses, 1., true);
+
+  for (auto& ex : result.learn_ec) { ex.l = VW::polylabel{}; }
+  if (priv.cb_learner) { result.losses.cb.costs.clear(); }
+  else
+  {
+    result.losses.cs.costs.clear();
+  }
+  priv.learn_ec_ref = nullptr;
+  priv.learn_ec_ref_cnt = 0;
+}
+
+// Creates a workspace with the same learner stack as all, which predicts with the weights of all. Options which read
+// or write files, print or start threads are left out, the workspace is only used for rollouts.
+VW::workspace* seed_rollout_workspace(VW::workspace& all)
+{
+  static const std::set<std::string> SKIPPED_GROUPS = {"Diagnostic", "Input", "Prediction Output", "Output Model",
+      "Logging", "Parallelization", "[Reduction] Debug Metrics"};
+  static const std::set<std::string> SKIPPED_OPTIONS = {
+      "initial_regressor", "initial_deltas", "input_feature_regularizer", "search_rollout_threads"};
+
+  VW::config::cli_options_serializer serializer;
+  std::set<std::string> added;
+  for (const auto& group : all.options->get_all_option_group_definitions())
+  {
+    if (SKIPPED_GROUPS.count(group.m_name) > 0) { continue; }
+    for (const auto& option : group.m_options)
+    {
+      if (!all.options->was_supplied(option->m_name) || SKIPPED_OPTIONS.count(option->m_name) > 0) { continue; }
+      if (added.insert(option->m_name).second) { serializer.add(*option); }
+    }
+  }
+
+  auto* worker = VW::initialize(serializer.str() + " --quiet --no_stdin", nullptr, true /* skip_model_load */);
+  delete worker->sd;
+  worker->weights.shallow_copy(all.weights);
+  worker->sd = all.sd;
+  worker->example_parser->_shared_data = worker->sd;
+  return worker;
+}
+
+rollout_executor::rollout_executor(VW::workspace& all, size_t num_workers)
+{
+  _workers.reserve(num_workers);
+  try
+  {
+    for (size_t i = 0; i < num_workers; i++)
+    {
+      auto w = VW::make_unique<worker>();
+      w->all = seed_rollout_workspace(all);
+      w->sch = static_cast<search*>(w->all->searchstr);
+      _workers.push_back(std::move(w));
+    }
+  }
+  catch (...)
+  {
+    for (auto& w : _workers) { VW::finish(*w->all); }
+    throw;
+  }
+
+  _threads.reserve(num_workers);
+  for (auto& w : _workers)
+  {
+    worker* wp = w.get();
+    _threads.emplace_back([this, wp] { work(*wp); });
+  }
+}
+
+rollout_executor::~rollout_executor()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _start.notify_all();
+  for (auto& thread : _threads) { thread.join(); }
+  for (auto& w : _workers) { VW::finish(*w->all); }
+}
+
+// Gives the worker a copy of the example and of the state the rollouts start from, which INIT_TRAIN left in priv.
+void rollout_executor::prepare(search_private& priv, const VW::multi_ex& ec_seq, worker& w)
+{
+  w.examples.resize(ec_seq.size());
+  w.ec_seq.clear();
+  for (size_t i = 0; i < ec_seq.size(); i++)
+  {
+    VW::copy_example_data_with_label(&w.examples[i], ec_seq[i]);
+    w.ec_seq.push_back(&w.examples[i]);
+  }
+
+  search_private& wpriv = *w.sch->priv;
+  wpriv.offset = priv.offset;
+  wpriv.auto_condition_features = priv.auto_condition_features;
+  wpriv.force_oracle = priv.force_oracle;
+  wpriv.current_policy = priv.current_policy;
+  wpriv.read_example_last_id = priv.read_example_last_id;
+  wpriv.read_example_last_pass = priv.read_example_last_pass;
+  wpriv.total_examples_generated = priv.total_examples_generated;
+  wpriv.beta = priv.beta;
+  wpriv.T = priv.T;
+  wpriv.train_trajectory = priv.train_trajectory;
+  wpriv.cache_hash_map.clear();
+}
+
+void rollout_executor::rollout_timesteps(search& sch, VW::multi_ex& ec_seq)
+{
+  search_private& priv = *sch.priv;
+  size_t tid;
+  while ((tid = _next_timestep++) < _timesteps->size())
+  {
+    // the allowed actions are those of this timestep only, whichever timesteps this thread rolled out before
+    priv.learn_allowed_actions.clear();
+    rollout_timestep(sch, ec_seq, (*_timesteps)[tid]);
+    take_rollout_result(priv, (*_results)[tid]);
+  }
+}
+
+void rollout_executor::work(worker& w)
+{
+  uint64_t generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _start.wait(lock, [this, generation] { return _stop || _generation != generation; });
+      if (_stop) { return; }
+      generation = _generation;
+    }
+
+    try
+    {
+      rollout_timesteps(*w.sch, w.ec_seq);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_exception == nullptr) { _exception = std::current_exception(); }
+      _next_timestep = _timesteps->size();
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (--_running == 0) { _done.notify_all(); }
+  }
+}
+
+void rollout_executor::run(search& sch, VW::multi_ex& ec_seq, std::vector<rollout_result>& results)
+{
+  search_private& priv = *sch.priv;
+  results.resize(priv.timesteps.size());
+  for (auto& w : _workers) { prepare(priv, ec_seq, *w); }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _timesteps = &priv.timesteps;
+    _results = &results;
+    _next_timestep = 0;
+    _running = _workers.size();
+    _generation++;
+  }
+  _start.notify_all();
+
+  try
+  {
+    rollout_timesteps(sch, ec_seq);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_exception == nullptr) { _exception = std::current_exception(); }
+    _next_timestep = _timesteps->size();
+  }
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _done.wait(lock, [this] { return _running == 0; });
+  for (auto& w : _workers)
+  {
+    search_private& wpriv = *w->sch->priv;
+    priv.num_calls_to_run += wpriv.num_calls_to_run;
+    priv.total_predictions_made += wpriv.total_predictions_made;
+    priv.total_cache_hits += wpriv.total_cache_hits;
+    wpriv.num_calls_to_run = 0;
+    wpriv.total_predictions_made = 0;
+    wpriv.total_cache_hits = 0;
+  }
+  if (_exception != nullptr)
+  {
+    auto exception = _exception;
+    _exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
 template <bool is_learn>
 void train_single_example(search& sch, bool is_test_ex, bool is_holdout_ex, VW::multi_ex& ec_seq)
 {
@@ -2240,95 +2594,49 @@ void train_single_example(search& sch, bool is_test_ex, bool is_holdout_ex, VW::
     priv.learn_losses.cs.costs.clear();
   }
 
-  for (size_t tid = 0; tid < priv.timesteps.size(); tid++)
+  if (priv.rollout_threads > 1)
   {
-    cdbg << "timestep = " << priv.timesteps[tid] << " [" << tid << "/" << priv.timesteps.size() << "]" << endl;
-
-    if (priv.metatask && !priv.memo_foreach_action[tid])
-    {
-      cdbg << "skipping because it looks like this was overridden by metatask" << endl;
-      continue;
-    }
-
-    priv.learn_ec_ref = nullptr;
-    priv.learn_ec_ref_cnt = 0;
-
-    reset_search_structure(priv);  // TODO remove this?
-    bool skipped_all_actions = true;
-    priv.learn_a_idx = 0;
-    priv.done_with_all_actions = false;
-    // for each action, roll out to get a loss
-    while (!priv.done_with_all_actions)
-    {
-      priv.learn_t = priv.timesteps[tid];
-      advance_from_known_actions(priv);
-      if (priv.done_with_all_actions) { break; }
-
-      skipped_all_actions = false;
-      reset_search_structure(priv);
-
-      priv.state = SearchState::LEARN;
-      priv.learn_t = priv.timesteps[tid];
-      cdbg << "-------------------------------------------------------------------------------------" << endl;
-      cdbg << "learn_t = " << priv.learn_t << ", learn_a_idx = " << priv.learn_a_idx << endl;
-      run_task(sch, ec_seq);
-      float this_loss = priv.learn_loss;
-      cs_cost_push_back(priv.cb_learner, priv.learn_losses,
-          priv.is_ldf ? static_cast<uint32_t>(priv.learn_a_idx - 1) : static_cast<uint32_t>(priv.learn_a_idx),
-          this_loss);
-      //                          (priv.learn_allowed_actions.size() > 0) ?
-      //                          priv.learn_allowed_actions[priv.learn_a_idx-1] : priv.is_ldf ? (priv.learn_a_idx-1) :
-      //                          (priv.learn_a_idx),
-      //                           priv.learn_loss);
-    }
-    if (priv.active_csoaa_verify > 0.)
+    if (priv.rollout_workers == nullptr)
+    { priv.rollout_workers = VW::make_unique<rollout_executor>(all, priv.rollout_threads - 1); }
+    priv.rollout_workers->run(sch, ec_seq, priv.rollout_results);
+    for (auto& result : priv.rollout_results) { learn_from_rollout(priv, result); }
+  }
+  else
+  {
+    for (size_t tid = 0; tid < priv.timesteps.size(); tid++)
     {
-      verify_active_csoaa(priv.learn_losses.cs, priv.active_known[priv.learn_t], ec_seq[0]->example_counter,
-          priv.active_csoaa_verify, priv.all->logger);
-    }
+      cdbg << "timestep = " << priv.timesteps[tid] << " [" << tid << "/" << priv.timesteps.size() << "]" << endl;
 
-    if (skipped_all_actions)
-    {
-      reset_search_structure(priv);
-      priv.state = SearchState::LEARN;
-      priv.learn_t = priv.timesteps[tid];
-      priv.force_setup_ec_ref = true;
-      cdbg << "<<<<<" << endl;
-      cdbg << "skipped all actions; learn_t = " << priv.learn_t << ", learn_a_idx = " << priv.learn_a_idx << endl;
-      run_task(sch, ec_seq);  // TODO: i guess we can break out of this early
-      cdbg << ">>>>>" << endl;
-    }
-    else
-      cdbg << "didn't skip all actions" << endl;
+      if (priv.metatask && !priv.memo_foreach_action[tid])
+      {
+        cdbg << "skipping because it looks like this was overridden by metatask" << endl;
+        continue;
+      }
 
-    // now we can make a training example
-    if (priv.learn_allowed_actions.size() > 0)
-    {
-      for (size_t i = 0; i < priv.learn_allowed_actions.size(); i++)
-      { priv.learn_losses.cs.costs[i].class_index = priv.learn_allowed_actions[i]; }
-    }
-    // float min_loss = 0.;
-    // if (priv.metatask)
-    //  for (size_t aid=0; aid<priv.memo_foreach_action[tid]->size(); aid++)
-    //    min_loss = std::min(min_loss, priv.memo_foreach_action[tid]->get(aid).cost);
-    cdbg << "priv.learn_losses = [";
-    for (auto& wc : priv.learn_losses.cs.costs) { cdbg << " " << wc.class_index << ":" << wc.x; }
-    cdbg << " ]" << endl;
-    cdbg << "gte" << endl;
-    generate_training_example(priv, priv.learn_losses, 1., true);  // , min_loss);  // TODO: weight
-    if (!priv.examples_dont_change)
-    {
-      for (auto& ex : priv.learn_ec_copy)
+      rollout_timestep(sch, ec_seq, priv.timesteps[tid]);
+      // float min_loss = 0.;
+      // if (priv.metatask)
+      //  for (size_t aid=0; aid<priv.memo_foreach_action[tid]->size(); aid++)
+      //    min_loss = std::min(min_loss, priv.memo_foreach_action[tid]->get(aid).cost);
+      cdbg << "priv.learn_losses = [";
+      for (auto& wc : priv.learn_losses.cs.costs) { cdbg << " " << wc.class_index << ":" << wc.x; }
+      cdbg << " ]" << endl;
+      cdbg << "gte" << endl;
+      generate_training_example(priv, priv.learn_losses, 1., true);  // , min_loss);  // TODO: weight
+      if (!priv.examples_dont_change)
+      {
+        for (auto& ex : priv.learn_ec_copy)
+        {
+          // Reset the state of the VW::polylabel
+          ex.l = VW::polylabel{};
+        }
+      }
+      if (priv.cb_learner) { priv.learn_losses.cb.costs.clear(); }
+      else
       {
-        // Reset the state of the VW::polylabel
-        ex.l = VW::polylabel{};
+        priv.learn_losses.cs.costs.clear();
       }
     }
-    if (priv.cb_learner) { priv.learn_losses.cb.costs.clear(); }
-    else
-    {
-      priv.learn_losses.cs.costs.clear();
-    }
   }
 
   if (priv.active_csoaa && (priv.save_every_k_runs > 1))
@@ -2545,6 +2853,7 @@ void search_finish(search& sch)
 
   if (priv.task->finish) { priv.task->finish(sch); }
   if (priv.metatask && priv.metatask->finish) { priv.metatask->finish(sch); }
+  priv.rollout_workers.reset();
 }
 
 std::vector<CS::label> read_allowed_transitions(action A, const char* filename, VW::io::logger& logger)
@@ -3097,6 +3406,7 @@ base_learner* VW::reductions::search_setup(VW::setup_base_i& stack_builder)
   uint64_t rollout_num_steps;
   uint64_t save_every_k_runs;
 
+  uint64_t rollout_threads;
   uint32_t search_trained_nb_policies;
   std::string search_allowed_transitions;
 
@@ -3168,7 +3478,12 @@ base_learner* VW::reductions::search_setup(VW::setup_base_i& stack_builder)
       .add(make_option("search_active_verify", priv.active_csoaa_verify)
                .help("Verify that active learning is doing the right thing (arg = multiplier, should be = "
                      "cost_range * range_c)"))
-      .add(make_option("search_save_every_k_runs", save_every_k_runs).default_value(0).help("Save model every k runs"));
+      .add(make_option("search_save_every_k_runs", save_every_k_runs).default_value(0).help("Save model every k runs"))
+      .add(make_option("search_rollout_threads", rollout_threads)
+               .default_value(1)
+               .help("Number of threads rolling out the timesteps of an example. With more than one, all rollouts of "
+                     "an example use the weights from before it and the example is learned from afterwards")
+               .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -3177,6 +3492,8 @@ base_learner* VW::reductions::search_setup(VW::setup_base_i& stack_builder)
   priv.rollout_num_steps = VW::cast_to_smaller_type<size_t>(rollout_num_steps);
   priv.history_length = VW::cast_to_smaller_type<size_t>(history_length);
   priv.save_every_k_runs = VW::cast_to_smaller_type<size_t>(save_every_k_runs);
+  priv.rollout_threads = VW::cast_to_smaller_type<size_t>(rollout_threads);
+  if (priv.rollout_threads == 0) { THROW("search_rollout_threads must be at least 1"); }
 
   search_initialize(&all, *sch.get());
 
@@ -3348,6 +3665,8 @@ base_learner* VW::reductions::search_setup(VW::setup_base_i& stack_builder)
   cdbg << "active_csoaa = " << priv.active_csoaa << ", active_csoaa_verify = " << priv.active_csoaa_verify << endl;
 
   auto* base = stack_builder.setup_base_learner();
+  // the workers of --search_rollout_threads never learn, so they need the base learner before the first example
+  priv.base_learner = base;
 
   // default to OAA labels unless the task wants to override this (which they can do in initialize)
   all.example_parser->lbl_parser = MC::mc_label;
@@ -3364,6 +3683,17 @@ base_learner* VW::reductions::search_setup(VW::setup_base_i& stack_builder)
   // set up auto-history (used to only do this if AUTO_CONDITION_FEATURES was on, but that doesn't work for hooktask)
   handle_condition_options(all, priv.acset);
 
+  if (priv.rollout_threads > 1)
+  {
+    if (priv.metatask != nullptr) { THROW("--search_rollout_threads cannot be used with --search_metatask"); }
+    if (priv.task == &HookTask::task) { THROW("--search_rollout_threads cannot be used with the hook task"); }
+    if (priv.cb_learner) { THROW("--search_rollout_threads cannot be used with --cb"); }
+    if (priv.active_csoaa) { THROW("--search_rollout_threads cannot be used with --cs_active"); }
+    if (priv.acset.use_passthrough_repr)
+    { THROW("--search_rollout_threads cannot be used with --search_use_passthrough_repr"); }
+    if (all.weights.sparse) { THROW("--search_rollout_threads cannot be used with --sparse_weights"); }
+  }
+
   if (!priv.allow_current_policy)
   {  // if we're not dagger
     all.check_holdout_every_n_passes = priv.passes_per_policy;
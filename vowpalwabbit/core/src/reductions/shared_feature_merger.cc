@@ -7,12 +7,15 @@
 #include "vw/config/options.h"
 #include "vw/core/cb.h"
 #include "vw/core/example.h"
+#include "vw/core/global_data.h"
 #include "vw/core/label_dictionary.h"
 #include "vw/core/learner.h"
 #include "vw/core/scope_exit.h"
 #include "vw/core/setup_base.h"
 #include "vw/core/vw.h"
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <string>
 #include <vector>
@@ -27,6 +30,12 @@ struct sfm_data
 {
   std::unique_ptr<sfm_metrics> _metrics;
   VW::label_type_t label_type = VW::label_type_t::cb;
+
+  VW::workspace* all = nullptr;
+  bool factorize = false;
+  // Shared namespaces used by an interaction still have to be merged into every action when factorizing.
+  std::array<bool, NUM_NAMESPACES> interacted_namespaces;
+  VW::shared_features::factorized_shared_features factorized;
 };
 
 template <bool is_learn>
@@ -75,17 +84,130 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::multi_learner& base, VW::mult
   }
 }
 
+// Merges only the shared namespaces used by interactions into the actions. gd looks up the weights of the linear
+// shared features once per prediction instead of once per action, and adds them to the score of every action where
+// merging would have put them. The interactions of the merged namespaces are still generated for every action, as their
+// weights depend on the features of the action.
+void predict_factorized(sfm_data& data, VW::LEARNER::multi_learner& base, VW::multi_ex& ec_seq)
+{
+  if (ec_seq.empty()) THROW("cb_adf: At least one action must be provided for an example to be valid.");
+
+  if (!VW::LEARNER::ec_is_example_header(*ec_seq[0], data.label_type))
+  {
+    base.predict(ec_seq);
+    return;
+  }
+
+  VW::example* shared_example = ec_seq[0];
+  ec_seq.erase(ec_seq.begin());
+
+  // The vectors of weights are reused across predictions.
+  auto& factorized = data.factorized;
+  for (const auto& ns : factorized.namespaces) { factorized.positions[ns.index] = -1; }
+  size_t num_namespaces = 0;
+  for (VW::namespace_index idx : shared_example->indices)
+  {
+    if (idx == constant_namespace) { continue; }
+    if (num_namespaces == factorized.namespaces.size()) { factorized.namespaces.emplace_back(); }
+    auto& ns = factorized.namespaces[num_namespaces];
+    ns.index = idx;
+    ns.shared = &shared_example->feature_space[idx];
+    ns.merged = data.interacted_namespaces[idx];
+    factorized.positions[idx] = static_cast<int>(num_namespaces++);
+  }
+  factorized.namespaces.resize(num_namespaces);
+  factorized.has_weights = false;
+
+  for (auto* example : ec_seq)
+  {
+    auto& shared_features = example->_reduction_features.template get<VW::shared_features::reduction_features>();
+    shared_features.factorized = &factorized;
+    shared_features.num_own_indices = example->indices.size();
+    for (const auto& ns : factorized.namespaces)
+    {
+      if (ns.merged) { LabelDict::add_example_namespace(*example, ns.index, shared_example->feature_space[ns.index]); }
+    }
+    shared_features.num_merged_indices = example->indices.size();
+  }
+  if (!ec_seq.empty())
+  {
+    std::swap(ec_seq[0]->pred, shared_example->pred);
+    std::swap(ec_seq[0]->tag, shared_example->tag);
+  }
+
+  // Guard example state restore against throws
+  auto restore_guard = VW::scope_exit([&data, shared_example, &ec_seq] {
+    const auto& namespaces = data.factorized.namespaces;
+    for (auto* example : ec_seq)
+    {
+      for (auto it = namespaces.rbegin(); it != namespaces.rend(); ++it)
+      {
+        if (it->merged) { LabelDict::del_example_namespace(*example, it->index, shared_example->feature_space[it->index]); }
+      }
+      example->_reduction_features.template get<VW::shared_features::reduction_features>().reset_to_default();
+    }
+    if (!ec_seq.empty())
+    {
+      std::swap(shared_example->pred, ec_seq[0]->pred);
+      std::swap(shared_example->tag, ec_seq[0]->tag);
+    }
+    ec_seq.insert(ec_seq.begin(), shared_example);
+  });
+
+  if (ec_seq.empty()) { return; }
+  base.predict(ec_seq);
+}
+
+void predict(sfm_data& data, VW::LEARNER::multi_learner& base, VW::multi_ex& ec_seq)
+{
+  if (data.factorize) { predict_factorized(data, base, ec_seq); }
+  else
+  {
+    predict_or_learn<false>(data, base, ec_seq);
+  }
+}
+
 void persist(sfm_data& data, VW::metric_sink& metrics)
 {
   if (data._metrics)
   { metrics.set_uint("sfm_count_learn_example_with_shared", data._metrics->count_learn_example_with_shared); }
 }
+// Factorizing relies on gd computing the score of every action, as only gd adds the factorized shared features to it.
+void check_factorize_supported(VW::workspace& all, const VW::LEARNER::base_learner& base)
+{
+  if (all.audit || all.hash_inv) { THROW("--factorize_shared_features can not be used with --audit or --invert_hash") }
+  // gd only scores factorized features with plain weights.
+  if (all.reg_mode % 2) { THROW("--factorize_shared_features can not be used with --l1") }
+  if (all.options->was_supplied("quantization_report"))
+  { THROW("--factorize_shared_features can not be used with --quantization_report") }
+
+  std::vector<std::string> enabled_reductions;
+  base.get_enabled_reductions(enabled_reductions);
+  const std::vector<std::string> supported = {"gd", "scorer", "csoaa_ldf", "cb_adf", "cb_explore_adf_greedy"};
+  for (const auto& reduction : enabled_reductions)
+  {
+    const auto base_name = reduction.substr(0, reduction.find('-'));
+    if (std::find(supported.begin(), supported.end(), base_name) == supported.end())
+    { THROW("--factorize_shared_features does not support the " << reduction << " reduction") }
+  }
+}
 }  // namespace
 
 VW::LEARNER::base_learner* VW::reductions::shared_feature_merger_setup(VW::setup_base_i& stack_builder)
 {
   VW::config::options_i& options = *stack_builder.get_options();
   VW::workspace& all = *stack_builder.get_all_pointer();
+
+  bool factorize = false;
+  VW::config::option_group_definition reduction_options("[Reduction] Shared Feature Merger");
+  reduction_options.add(
+      VW::config::make_option("factorize_shared_features", factorize)
+          .help("When predicting on multiline examples, look up the weights of the shared features once instead of "
+                "for every action. Shared namespaces used by interactions are still merged into every action. "
+                "Predictions do not change")
+          .experimental());
+  options.add_and_parse(reduction_options);
+
   auto* base = stack_builder.setup_base_learner();
   if (base == nullptr) { return nullptr; }
   std::set<label_type_t> sfm_labels = {label_type_t::cb, label_type_t::cs};
@@ -96,10 +218,26 @@ VW::LEARNER::base_learner* VW::reductions::shared_feature_merger_setup(VW::setup
 
   auto* multi_base = VW::LEARNER::as_multiline(base);
   data->label_type = all.example_parser->lbl_parser.label_type;
+  data->all = &all;
+  data->factorize = factorize;
+  if (factorize)
+  {
+    check_factorize_supported(all, *base);
+    data->interacted_namespaces.fill(false);
+    data->factorized.positions.fill(-1);
+    for (const auto& interaction : all.interactions)
+    {
+      for (auto ns : interaction) { data->interacted_namespaces[ns] = true; }
+    }
+    for (const auto& interaction : all.extent_interactions)
+    {
+      for (const auto& term : interaction) { data->interacted_namespaces[term.first] = true; }
+    }
+  }
 
   // Both label and prediction types inherit that of base.
-  auto* learner = VW::LEARNER::make_reduction_learner(std::move(data), multi_base, predict_or_learn<true>,
-      predict_or_learn<false>, stack_builder.get_setupfn_name(shared_feature_merger_setup))
+  auto* learner = VW::LEARNER::make_reduction_learner(std::move(data), multi_base, predict_or_learn<true>, predict,
+      stack_builder.get_setupfn_name(shared_feature_merger_setup))
                       .set_learn_returns_prediction(base->learn_returns_prediction)
                       .set_persist_metrics(persist)
                       .build();
@@ -31,8 +31,8 @@ shared_data::shared_data(const shared_data& other)
   dump_interval = other.dump_interval;
   gravity = other.gravity;
   contraction = other.contraction;
-  min_label = other.min_label;
-  max_label = other.max_label;
+  min_label = other.min_label.load();
+  max_label = other.max_label.load();
   if (other.ldict) { ldict = VW::make_unique<VW::named_labels>(*other.ldict); }
   weighted_holdout_examples = other.weighted_holdout_examples;
   weighted_holdout_examples_since_last_dump = other.weighted_holdout_examples_since_last_dump;
@@ -66,8 +66,8 @@ shared_data& shared_data::operator=(const shared_data& other)
   dump_interval = other.dump_interval;
   gravity = other.gravity;
   contraction = other.contraction;
-  min_label = other.min_label;
-  max_label = other.max_label;
+  min_label = other.min_label.load();
+  max_label = other.max_label.load();
   if (other.ldict) { ldict = VW::make_unique<VW::named_labels>(*other.ldict); }
   weighted_holdout_examples = other.weighted_holdout_examples;
   weighted_holdout_examples_since_last_dump = other.weighted_holdout_examples_since_last_dump;
@@ -101,8 +101,8 @@ shared_data::shared_data(shared_data&& other) noexcept
   dump_interval = other.dump_interval;
   gravity = other.gravity;
   contraction = other.contraction;
-  min_label = other.min_label;
-  max_label = other.max_label;
+  min_label = other.min_label.load();
+  max_label = other.max_label.load();
   ldict = std::move(other.ldict);
   weighted_holdout_examples = other.weighted_holdout_examples;
   weighted_holdout_examples_since_last_dump = other.weighted_holdout_examples_since_last_dump;
@@ -135,8 +135,8 @@ shared_data& shared_data::operator=(shared_data&& other) noexcept
   dump_interval = other.dump_interval;
   gravity = other.gravity;
   contraction = other.contraction;
-  min_label = other.min_label;
-  max_label = other.max_label;
+  min_label = other.min_label.load();
+  max_label = other.max_label.load();
   ldict = std::move(other.ldict);
   weighted_holdout_examples = other.weighted_holdout_examples;
   weighted_holdout_examples_since_last_dump = other.weighted_holdout_examples_since_last_dump;
@@ -0,0 +1,167 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/stream_vbyte.h"
+
+#include "vw/common/vw_exception.h"
+
+#include <cstring>
+
+#if !defined(VW_NO_INLINE_SIMD)
+#  if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#    define VW_STREAM_VBYTE_SSSE3
+#    define VW_TARGET_SSSE3 __attribute__((target("ssse3")))
+#    include <immintrin.h>
+#  elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    define VW_STREAM_VBYTE_SSSE3
+#    define VW_TARGET_SSSE3
+#    include <intrin.h>
+#    include <tmmintrin.h>
+#  endif
+#endif
+
+namespace
+{
+inline uint8_t length_code(uint32_t value)
+{
+  if (value < (1u << 8)) { return 0; }
+  if (value < (1u << 16)) { return 1; }
+  if (value < (1u << 24)) { return 2; }
+  return 3;
+}
+
+inline size_t control_bytes_size(size_t count) { return (count + 3) / 4; }
+
+const uint8_t* decode_scalar_range(
+    const uint8_t* control, const uint8_t* data, const uint8_t* end, size_t begin, size_t count, uint32_t* out)
+{
+  for (size_t i = begin; i < count; i++)
+  {
+    const size_t length = ((control[i / 4] >> (2 * (i % 4))) & 3) + 1;
+    if (static_cast<size_t>(end - data) < length) { THROW("Stream VByte data is truncated"); }
+
+    uint32_t value = 0;
+    for (size_t b = 0; b < length; b++) { value |= static_cast<uint32_t>(data[b]) << (8 * b); }
+    out[i] = value;
+    data += length;
+  }
+  return data;
+}
+
+#ifdef VW_STREAM_VBYTE_SSSE3
+// For every control byte, the shuffle that moves the bytes of four packed integers into four 32 bit lanes and the
+// number of data bytes they occupy.
+struct decode_tables
+{
+  alignas(16) uint8_t shuffles[256][16];
+  uint8_t lengths[256];
+
+  decode_tables()
+  {
+    for (size_t control = 0; control < 256; control++)
+    {
+      uint8_t offset = 0;
+      for (size_t lane = 0; lane < 4; lane++)
+      {
+        const uint8_t length = ((control >> (2 * lane)) & 3) + 1;
+        // A shuffle index with the high bit set writes a zero.
+        for (uint8_t b = 0; b < 4; b++) { shuffles[control][lane * 4 + b] = b < length ? offset + b : 0xFF; }
+        offset += length;
+      }
+      lengths[control] = offset;
+    }
+  }
+};
+
+const decode_tables& get_decode_tables()
+{
+  static const decode_tables tables;
+  return tables;
+}
+
+bool cpu_has_ssse3()
+{
+#  if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  return (info[2] & (1 << 9)) != 0;
+#  else
+  return __builtin_cpu_supports("ssse3") != 0;
+#  endif
+}
+
+VW_TARGET_SSSE3 const uint8_t* decode_ssse3(
+    const uint8_t* control, const uint8_t* data, const uint8_t* end, size_t count, uint32_t* out, size_t& decoded)
+{
+  const auto& tables = get_decode_tables();
+  size_t i = 0;
+  // Every iteration loads 16 bytes, stop while that is still within the input and let the scalar code finish.
+  for (; i + 4 <= count && end - data >= 16; i += 4)
+  {
+    const uint8_t c = control[i / 4];
+    const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(tables.shuffles[c]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(packed, shuffle));
+    data += tables.lengths[c];
+  }
+  decoded = i;
+  return data;
+}
+#endif
+}  // namespace
+
+namespace VW
+{
+namespace details
+{
+size_t stream_vbyte_max_encoded_size(size_t count) { return control_bytes_size(count) + count * sizeof(uint32_t); }
+
+size_t stream_vbyte_encode(const uint32_t* in, size_t count, uint8_t* out)
+{
+  uint8_t* control = out;
+  uint8_t* data = out + control_bytes_size(count);
+  std::memset(control, 0, control_bytes_size(count));
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const uint8_t code = length_code(in[i]);
+    control[i / 4] |= static_cast<uint8_t>(code << (2 * (i % 4)));
+    for (uint8_t b = 0; b <= code; b++) { *(data++) = static_cast<uint8_t>(in[i] >> (8 * b)); }
+  }
+  return data - out;
+}
+
+size_t stream_vbyte_decode_scalar(const uint8_t* in, size_t in_size, size_t count, uint32_t* out)
+{
+  if (in_size < control_bytes_size(count)) { THROW("Stream VByte data is truncated"); }
+  const uint8_t* data = in + control_bytes_size(count);
+  return decode_scalar_range(in, data, in + in_size, 0, count, out) - in;
+}
+
+size_t stream_vbyte_decode(const uint8_t* in, size_t in_size, size_t count, uint32_t* out)
+{
+#ifdef VW_STREAM_VBYTE_SSSE3
+  if (stream_vbyte_has_simd_decoder())
+  {
+    if (in_size < control_bytes_size(count)) { THROW("Stream VByte data is truncated"); }
+    const uint8_t* end = in + in_size;
+    size_t decoded = 0;
+    const uint8_t* data = decode_ssse3(in, in + control_bytes_size(count), end, count, out, decoded);
+    return decode_scalar_range(in, data, end, decoded, count, out) - in;
+  }
+#endif
+  return stream_vbyte_decode_scalar(in, in_size, count, out);
+}
+
+bool stream_vbyte_has_simd_decoder()
+{
+#ifdef VW_STREAM_VBYTE_SSSE3
+  static const bool has_ssse3 = cpu_has_ssse3();
+  return has_ssse3;
+#else
+  return false;
+#endif
+}
+}  // namespace details
+}  // namespace VW
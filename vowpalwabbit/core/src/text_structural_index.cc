@@ -0,0 +1,79 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/text_structural_index.h"
+
+#include <cstring>
+
+// SSE2 is part of every x86-64 cpu, so no runtime detection is needed.
+#if !defined(VW_NO_INLINE_SIMD)
+#  if (defined(__GNUC__) || defined(__clang__)) && defined(__SSE2__)
+#    define VW_STRUCTURAL_SSE2
+#    include <emmintrin.h>
+#  elif defined(_MSC_VER) && defined(_M_X64)
+#    define VW_STRUCTURAL_SSE2
+#    include <emmintrin.h>
+#  endif
+#endif
+
+namespace
+{
+inline bool is_structural(char c) { return c == ' ' || c == '\t' || c == ':' || c == '|' || c == '\r'; }
+
+#ifdef VW_STRUCTURAL_SSE2
+inline uint64_t structural_mask_16(const char* data)
+{
+  const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  __m128i matches = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' '));
+  matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+  matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(':')));
+  matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('|')));
+  matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')));
+  return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches)));
+}
+#endif
+}  // namespace
+
+namespace VW
+{
+namespace details
+{
+uint64_t structural_mask_scalar(const char* data, size_t size)
+{
+  uint64_t bits = 0;
+  for (size_t i = 0; i < size; i++)
+  {
+    if (is_structural(data[i])) { bits |= uint64_t{1} << i; }
+  }
+  return bits;
+}
+
+uint64_t structural_mask(const char* data, size_t size)
+{
+#ifdef VW_STRUCTURAL_SSE2
+  // The end of a line is classified from a copy, as reading past it may leave the buffer. Zero is not structural.
+  char tail[STRUCTURAL_BLOCK_SIZE];
+  if (size < STRUCTURAL_BLOCK_SIZE)
+  {
+    std::memset(tail, 0, sizeof(tail));
+    std::memcpy(tail, data, size);
+    data = tail;
+  }
+  return structural_mask_16(data) | (structural_mask_16(data + 16) << 16) | (structural_mask_16(data + 32) << 32) |
+      (structural_mask_16(data + 48) << 48);
+#else
+  return structural_mask_scalar(data, size);
+#endif
+}
+
+bool structural_mask_is_simd()
+{
+#ifdef VW_STRUCTURAL_SSE2
+  return true;
+#else
+  return false;
+#endif
+}
+}  // namespace details
+}  // namespace VW
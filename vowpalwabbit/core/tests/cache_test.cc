@@ -4,6 +4,7 @@
 
 #include "vw/core/cache.h"
 
+#include "vw/core/memory.h"
 #include "vw/core/parse_example.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_fwd.h"
@@ -11,6 +12,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <memory>
 
 using namespace ::testing;
@@ -179,3 +181,93 @@ TEST(cache_tests, write_and_read_features)
     EXPECT_FLOAT_EQ(it.value(), read_it.value());
   }
 }
+
+TEST(cache_tests, write_and_read_block_cache)
+{
+  auto& workspace = *VW::initialize("--quiet");
+  const std::vector<std::string> lines = {"3.5 |ns1 example value test |ss2 ex:0.5", "-1 'tag |ns1 a b c",
+      "|ss2 x:-2 y:1e-5 |ns1 z", "2 |ns1 only_ones here"};
+  std::vector<std::unique_ptr<VW::example>> src_examples;
+
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  // A block size that does not divide the example count leaves a partial block to flush.
+  VW::details::block_cache_writer writer(3);
+  for (size_t i = 0; i < 7; i++)
+  {
+    src_examples.push_back(VW::make_unique<VW::example>());
+    VW::read_line(workspace, src_examples.back().get(), lines[i % lines.size()].c_str());
+    writer.write(io_writer, *src_examples.back(), workspace.example_parser->lbl_parser, workspace.parse_mask);
+  }
+  writer.flush(io_writer);
+  io_writer.flush();
+
+  io_buf io_reader;
+  io_reader.add_file(VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+  VW::details::block_cache_reader reader;
+
+  for (const auto& src_ex : src_examples)
+  {
+    VW::example dest_ex;
+    VW::multi_ex examples{&dest_ex};
+    EXPECT_GT(reader.read(workspace.example_parser->lbl_parser, io_reader, examples), 0);
+
+    EXPECT_FLOAT_EQ(src_ex->l.simple.label, dest_ex.l.simple.label);
+    EXPECT_THAT(src_ex->tag, Pointwise(Eq(), dest_ex.tag));
+    EXPECT_THAT(src_ex->indices, Pointwise(Eq(), dest_ex.indices));
+    for (auto ns : src_ex->indices)
+    {
+      EXPECT_THAT(src_ex->feature_space[ns].values, Pointwise(FloatEq(), dest_ex.feature_space[ns].values));
+      EXPECT_THAT(src_ex->feature_space[ns].indices, Pointwise(Eq(), dest_ex.feature_space[ns].indices));
+    }
+  }
+
+  VW::example end_ex;
+  VW::multi_ex examples{&end_ex};
+  EXPECT_EQ(reader.read(workspace.example_parser->lbl_parser, io_reader, examples), 0);
+
+  VW::finish(workspace);
+}
+
+TEST(cache_tests, write_and_read_block_cache_wide_indices)
+{
+  auto& workspace = *VW::initialize("--quiet");
+  VW::example src_ex;
+  VW::read_line(workspace, &src_ex, "1 |ns1 a b c");
+  // Index deltas beyond 32 bits are stored as varints instead of stream vbyte.
+  src_ex.feature_space['n'].indices[1] = (1ULL << 50) + 7;
+
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::details::block_cache_writer writer;
+  writer.write(io_writer, src_ex, workspace.example_parser->lbl_parser, std::numeric_limits<uint64_t>::max());
+  writer.flush(io_writer);
+  io_writer.flush();
+
+  io_buf io_reader;
+  io_reader.add_file(VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+  VW::details::block_cache_reader reader;
+  VW::example dest_ex;
+  VW::multi_ex examples{&dest_ex};
+  EXPECT_GT(reader.read(workspace.example_parser->lbl_parser, io_reader, examples), 0);
+  EXPECT_THAT(src_ex.feature_space['n'].indices, Pointwise(Eq(), dest_ex.feature_space['n'].indices));
+  EXPECT_FALSE(dest_ex.sorted);
+
+  VW::finish(workspace);
+}
+
+TEST(cache_tests, cache_header_round_trip)
+{
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::details::write_cache_header(io_writer, 24, VW::cache_format::block);
+  io_writer.flush();
+
+  auto reader = VW::io::create_buffer_view(backing_vector->data(), backing_vector->size());
+  VW::cache_format format = VW::cache_format::row;
+  EXPECT_EQ(VW::details::read_cache_header(*reader, format), 24);
+  EXPECT_EQ(format, VW::cache_format::block);
+}
@@ -0,0 +1,114 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/feature_hash_cache.h"
+
+#include "vw/core/parser.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+TEST(feature_hash_cache_tests, returns_hasher_values)
+{
+  VW::details::feature_hash_cache cache(hashstring, 1024);
+  const std::vector<std::string> names = {"a", "price", "12", " 34", "a_rather_long_feature_name_of_exactly_42_b",
+      "a_feature_name_much_too_long_to_be_kept_in_the_cache"};
+  for (int pass = 0; pass < 2; pass++)
+  {
+    for (const auto& name : names)
+    {
+      for (uint64_t seed : {0ULL, 7ULL, 0xdeadbeefULL})
+      { EXPECT_EQ(cache.hash(name.data(), name.size(), seed), hashstring(name.data(), name.size(), seed)) << name; }
+    }
+  }
+
+  const auto& stats = cache.stats();
+  EXPECT_EQ(stats.misses, 15);
+  EXPECT_EQ(stats.hits, 15);
+  EXPECT_EQ(stats.uncacheable, 6);
+  EXPECT_EQ(stats.evictions, 0);
+}
+
+TEST(feature_hash_cache_tests, seeds_are_separate_entries)
+{
+  VW::details::feature_hash_cache cache(hashall, 64);
+  const uint64_t first = cache.hash("name", 4, 1);
+  const uint64_t second = cache.hash("name", 4, 2);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(cache.hash("name", 4, 1), first);
+  EXPECT_EQ(cache.hash("name", 4, 2), second);
+  EXPECT_EQ(cache.stats().misses, 2);
+  EXPECT_EQ(cache.stats().hits, 2);
+}
+
+TEST(feature_hash_cache_tests, capacity_is_bounded)
+{
+  VW::details::feature_hash_cache cache(hashstring, 16);
+  EXPECT_EQ(cache.capacity(), 16);
+
+  for (int i = 0; i < 1000; i++)
+  {
+    const auto name = "f" + std::to_string(i);
+    EXPECT_EQ(cache.hash(name.data(), name.size(), 0), hashstring(name.data(), name.size(), 0));
+  }
+  EXPECT_EQ(cache.stats().misses, 1000);
+  EXPECT_GE(cache.stats().evictions, 1000 - cache.capacity());
+
+  // Evicted names are hashed again correctly.
+  for (int i = 0; i < 1000; i++)
+  {
+    const auto name = "f" + std::to_string(i);
+    EXPECT_EQ(cache.hash(name.data(), name.size(), 0), hashstring(name.data(), name.size(), 0));
+  }
+}
+
+TEST(feature_hash_cache_tests, referenced_entries_survive_eviction)
+{
+  // A single bucket, so every name competes for the same slots.
+  VW::details::feature_hash_cache cache(hashstring, VW::details::feature_hash_cache::BUCKET_SIZE);
+  cache.hash("hot", 3, 0);
+  for (int i = 0; i < 100; i++)
+  {
+    const auto name = "cold" + std::to_string(i);
+    cache.hash(name.data(), name.size(), 0);
+    // Using the hot name between insertions gives it a second chance every time the hand reaches it.
+    cache.hash("hot", 3, 0);
+  }
+  EXPECT_EQ(cache.stats().hits, 100);
+}
+
+TEST(feature_hash_cache_tests, parsed_features_match_uncached)
+{
+  const std::string line = "1 |user age:3 city=seattle |item price:1.5 color_red tag";
+  auto& plain = *VW::initialize("--quiet --no_stdin");
+  auto& cached = *VW::initialize("--quiet --no_stdin --feature_hash_cache 256");
+  ASSERT_NE(cached.example_parser->hash_cache, nullptr);
+
+  for (int i = 0; i < 3; i++)
+  {
+    auto* expected = VW::read_example(plain, line);
+    auto* actual = VW::read_example(cached, line);
+    for (auto ns : {'u', 'i'})
+    {
+      const auto& expected_features = expected->feature_space[ns];
+      const auto& actual_features = actual->feature_space[ns];
+      EXPECT_THAT(std::vector<feature_index>(actual_features.indices.begin(), actual_features.indices.end()),
+          ContainerEq(std::vector<feature_index>(expected_features.indices.begin(), expected_features.indices.end())));
+      EXPECT_THAT(std::vector<feature_value>(actual_features.values.begin(), actual_features.values.end()),
+          ContainerEq(std::vector<feature_value>(expected_features.values.begin(), expected_features.values.end())));
+    }
+    VW::finish_example(plain, *expected);
+    VW::finish_example(cached, *actual);
+  }
+
+  EXPECT_GT(cached.example_parser->hash_cache_stats().hits, 0);
+  VW::finish(plain);
+  VW::finish(cached);
+}
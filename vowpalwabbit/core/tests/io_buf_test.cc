@@ -0,0 +1,111 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/io_buf.h"
+
+#include "vw/io/io_adapter.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace
+{
+// Hands out views of a string in small windows, so reads regularly span window boundaries.
+struct windowed_view_reader : public VW::io::reader
+{
+  windowed_view_reader(std::string contents, size_t window_size)
+      : reader(true), _contents(std::move(contents)), _window_size(window_size)
+  {
+  }
+
+  ssize_t read(char* buffer, size_t num_bytes) override
+  {
+    num_bytes = std::min(num_bytes, _contents.size() - _offset);
+    std::copy(&_contents[_offset], &_contents[_offset] + num_bytes, buffer);
+    _offset += num_bytes;
+    read_calls++;
+    return static_cast<ssize_t>(num_bytes);
+  }
+
+  bool read_view(char*& data, size_t& num_bytes) override
+  {
+    if (_offset >= _contents.size()) { return false; }
+    data = &_contents[_offset];
+    num_bytes = std::min(_window_size, _contents.size() - _offset);
+    _offset += num_bytes;
+    return true;
+  }
+
+  void reset() override { _offset = 0; }
+
+  size_t read_calls = 0;
+
+private:
+  std::string _contents;
+  size_t _window_size;
+  size_t _offset = 0;
+};
+
+std::string read_all(io_buf& buf, size_t chunk_size)
+{
+  std::string result;
+  char* pointer = nullptr;
+  size_t read = 0;
+  while ((read = buf.buf_read(pointer, chunk_size)) > 0) { result.append(pointer, read); }
+  return result;
+}
+}  // namespace
+
+TEST(io_buf_tests, buf_read_spans_views)
+{
+  const std::string contents = "0123456789abcdefghijklmnopqrstuvwxyz";
+  auto reader = std::unique_ptr<windowed_view_reader>(new windowed_view_reader(contents, 5));
+  auto* reader_ptr = reader.get();
+
+  io_buf buf;
+  buf.add_file(std::move(reader));
+  EXPECT_EQ(read_all(buf, 3), contents);
+  EXPECT_EQ(reader_ptr->read_calls, 0);
+
+  // Every pass after a reset reads the views again rather than copying.
+  buf.reset();
+  EXPECT_EQ(read_all(buf, 7), contents);
+  EXPECT_EQ(reader_ptr->read_calls, 0);
+}
+
+TEST(io_buf_tests, readto_over_views_and_files)
+{
+  io_buf buf;
+  buf.add_file(std::unique_ptr<VW::io::reader>(new windowed_view_reader("first line\nsecond ", 4)));
+  buf.add_file(VW::io::create_buffer_view("line\nthird line\n", 16));
+
+  char* pointer = nullptr;
+  size_t len = buf.readto(pointer, '\n');
+  EXPECT_TRUE(buf.is_viewing());
+  EXPECT_EQ(std::string(pointer, len), "first line\n");
+
+  // The second line starts in the view and ends in the next, non view, file.
+  len = buf.readto(pointer, '\n');
+  EXPECT_FALSE(buf.is_viewing());
+  EXPECT_EQ(std::string(pointer, len), "second line\n");
+
+  len = buf.readto(pointer, '\n');
+  EXPECT_EQ(std::string(pointer, len), "third line\n");
+  EXPECT_EQ(buf.readto(pointer, '\n'), 0);
+}
+
+TEST(io_buf_tests, view_starts_after_copied_bytes)
+{
+  // Reading the first bytes of a file directly from the reader, as cache_numbits does, must not be repeated by views.
+  auto reader = std::unique_ptr<windowed_view_reader>(new windowed_view_reader("headerbody", 3));
+  char header[6];
+  ASSERT_EQ(reader->read(header, 6), 6);
+
+  io_buf buf;
+  buf.add_file(std::move(reader));
+  EXPECT_EQ(read_all(buf, 2), "body");
+}
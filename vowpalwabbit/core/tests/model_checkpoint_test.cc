@@ -0,0 +1,169 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/model_checkpoint.h"
+
+#include "vw/config/options_cli.h"
+#include "vw/core/global_data.h"
+#include "vw/core/learner.h"
+#include "vw/core/parse_example.h"
+#include "vw/core/parser.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::unique_ptr<VW::workspace> make_workspace(std::vector<std::string> args)
+{
+  args.insert(args.begin(), {"--no_stdin", "--quiet"});
+  return VW::initialize_experimental(VW::make_unique<VW::config::options_cli>(args));
+}
+
+// Learns from an example and lets the checkpointer know, as the driver does.
+void learn(VW::workspace& all, const std::string& line)
+{
+  auto& ex = VW::get_unused_example(&all);
+  VW::read_line(all, &ex, line.c_str());
+  VW::setup_example(all, &ex);
+  all.learn(ex);
+  all.finish_example(ex);
+  all.checkpointer->on_learn(all);
+}
+
+std::vector<char> read_file(const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::vector<char> save_to_memory(VW::workspace& all)
+{
+  auto model = std::make_shared<std::vector<char>>();
+  io_buf buffer;
+  buffer.add_file(VW::io::create_vector_writer(model));
+  VW::save_predictor(all, buffer);
+  return *model;
+}
+}  // namespace
+
+TEST(model_checkpoint_tests, async_checkpoint_matches_synchronous_save)
+{
+  const std::string file_name = "model_checkpoint_async.model";
+  auto vw = make_workspace({"-f", file_name, "--async_checkpoint", "--checkpoint_every_examples", "4"});
+  ASSERT_NE(vw->checkpointer, nullptr);
+  EXPECT_TRUE(vw->checkpointer->async_writes());
+
+  for (int i = 0; i < 8; i++) { learn(*vw, std::to_string(i % 2) + " | a b" + std::to_string(i % 3) + " c"); }
+  vw->checkpointer->wait();
+
+  EXPECT_EQ(vw->checkpointer->checkpoints_written(), 2);
+  EXPECT_EQ(read_file(file_name), save_to_memory(*vw));
+  EXPECT_FALSE(std::ifstream(file_name + ".writing").good());
+
+  std::remove(file_name.c_str());
+}
+
+TEST(model_checkpoint_tests, synchronous_periodic_checkpoint)
+{
+  const std::string file_name = "model_checkpoint_sync.model";
+  auto vw = make_workspace({"-f", file_name, "--checkpoint_every_examples", "3"});
+  ASSERT_NE(vw->checkpointer, nullptr);
+  EXPECT_FALSE(vw->checkpointer->async_writes());
+
+  for (int i = 0; i < 3; i++) { learn(*vw, "1 | a b c"); }
+  EXPECT_EQ(vw->checkpointer->checkpoints_written(), 1);
+  EXPECT_EQ(read_file(file_name), save_to_memory(*vw));
+
+  std::remove(file_name.c_str());
+}
+
+TEST(model_checkpoint_tests, explicit_save_is_synchronous_with_async_checkpoint)
+{
+  const std::string file_name = "model_checkpoint_explicit.model";
+  auto vw = make_workspace({"--async_checkpoint"});
+  learn(*vw, "1 | a b c");
+
+  // The file is complete when save_predictor returns, without waiting for the background writer.
+  VW::save_predictor(*vw, file_name);
+  EXPECT_EQ(read_file(file_name), save_to_memory(*vw));
+  EXPECT_EQ(vw->checkpointer->checkpoints_written(), 0);
+
+  std::remove(file_name.c_str());
+}
+
+TEST(model_checkpoint_tests, failed_async_write_is_reported)
+{
+  auto vw = make_workspace({"--async_checkpoint"});
+  vw->checkpointer->save_async(*vw, "model_checkpoint_missing_dir/model");
+  EXPECT_ANY_THROW(vw->checkpointer->wait());
+  EXPECT_EQ(vw->checkpointer->checkpoints_written(), 0);
+}
+
+TEST(model_checkpoint_tests, periodic_checkpoint_requires_final_regressor)
+{
+  EXPECT_THROW(make_workspace({"--checkpoint_every_examples", "10"}), VW::vw_exception);
+}
+
+TEST(model_checkpoint_tests, delta_chain_reproduces_model)
+{
+  const std::string file_name = "model_checkpoint_delta.model";
+  auto vw = make_workspace({"-f", file_name, "-b", "10", "--checkpoint_every_examples", "2", "--checkpoint_deltas",
+      "--delta_block_bits", "2"});
+  ASSERT_NE(vw->checkpointer, nullptr);
+  EXPECT_TRUE(vw->checkpointer->deltas());
+  EXPECT_TRUE(vw->weights.dense_weights.dirty_tracking());
+
+  for (int i = 0; i < 6; i++)
+  { learn(*vw, std::to_string(i % 2) + " | a" + std::to_string(i) + " b c" + std::to_string(i)); }
+  EXPECT_EQ(vw->checkpointer->checkpoints_written(), 3);
+
+  auto loaded = make_workspace({"-i", file_name + ".0", "--initial_deltas", file_name + ".1", "--initial_deltas",
+      file_name + ".2", "--preserve_performance_counters"});
+  EXPECT_EQ(save_to_memory(*loaded), save_to_memory(*vw));
+
+  // Without the last delta the model is missing the latest updates.
+  auto partial = make_workspace(
+      {"-i", file_name + ".0", "--initial_deltas", file_name + ".1", "--preserve_performance_counters"});
+  EXPECT_NE(save_to_memory(*partial), save_to_memory(*vw));
+
+  for (int i = 0; i < 3; i++) { std::remove((file_name + "." + std::to_string(i)).c_str()); }
+}
+
+TEST(model_checkpoint_tests, delta_checkpoints_require_dense_weights)
+{
+  EXPECT_THROW(make_workspace({"-f", "model_checkpoint_sparse.model", "--checkpoint_every_examples", "2",
+                   "--checkpoint_deltas", "--sparse_weights"}),
+      VW::vw_exception);
+}
+
+TEST(model_checkpoint_tests, learn_threads_save_periodic_checkpoints)
+{
+  const std::string file_name = "model_checkpoint_learn_threads.model";
+  auto vw = make_workspace({"-f", file_name, "--learn_threads", "3", "--checkpoint_every_examples", "10"});
+  // Queues the examples like the parser thread would.
+  for (int i = 0; i < 100; i++)
+  { vw->example_parser->ready_parsed_examples.push(VW::read_example(*vw, std::to_string(i % 2) + " | a b")); }
+  vw->example_parser->ready_parsed_examples.set_done();
+  VW::LEARNER::generic_driver(*vw);
+
+  EXPECT_EQ(vw->checkpointer->checkpoints_written(), 10);
+  EXPECT_EQ(read_file(file_name), save_to_memory(*vw));
+  std::remove(file_name.c_str());
+}
+
+TEST(model_checkpoint_tests, delta_checkpoints_reject_learn_threads)
+{
+  EXPECT_THROW(make_workspace({"-f", "model_checkpoint_learn_threads.model", "--checkpoint_every_examples", "2",
+                   "--checkpoint_deltas", "--learn_threads", "2"}),
+      VW::vw_exception);
+}
@@ -0,0 +1,155 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/parallel_parse.h"
+
+#include "vw/core/parse_example.h"
+#include "vw/core/parser.h"
+#include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace ::testing;
+
+TEST(parallel_parse_tests, examples_are_returned_in_input_order)
+{
+  std::string input;
+  for (int i = 0; i < 500; i++) { input += std::to_string(i) + " |f a:" + std::to_string(i + 1) + " b c\n"; }
+
+  auto& workspace = *VW::initialize("--quiet --no_stdin");
+  ASSERT_TRUE(VW::details::enable_parallel_parsing(workspace, 3));
+
+  auto& parser = *workspace.example_parser;
+  parser.input.add_file(VW::io::create_buffer_view(input.data(), input.size()));
+
+  size_t first_counter = 0;
+  for (int i = 0; i < 500; i++)
+  {
+    VW::multi_ex examples;
+    examples.push_back(&VW::get_unused_example(&workspace));
+    if (i == 0) { first_counter = examples[0]->example_counter; }
+    ASSERT_EQ(parser.reader(&workspace, parser.input, examples), 1);
+    ASSERT_EQ(examples.size(), 1);
+
+    // Examples are numbered in input order, whichever worker parsed them first.
+    EXPECT_EQ(examples[0]->example_counter, first_counter + i);
+
+    EXPECT_FLOAT_EQ(examples[0]->l.simple.label, static_cast<float>(i));
+    ASSERT_EQ(examples[0]->feature_space['f'].size(), 3);
+    EXPECT_FLOAT_EQ(examples[0]->feature_space['f'].values[0], static_cast<float>(i + 1));
+    VW::finish_example(workspace, examples);
+  }
+
+  VW::multi_ex examples;
+  examples.push_back(&VW::get_unused_example(&workspace));
+  EXPECT_EQ(parser.reader(&workspace, parser.input, examples), 0);
+  VW::finish_example(workspace, examples);
+
+  parser.parallel_parse->stop();
+  VW::finish(workspace);
+}
+
+TEST(parallel_parse_tests, multiline_json_examples_are_numbered_in_input_order)
+{
+  std::string input;
+  for (int i = 0; i < 100; i++)
+  {
+    input += R"({"_multi":[{"a":{"f":)" + std::to_string(i) + R"(}},{"b":{"g":1}}]})" + "\n";
+  }
+
+  auto& workspace = *VW::initialize("--quiet --no_stdin --json --cb_explore_adf");
+  ASSERT_TRUE(VW::details::enable_parallel_parsing(workspace, 3));
+
+  auto& parser = *workspace.example_parser;
+  parser.input.add_file(VW::io::create_buffer_view(input.data(), input.size()));
+
+  size_t expected_counter = 0;
+  for (int i = 0; i < 100; i++)
+  {
+    VW::multi_ex examples;
+    examples.push_back(&VW::get_unused_example(&workspace));
+    if (i == 0) { expected_counter = examples[0]->example_counter; }
+    ASSERT_EQ(parser.reader(&workspace, parser.input, examples), 1);
+    // The shared example, one per element of "_multi" and the newline example which ends the multi line example.
+    ASSERT_EQ(examples.size(), 4);
+    for (auto* ex : examples) { EXPECT_EQ(ex->example_counter, expected_counter++); }
+    VW::return_multiple_example(workspace, examples);
+  }
+
+  parser.parallel_parse->stop();
+  VW::finish(workspace);
+}
+
+TEST(parallel_parse_tests, parse_errors_refer_to_the_example_number)
+{
+  std::string input;
+  for (int i = 0; i < 100; i++) { input += i == 70 ? "1 |f a:nan\n" : "1 |f a b c\n"; }
+
+  auto& workspace = *VW::initialize("--quiet --no_stdin --strict_parse");
+  ASSERT_TRUE(VW::details::enable_parallel_parsing(workspace, 3));
+
+  auto& parser = *workspace.example_parser;
+  parser.input.add_file(VW::io::create_buffer_view(input.data(), input.size()));
+
+  size_t first_counter = 0;
+  for (int i = 0; i < 70; i++)
+  {
+    VW::multi_ex examples;
+    examples.push_back(&VW::get_unused_example(&workspace));
+    if (i == 0) { first_counter = examples[0]->example_counter; }
+    ASSERT_EQ(parser.reader(&workspace, parser.input, examples), 1);
+    VW::finish_example(workspace, examples);
+  }
+
+  // The line was parsed on a worker, but the error names the example as parsing on one thread would.
+  VW::multi_ex examples;
+  examples.push_back(&VW::get_unused_example(&workspace));
+  try
+  {
+    parser.reader(&workspace, parser.input, examples);
+    FAIL() << "Expected a strict_parse_exception";
+  }
+  catch (const VW::strict_parse_exception& e)
+  {
+    EXPECT_THAT(e.what(), HasSubstr("in Example #" + std::to_string(first_counter + 70) + ":"));
+  }
+  VW::finish_example(workspace, examples);
+
+  parser.parallel_parse->stop();
+  VW::finish(workspace);
+}
+
+TEST(parallel_parse_tests, stop_returns_parsed_ahead_examples)
+{
+  std::string input;
+  for (int i = 0; i < 200; i++) { input += "1 |f a b c\n"; }
+
+  auto& workspace = *VW::initialize("--quiet --no_stdin");
+  ASSERT_TRUE(VW::details::enable_parallel_parsing(workspace, 2));
+
+  auto& parser = *workspace.example_parser;
+  parser.input.add_file(VW::io::create_buffer_view(input.data(), input.size()));
+
+  VW::multi_ex examples;
+  examples.push_back(&VW::get_unused_example(&workspace));
+  ASSERT_EQ(parser.reader(&workspace, parser.input, examples), 1);
+  VW::finish_example(workspace, examples);
+
+  // Everything parsed ahead must go back to the pool, the pool asserts this when it is destroyed.
+  parser.parallel_parse->stop();
+  EXPECT_EQ(parser.input.num_files(), 1);
+  VW::finish(workspace);
+}
+
+TEST(parallel_parse_tests, unsupported_reader_is_left_alone)
+{
+  auto& workspace = *VW::initialize("--quiet --no_stdin --dsjson --cb_explore_adf");
+  EXPECT_FALSE(VW::details::enable_parallel_parsing(workspace, 2));
+  EXPECT_EQ(workspace.example_parser->parallel_parse, nullptr);
+  VW::finish(workspace);
+}
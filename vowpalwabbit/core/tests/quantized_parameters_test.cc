@@ -0,0 +1,137 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/array_parameters_quantized.h"
+
+#include "vw/config/options_cli.h"
+#include "vw/core/interactions_simd.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ::testing;
+
+namespace
+{
+constexpr uint32_t ROW_SHIFT = 2;
+constexpr uint64_t ROWS = 1 << 10;
+const std::vector<VW::weight_quantization> ALL_QUANTIZATIONS = {
+    VW::weight_quantization::fp16, VW::weight_quantization::bf16, VW::weight_quantization::int8};
+
+// Weights with learning state in the rest of each row, which must not leak into the quantized copy.
+std::vector<float> make_weights()
+{
+  std::mt19937 rng(7);
+  std::normal_distribution<float> distribution(0.f, 0.5f);
+  std::vector<float> weights(ROWS << ROW_SHIFT);
+  for (auto& w : weights) { w = distribution(rng); }
+  return weights;
+}
+
+// Largest difference between a weight and its quantized value allowed by the format.
+float error_bound(VW::weight_quantization quantization, float weight, float block_max_abs)
+{
+  switch (quantization)
+  {
+    case VW::weight_quantization::fp16:
+      return std::max(std::fabs(weight) * std::ldexp(1.f, -11), std::ldexp(1.f, -25));
+    case VW::weight_quantization::bf16:
+      return std::fabs(weight) * std::ldexp(1.f, -8);
+    default:
+      return block_max_abs / 127.f / 2.f * 1.0001f;
+  }
+}
+}  // namespace
+
+TEST(quantized_parameters_tests, dequantized_weights_are_within_format_precision)
+{
+  auto weights = make_weights();
+  constexpr uint64_t block_rows = uint64_t{1} << VW::quantized_parameters::INT8_BLOCK_BITS;
+  for (auto quantization : ALL_QUANTIZATIONS)
+  {
+    VW::quantized_parameters quantized(weights.data(), (ROWS << ROW_SHIFT) - 1, ROW_SHIFT, quantization);
+    EXPECT_EQ(quantized.rows(), ROWS);
+    for (uint64_t row = 0; row < ROWS; row++)
+    {
+      float block_max_abs = 0.f;
+      const uint64_t block = row / block_rows * block_rows;
+      for (uint64_t r = block; r < block + block_rows; r++)
+      { block_max_abs = std::max(block_max_abs, std::fabs(weights[r << ROW_SHIFT])); }
+
+      const float w = weights[row << ROW_SHIFT];
+      // Every index within the row, and beyond the mask, reads the weight of the row.
+      const auto index = static_cast<size_t>((row << ROW_SHIFT) + 3 + (ROWS << ROW_SHIFT));
+      EXPECT_NEAR(quantized[index], w, error_bound(quantization, w, block_max_abs)) << VW::to_string(quantization);
+    }
+  }
+}
+
+TEST(quantized_parameters_tests, memory_use)
+{
+  auto weights = make_weights();
+  const uint64_t mask = (ROWS << ROW_SHIFT) - 1;
+  EXPECT_EQ(VW::quantized_parameters(weights.data(), mask, ROW_SHIFT, VW::weight_quantization::fp16).memory_bytes(),
+      ROWS * 2);
+  EXPECT_EQ(VW::quantized_parameters(weights.data(), mask, ROW_SHIFT, VW::weight_quantization::bf16).memory_bytes(),
+      ROWS * 2);
+  EXPECT_EQ(VW::quantized_parameters(weights.data(), mask, ROW_SHIFT, VW::weight_quantization::int8).memory_bytes(),
+      ROWS + (ROWS >> VW::quantized_parameters::INT8_BLOCK_BITS) * sizeof(float));
+}
+
+TEST(quantized_parameters_tests, half_conversion_edge_cases)
+{
+  EXPECT_EQ(VW::float_to_half(1.f), 0x3c00);
+  EXPECT_EQ(VW::float_to_half(-2.f), 0xc000);
+  EXPECT_EQ(VW::float_to_half(65504.f), 0x7bff);
+  EXPECT_EQ(VW::float_to_half(1e6f), 0x7c00);
+  // Smallest subnormal half.
+  EXPECT_EQ(VW::float_to_half(std::ldexp(1.f, -24)), 0x0001);
+  EXPECT_EQ(VW::half_to_float(0x0001), std::ldexp(1.f, -24));
+  EXPECT_TRUE(std::isnan(VW::half_to_float(VW::float_to_half(std::numeric_limits<float>::quiet_NaN()))));
+
+  EXPECT_EQ(VW::float_to_bfloat16(1.f), 0x3f80);
+  EXPECT_EQ(VW::bfloat16_to_float(0x3f80), 1.f);
+  EXPECT_TRUE(std::isnan(VW::bfloat16_to_float(VW::float_to_bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(quantized_parameters_tests, interaction_dot_matches_scalar)
+{
+  auto weights = make_weights();
+  std::mt19937 rng(11);
+  std::normal_distribution<float> distribution(0.f, 1.f);
+  // Not a multiple of the eight features processed at once, so the scalar tail is used too.
+  std::vector<feature_index> indices(37);
+  std::vector<feature_value> values(indices.size());
+  for (size_t i = 0; i < indices.size(); i++)
+  {
+    indices[i] = static_cast<feature_index>(rng()) << ROW_SHIFT;
+    values[i] = distribution(rng);
+  }
+
+  for (auto quantization : ALL_QUANTIZATIONS)
+  {
+    VW::quantized_parameters quantized(weights.data(), (ROWS << ROW_SHIFT) - 1, ROW_SHIFT, quantization);
+    const float expected = INTERACTIONS::quantized_interaction_dot_scalar(
+        0.25f, quantized, indices.data(), values.data(), indices.size(), 0x1234 << ROW_SHIFT, 8, 0.5f);
+    EXPECT_EQ(INTERACTIONS::quantized_interaction_dot(
+                  0.25f, quantized, indices.data(), values.data(), indices.size(), 0x1234 << ROW_SHIFT, 8, 0.5f),
+        expected)
+        << VW::to_string(quantization);
+  }
+}
+
+TEST(quantized_parameters_tests, quantization_report_requires_test_only)
+{
+  EXPECT_THROW(
+      VW::initialize_experimental(VW::make_unique<VW::config::options_cli>(
+          std::vector<std::string>{"--no_stdin", "--quiet", "--quantization_report"})),
+      VW::vw_exception);
+}
@@ -0,0 +1,83 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/queue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(queue_tests, spsc_push_pop_in_order)
+{
+  VW::ptr_queue<int> queue{4, VW::queue_mode::spsc};
+  EXPECT_EQ(queue.mode(), VW::queue_mode::spsc);
+
+  std::vector<int> items = {1, 2, 3};
+  for (auto& item : items) { queue.push(&item); }
+  EXPECT_EQ(queue.size(), 3);
+
+  EXPECT_EQ(queue.pop(), &items[0]);
+  EXPECT_EQ(queue.pop(), &items[1]);
+  EXPECT_EQ(queue.pop(), &items[2]);
+  EXPECT_EQ(queue.size(), 0);
+
+  const auto stats = queue.stats();
+  EXPECT_EQ(stats.push_count, 3);
+  EXPECT_EQ(stats.pop_count, 3);
+  EXPECT_EQ(stats.max_occupancy, 3);
+  EXPECT_EQ(stats.occupancy_sum, 1 + 2 + 3);
+}
+
+TEST(queue_tests, spsc_drains_before_done)
+{
+  VW::ptr_queue<int> queue{2, VW::queue_mode::spsc};
+  int item = 7;
+  queue.push(&item);
+  queue.set_done();
+
+  EXPECT_EQ(queue.pop(), &item);
+  EXPECT_EQ(queue.pop(), nullptr);
+  EXPECT_EQ(queue.pop(), nullptr);
+}
+
+TEST(queue_tests, spsc_producer_consumer_threads)
+{
+  // A tiny capacity with a large number of items forces both sides to repeatedly spin and park.
+  constexpr size_t num_items = 20000;
+  std::vector<size_t> items(num_items);
+  for (size_t i = 0; i < num_items; i++) { items[i] = i; }
+
+  VW::ptr_queue<size_t> queue{3, VW::queue_mode::spsc};
+  std::thread producer([&]() {
+    for (auto& item : items) { queue.push(&item); }
+    queue.set_done();
+  });
+
+  size_t expected = 0;
+  size_t* current = nullptr;
+  while ((current = queue.pop()) != nullptr)
+  {
+    EXPECT_EQ(*current, expected);
+    expected++;
+  }
+  producer.join();
+
+  EXPECT_EQ(expected, num_items);
+  const auto stats = queue.stats();
+  EXPECT_EQ(stats.push_count, num_items);
+  EXPECT_EQ(stats.pop_count, num_items);
+  EXPECT_LE(stats.max_occupancy, 3);
+}
+
+TEST(queue_tests, locked_queue_has_no_stats)
+{
+  VW::ptr_queue<int> queue{2};
+  EXPECT_EQ(queue.mode(), VW::queue_mode::locked);
+
+  int item = 1;
+  queue.push(&item);
+  EXPECT_EQ(queue.pop(), &item);
+  EXPECT_EQ(queue.stats().push_count, 0);
+}
@@ -10,6 +10,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <memory>
 
 using namespace ::testing;
@@ -87,3 +90,58 @@ TEST(save_load_test, save_resume_behaves_as_if_dataset_concatenated)
   EXPECT_EQ(vw_all_data_single_run->sd->weighted_examples(), vw_second_half_from_loaded->sd->weighted_examples());
   EXPECT_EQ(vw_all_data_single_run->sd->sum_loss, vw_second_half_from_loaded->sd->sum_loss);
 }
+
+TEST(save_load_test, page_aligned_weights_are_mapped_or_read)
+{
+  const std::string file_name = "save_load_page_aligned.model";
+  const std::vector<std::string> input_data = {"1 | a b c", "-1 | b d", "1 | a e:0.5", "-1 | d e f"};
+
+  auto trained = VW::initialize_experimental(VW::make_unique<VW::config::options_cli>(
+      std::vector<std::string>{"--no_stdin", "--quiet", "-b", "10", "--page_aligned_weights"}));
+  for (const auto& item : input_data)
+  {
+    auto& ex = VW::get_unused_example(trained.get());
+    VW::read_line(*trained, &ex, item.c_str());
+    VW::setup_example(*trained, &ex);
+    trained->learn(ex);
+    trained->finish_example(ex);
+  }
+  VW::save_predictor(*trained, file_name);
+
+  // The weight array ends the file at an offset which is a multiple of 64KiB.
+  auto& trained_weights = trained->weights.dense_weights;
+  const size_t array_bytes = (trained_weights.mask() + 1) * sizeof(weight);
+  std::ifstream model_file(file_name, std::ios::binary | std::ios::ate);
+  const auto file_size = static_cast<size_t>(model_file.tellg());
+  ASSERT_GT(file_size, array_bytes);
+  EXPECT_EQ((file_size - array_bytes) % (1 << 16), 0);
+
+  // Predict only runs map the array, training runs read it.
+  for (const auto& mode : std::vector<std::string>{"-t", "--preserve_performance_counters"})
+  {
+    auto loaded = VW::initialize_experimental(VW::make_unique<VW::config::options_cli>(
+        std::vector<std::string>{"--no_stdin", "--quiet", "-i", file_name, mode}));
+    auto& loaded_weights = loaded->weights.dense_weights;
+    ASSERT_EQ(loaded_weights.mask(), trained_weights.mask());
+    EXPECT_EQ(0, std::memcmp(loaded_weights.first(), trained_weights.first(), array_bytes));
+
+    for (const auto& item : input_data)
+    {
+      auto& trained_ex = VW::get_unused_example(trained.get());
+      VW::read_line(*trained, &trained_ex, item.c_str());
+      VW::setup_example(*trained, &trained_ex);
+      trained->predict(trained_ex);
+
+      auto& loaded_ex = VW::get_unused_example(loaded.get());
+      VW::read_line(*loaded, &loaded_ex, item.c_str());
+      VW::setup_example(*loaded, &loaded_ex);
+      loaded->predict(loaded_ex);
+
+      EXPECT_FLOAT_EQ(trained_ex.pred.scalar, loaded_ex.pred.scalar);
+      trained->finish_example(trained_ex);
+      loaded->finish_example(loaded_ex);
+    }
+  }
+
+  std::remove(file_name.c_str());
+}
@@ -0,0 +1,116 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+const std::vector<std::vector<std::string>> SEQUENCES = {
+    {"1 | the", "2 | dog", "3 | runs"},
+    {"1 | a", "4 | big", "2 | cat", "3 | sleeps"},
+    {"1 | the", "4 | small", "4 | brown", "2 | dog", "3 | barks"},
+    {"2 | dogs", "3 | run", "4 | fast"},
+};
+
+void learn(VW::workspace& vw, const std::vector<std::vector<std::string>>& sequences, size_t passes)
+{
+  for (size_t pass = 0; pass < passes; pass++)
+  {
+    for (const auto& sequence : sequences)
+    {
+      VW::multi_ex examples;
+      for (const auto& line : sequence) { examples.push_back(VW::read_example(vw, line)); }
+      vw.learn(examples);
+      vw.finish_example(examples);
+    }
+  }
+}
+
+VW::workspace* train(const std::string& args, const std::vector<std::vector<std::string>>& sequences, size_t passes)
+{
+  auto* vw = VW::initialize("--quiet --no_stdin -b 12 --search 4 --search_task sequence " + args);
+  learn(*vw, sequences, passes);
+  return vw;
+}
+
+std::unique_ptr<VW::workspace> load(const std::shared_ptr<std::vector<char>>& model, std::vector<std::string> args)
+{
+  args.insert(args.end(), {"--quiet", "--no_stdin"});
+  return VW::initialize_experimental(VW::make_unique<VW::config::options_cli>(args),
+      VW::io::create_buffer_view(model->data(), model->size()));
+}
+
+void expect_same_weights(VW::workspace& expected, VW::workspace& actual)
+{
+  auto& expected_weights = expected.weights.dense_weights;
+  auto& actual_weights = actual.weights.dense_weights;
+  ASSERT_EQ(expected_weights.mask(), actual_weights.mask());
+  EXPECT_EQ(0,
+      std::memcmp(expected_weights.first(), actual_weights.first(), (expected_weights.mask() + 1) * sizeof(weight)));
+}
+}  // namespace
+
+TEST(search_rollout_threads_tests, number_of_threads_does_not_change_the_model)
+{
+  auto* two_threads = train("--search_rollout_threads 2", SEQUENCES, 3);
+  auto* four_threads = train("--search_rollout_threads 4", SEQUENCES, 3);
+  expect_same_weights(*two_threads, *four_threads);
+  EXPECT_EQ(two_threads->sd->sum_loss, four_threads->sd->sum_loss);
+  VW::finish(*two_threads);
+  VW::finish(*four_threads);
+}
+
+TEST(search_rollout_threads_tests, single_timestep_examples_match_serial_rollouts)
+{
+  // With one timestep per example there is nothing to batch, so the model is the one learned without threads.
+  const std::vector<std::vector<std::string>> single_words = {{"1 | the"}, {"2 | dog"}, {"3 | runs"}, {"4 | fast"}};
+  auto* serial = train("", single_words, 2);
+  auto* threaded = train("--search_rollout_threads 3", single_words, 2);
+  expect_same_weights(*serial, *threaded);
+  VW::finish(*serial);
+  VW::finish(*threaded);
+}
+
+TEST(search_rollout_threads_tests, multi_timestep_rollouts_match_serial_rollouts)
+{
+  // Threaded rollouts all see the weights from before the example, while serial ones see the updates from the earlier
+  // timesteps. With a learning rate of zero both see the same weights, and the adaptive and normalized state, which
+  // still accumulates the rollout losses learned from, must come out the same.
+  auto* warm = train("", SEQUENCES, 2);
+  auto model = std::make_shared<std::vector<char>>();
+  io_buf model_writer;
+  model_writer.add_file(VW::io::create_vector_writer(model));
+  VW::save_predictor(*warm, model_writer);
+  model_writer.flush();
+
+  auto serial = load(model, {"-l", "0"});
+  auto threaded = load(model, {"-l", "0", "--search_rollout_threads", "3"});
+  learn(*serial, SEQUENCES, 2);
+  learn(*threaded, SEQUENCES, 2);
+  expect_same_weights(*serial, *threaded);
+  EXPECT_EQ(serial->sd->sum_loss, threaded->sd->sum_loss);
+
+  // The rollouts did add to the state saved with the warm model.
+  auto& warm_weights = warm->weights.dense_weights;
+  EXPECT_NE(0,
+      std::memcmp(warm_weights.first(), serial->weights.dense_weights.first(),
+          (warm_weights.mask() + 1) * sizeof(weight)));
+  VW::finish(*warm);
+}
+
+TEST(search_rollout_threads_tests, unsupported_options_throw)
+{
+  EXPECT_THROW(train("--search_rollout_threads 0", SEQUENCES, 0), VW::vw_exception);
+  EXPECT_THROW(train("--search_rollout_threads 2 --sparse_weights", SEQUENCES, 0), VW::vw_exception);
+  EXPECT_THROW(train("--search_rollout_threads 2 --search_metatask debug", SEQUENCES, 0), VW::vw_exception);
+}
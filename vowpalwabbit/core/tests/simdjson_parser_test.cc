@@ -0,0 +1,228 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/parallel_parse.h"
+#include "vw/core/parse_example_json.h"
+#include "vw/core/parser.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+#ifdef VW_BUILD_SIMDJSON
+#  include "vw/core/parse_example_simdjson.h"
+
+namespace
+{
+VW::multi_ex parse_json_line(VW::workspace& all, const std::string& line)
+{
+  VW::multi_ex examples;
+  examples.push_back(&VW::get_unused_example(&all));
+  line_to_examples_json<true>(&all, line.c_str(), line.size(), examples);
+  return examples;
+}
+
+void expect_same_features(const VW::example& expected, const VW::example& actual)
+{
+  EXPECT_THAT(std::vector<VW::namespace_index>(actual.indices.begin(), actual.indices.end()),
+      ContainerEq(std::vector<VW::namespace_index>(expected.indices.begin(), expected.indices.end())));
+  for (auto ns : expected.indices)
+  {
+    const auto& expected_features = expected.feature_space[ns];
+    const auto& actual_features = actual.feature_space[ns];
+    EXPECT_THAT(std::vector<feature_index>(actual_features.indices.begin(), actual_features.indices.end()),
+        ContainerEq(std::vector<feature_index>(expected_features.indices.begin(), expected_features.indices.end())));
+    EXPECT_THAT(std::vector<feature_value>(actual_features.values.begin(), actual_features.values.end()),
+        ContainerEq(std::vector<feature_value>(expected_features.values.begin(), expected_features.values.end())));
+    ASSERT_EQ(actual_features.space_names.size(), expected_features.space_names.size());
+    for (size_t i = 0; i < expected_features.space_names.size(); i++)
+    {
+      EXPECT_EQ(actual_features.space_names[i].ns, expected_features.space_names[i].ns);
+      EXPECT_EQ(actual_features.space_names[i].name, expected_features.space_names[i].name);
+    }
+  }
+  EXPECT_EQ(std::string(actual.tag.begin(), actual.tag.end()), std::string(expected.tag.begin(), expected.tag.end()));
+  EXPECT_EQ(actual.is_newline, expected.is_newline);
+}
+
+void expect_same_label(VW::label_type_t label_type, const VW::example& expected, const VW::example& actual)
+{
+  switch (label_type)
+  {
+    case VW::label_type_t::simple:
+      EXPECT_EQ(actual.l.simple.label, expected.l.simple.label);
+      EXPECT_EQ(actual._reduction_features.template get<simple_label_reduction_features>().weight,
+          expected._reduction_features.template get<simple_label_reduction_features>().weight);
+      break;
+    case VW::label_type_t::cb:
+      ASSERT_EQ(actual.l.cb.costs.size(), expected.l.cb.costs.size());
+      for (size_t i = 0; i < expected.l.cb.costs.size(); i++)
+      {
+        EXPECT_EQ(actual.l.cb.costs[i].cost, expected.l.cb.costs[i].cost);
+        EXPECT_EQ(actual.l.cb.costs[i].action, expected.l.cb.costs[i].action);
+        EXPECT_EQ(actual.l.cb.costs[i].probability, expected.l.cb.costs[i].probability);
+      }
+      EXPECT_EQ(actual.l.cb.weight, expected.l.cb.weight);
+      break;
+    case VW::label_type_t::ccb:
+    {
+      const auto& expected_label = expected.l.conditional_contextual_bandit;
+      const auto& actual_label = actual.l.conditional_contextual_bandit;
+      EXPECT_EQ(actual_label.type, expected_label.type);
+      EXPECT_EQ(actual_label.weight, expected_label.weight);
+      EXPECT_THAT(
+          std::vector<uint32_t>(actual_label.explicit_included_actions.begin(),
+              actual_label.explicit_included_actions.end()),
+          ContainerEq(std::vector<uint32_t>(
+              expected_label.explicit_included_actions.begin(), expected_label.explicit_included_actions.end())));
+      ASSERT_EQ(actual_label.outcome == nullptr, expected_label.outcome == nullptr);
+      if (expected_label.outcome != nullptr)
+      {
+        EXPECT_EQ(actual_label.outcome->cost, expected_label.outcome->cost);
+        ASSERT_EQ(actual_label.outcome->probabilities.size(), expected_label.outcome->probabilities.size());
+        for (size_t i = 0; i < expected_label.outcome->probabilities.size(); i++)
+        {
+          EXPECT_EQ(actual_label.outcome->probabilities[i].action, expected_label.outcome->probabilities[i].action);
+          EXPECT_EQ(actual_label.outcome->probabilities[i].score, expected_label.outcome->probabilities[i].score);
+        }
+      }
+      break;
+    }
+    default:
+      FAIL() << "label type not compared";
+  }
+}
+
+// Parses every line with both backends and checks the examples are the same. Returns the number of lines simdjson left
+// to rapidjson.
+uint64_t expect_same_examples(const std::string& args, const std::vector<std::string>& lines)
+{
+  auto& rapidjson_vw = *VW::initialize(args + " --quiet --no_stdin");
+  auto& simdjson_vw = *VW::initialize(args + " --quiet --no_stdin --json_parser simdjson");
+  EXPECT_EQ(rapidjson_vw.example_parser->simdjson_parser, nullptr);
+  EXPECT_NE(simdjson_vw.example_parser->simdjson_parser, nullptr);
+
+  const auto label_type = rapidjson_vw.example_parser->lbl_parser.label_type;
+  for (const auto& line : lines)
+  {
+    auto expected = parse_json_line(rapidjson_vw, line);
+    auto actual = parse_json_line(simdjson_vw, line);
+    EXPECT_EQ(actual.size(), expected.size()) << line;
+    for (size_t i = 0; i < std::min(expected.size(), actual.size()); i++)
+    {
+      SCOPED_TRACE(line + " example " + std::to_string(i));
+      expect_same_features(*expected[i], *actual[i]);
+      expect_same_label(label_type, *expected[i], *actual[i]);
+    }
+    VW::finish_example(rapidjson_vw, expected);
+    VW::finish_example(simdjson_vw, actual);
+  }
+
+  const uint64_t fallbacks = simdjson_vw.example_parser->simdjson_parser->fallback_count();
+  VW::finish(rapidjson_vw);
+  VW::finish(simdjson_vw);
+  return fallbacks;
+}
+}  // namespace
+
+TEST(simdjson_parser_tests, json_examples_match_rapidjson)
+{
+  const std::vector<std::string> lines = {
+      R"({"_label":1,"_tag":"first","user":{"age":3,"city":"seattle","member":true,"inactive":false},"x":[1,2.5,null,-3]})",
+      R"({"_label":{"Label":-1,"Weight":0.5},"_text":"a b c","a":{"b":{"c":1.25e2}},"s":"with \"quotes\" and \\"})",
+      R"({"_label":-1,"_ignored":{"x":[1,"}"]},"ns":[{"f":"v"},{"g":1}],"__private":2})",
+      R"({"_label":"0.5 2","n":{"big":4294967296,"neg":-7,"tiny":1e-45,"null":null}})",
+  };
+  EXPECT_EQ(expect_same_examples("--json", lines), 0);
+}
+
+TEST(simdjson_parser_tests, dsjson_cb_examples_match_rapidjson)
+{
+  const std::vector<std::string> lines = {
+      R"({"_label_cost":-0.0,"_label_probability":0.05000000074505806,"_label_Action":4,"_labelIndex":3,"o":[{"v":0.0,"EventId":"13118d9b","ActionTaken":false}],"Timestamp":"2021-02-04T16:31:29.2460000Z","Version":"1","EventId":"13118d9b","a":[4,2,1,3],"c":{"FromUrl":[{"timeofday":"Afternoon","weather":"Sunny","name":"Cathy"}],"_multi":[{"_tag":"Cappucino","i":{"constant":1,"id":"Cappucino"},"j":[{"type":"hot","origin":"kenya"}]},{"_tag":"Cold brew","i":{"constant":1,"id":"Cold brew"},"j":[{"type":"cold","origin":"brazil"}]},{"_tag":"Iced mocha","i":{"constant":1,"id":"Iced mocha"}},{"_tag":"Latte","i":{"constant":1,"id":"Latte"}}]},"p":[0.05,0.05,0.05,0.85],"VWState":{"m":"ff0744c1"},"_original_label_cost":-0.0})",
+      R"({"_label_cost":-1.0,"_label_probability":0.5,"_label_Action":2,"_labelIndex":1,"a":[2,1],"c":{"shared":{"f":"1"},"_multi":[{"action":{"f":"1"}},{"action":{"f":"2"}}]},"p":[0.5,0.5],"pdrop":0.9})",
+      R"({"_label_cost":0.5,"_label_probability":0.25,"_label_Action":1,"_labelIndex":0,"a":[1,2],"c":{"_multi":[{"a":{"x":1}},{"a":{"x":2}}]},"_p":[0.25,0.75],"_skipLearn":false})",
+  };
+  EXPECT_EQ(expect_same_examples("--dsjson --cb_explore_adf", lines), 0);
+}
+
+TEST(simdjson_parser_tests, dsjson_ccb_examples_match_rapidjson)
+{
+  const std::vector<std::string> lines = {
+      R"({"Timestamp":"2021-04-26T17:23:28.1726275","Version":"1","EventId":"0000000","c":{"FromUrl":[{"weather":"sunny"}],"_multi":[{"_tag":"Mocha","i":{"constant":1,"id":"Mocha"},"j":[{"roast":"light"}]},{"_tag":"Latte","i":{"constant":1,"id":"Latte"},"j":[{"roast":"dark"}]},{"_tag":"Cappuccino","i":{"constant":1,"id":"Cappuccino"},"j":[{"roast":"dark"}]},{"_tag":"Americano","i":{"constant":1,"id":"Americano"},"j":[{"roast":"light"}]}],"_slots":[{"_id":"MainArticle","sj":[{"size":"Large","position":"Center"}]},{"_id":"SideBar","_inc":[1,2],"sj":[{"size":"Medium","position":"Right"}]}]},"_outcomes":[{"_label_cost":0.0,"_id":"MainArticle","_a":[3,1,2,0],"_p":[0.25,0.25,0.25,0.25],"_o":[],"_original_label_cost":0.0},{"_label_cost":1.0,"_id":"SideBar","_a":[1,2],"_p":[0.5,0.5],"_o":[],"_original_label_cost":1.0}],"_ba":[1,2],"VWState":{"m":"N/A"}})",
+  };
+  EXPECT_EQ(expect_same_examples("--dsjson --ccb_explore_adf", lines), 0);
+}
+
+TEST(simdjson_parser_tests, unsupported_lines_fall_back_to_rapidjson)
+{
+  // rapidjson skips "_p" inside the context of a decision service line by rewriting its value in place.
+  const std::vector<std::string> lines = {
+      R"({"_label_cost":1,"_label_probability":0.5,"_label_Action":1,"_labelIndex":0,"a":[1,2],"c":{"_p":[0.5,0.5],"_multi":[{"a":{"x":1}},{"a":{"x":2}}]},"p":[0.5,0.5]})",
+  };
+  EXPECT_EQ(expect_same_examples("--dsjson --cb_explore_adf", lines), 1);
+}
+
+TEST(simdjson_parser_tests, ignored_keys_match_rapidjson)
+{
+  // rapidjson finds the end of an ignored value by scanning for ',', '}' or ']' outside of nested strings and brackets.
+  const std::vector<std::string> lines = {
+      R"({"_ignored":{"x":["]",{"y":"}\","}]},"a":{"x":1}})",
+      R"({"_ignored": 1 ,"a":{"x":1}})",
+  };
+  EXPECT_EQ(expect_same_examples("--json", lines), 0);
+
+  // Unknown decision service properties are skipped the same way.
+  const std::vector<std::string> dsjson_lines = {
+      R"({"_label_cost":1,"_label_probability":0.5,"_label_Action":1,"_labelIndex":0,"o":[{"v":1}],"a":[1,2],"c":{"_multi":[{"a":{"x":1}},{"a":{"x":2}}]},"p":[0.5,0.5],"VWState":{"m":"x"}})",
+  };
+  EXPECT_EQ(expect_same_examples("--dsjson --cb_explore_adf", dsjson_lines), 0);
+}
+
+TEST(simdjson_parser_tests, ignored_keys_rejected_by_rapidjson_fall_back)
+{
+  // The scan needs the ':' right after the key, so rapidjson rejects this line and simdjson must not accept it.
+  const std::string line = R"({"_ignored" :1,"a":{"x":1}})";
+  for (const std::string parser : {"rapidjson", "simdjson"})
+  {
+    auto& vw = *VW::initialize("--json --quiet --no_stdin --json_parser " + parser);
+    VW::multi_ex examples;
+    examples.push_back(&VW::get_unused_example(&vw));
+    EXPECT_THROW(line_to_examples_json<true>(&vw, line.c_str(), line.size(), examples), VW::vw_exception) << parser;
+    VW::finish_example(vw, examples);
+    if (vw.example_parser->simdjson_parser != nullptr)
+    { EXPECT_EQ(vw.example_parser->simdjson_parser->fallback_count(), 1); }
+    VW::finish(vw);
+  }
+}
+
+TEST(simdjson_parser_tests, not_created_for_text_input)
+{
+  auto& vw = *VW::initialize("--quiet --no_stdin --json_parser simdjson");
+  EXPECT_EQ(vw.example_parser->simdjson_parser, nullptr);
+  VW::finish(vw);
+}
+
+TEST(simdjson_parser_tests, parse_threads_are_not_used)
+{
+  // The parse threads only know how to parse json with rapidjson.
+  auto& vw = *VW::initialize("--quiet --no_stdin --json --json_parser simdjson");
+  EXPECT_FALSE(VW::details::enable_parallel_parsing(vw, 2));
+  EXPECT_EQ(vw.example_parser->parallel_parse, nullptr);
+  VW::finish(vw);
+}
+
+#else
+
+TEST(simdjson_parser_tests, requires_build_flag)
+{
+  EXPECT_THROW(VW::initialize("--json --quiet --no_stdin --json_parser simdjson"), VW::vw_exception);
+}
+
+#endif
@@ -0,0 +1,75 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/stream_vbyte.h"
+
+#include "vw/common/vw_exception.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace ::testing;
+
+namespace
+{
+std::vector<uint32_t> make_values(size_t count)
+{
+  std::mt19937 rng(42);
+  std::vector<uint32_t> values(count);
+  // Mix every encoded length so all control byte patterns occur.
+  for (auto& value : values) { value = rng() >> (8 * (rng() % 4)); }
+  return values;
+}
+}  // namespace
+
+TEST(stream_vbyte_tests, round_trip)
+{
+  for (size_t count : {0, 1, 3, 4, 5, 17, 1000})
+  {
+    const auto values = make_values(count);
+    std::vector<uint8_t> encoded(VW::details::stream_vbyte_max_encoded_size(count));
+    const auto encoded_size = VW::details::stream_vbyte_encode(values.data(), count, encoded.data());
+    EXPECT_LE(encoded_size, encoded.size());
+
+    std::vector<uint32_t> decoded(count);
+    EXPECT_EQ(VW::details::stream_vbyte_decode(encoded.data(), encoded_size, count, decoded.data()), encoded_size);
+    EXPECT_THAT(decoded, ContainerEq(values));
+  }
+}
+
+TEST(stream_vbyte_tests, simd_matches_scalar)
+{
+  const auto values = make_values(4099);
+  std::vector<uint8_t> encoded(VW::details::stream_vbyte_max_encoded_size(values.size()));
+  const auto encoded_size = VW::details::stream_vbyte_encode(values.data(), values.size(), encoded.data());
+
+  std::vector<uint32_t> decoded(values.size());
+  std::vector<uint32_t> decoded_scalar(values.size());
+  EXPECT_EQ(VW::details::stream_vbyte_decode(encoded.data(), encoded_size, values.size(), decoded.data()),
+      VW::details::stream_vbyte_decode_scalar(encoded.data(), encoded_size, values.size(), decoded_scalar.data()));
+  EXPECT_THAT(decoded, ContainerEq(decoded_scalar));
+}
+
+TEST(stream_vbyte_tests, small_values_use_one_byte)
+{
+  const std::vector<uint32_t> values(64, 7);
+  std::vector<uint8_t> encoded(VW::details::stream_vbyte_max_encoded_size(values.size()));
+  EXPECT_EQ(VW::details::stream_vbyte_encode(values.data(), values.size(), encoded.data()), 16 + 64);
+}
+
+TEST(stream_vbyte_tests, truncated_input_throws)
+{
+  const auto values = make_values(100);
+  std::vector<uint8_t> encoded(VW::details::stream_vbyte_max_encoded_size(values.size()));
+  const auto encoded_size = VW::details::stream_vbyte_encode(values.data(), values.size(), encoded.data());
+
+  std::vector<uint32_t> decoded(values.size());
+  EXPECT_THROW(VW::details::stream_vbyte_decode(encoded.data(), encoded_size - 1, values.size(), decoded.data()),
+      VW::vw_exception);
+  EXPECT_THROW(VW::details::stream_vbyte_decode(encoded.data(), 10, values.size(), decoded.data()), VW::vw_exception);
+}
@@ -0,0 +1,63 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/text_structural_index.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+using namespace ::testing;
+
+namespace
+{
+std::string make_text(size_t size)
+{
+  std::mt19937 rng(5);
+  const std::string alphabet = "ab09.-_ \t:|\r\n\x80";
+  std::string text(size, ' ');
+  for (auto& c : text) { c = alphabet[rng() % alphabet.size()]; }
+  return text;
+}
+}  // namespace
+
+TEST(text_structural_index_tests, mask_matches_scalar)
+{
+  const auto text = make_text(VW::details::STRUCTURAL_BLOCK_SIZE);
+  for (size_t size = 0; size <= text.size(); size++)
+  {
+    EXPECT_EQ(
+        VW::details::structural_mask(text.data(), size), VW::details::structural_mask_scalar(text.data(), size))
+        << size;
+  }
+}
+
+TEST(text_structural_index_tests, scanner_finds_every_structural_character)
+{
+  for (size_t size : {0, 1, 63, 64, 65, 200})
+  {
+    const auto text = make_text(size);
+    VW::details::structural_scanner scanner(text);
+    size_t expected = text.find_first_of(" \t:|\r");
+    size_t pos = 0;
+    while (expected != std::string::npos)
+    {
+      pos = scanner.next(pos);
+      EXPECT_EQ(pos, expected);
+      expected = text.find_first_of(" \t:|\r", ++pos);
+    }
+    EXPECT_EQ(scanner.next(pos), text.size());
+  }
+}
+
+TEST(text_structural_index_tests, scanner_skips_long_names)
+{
+  const std::string text = std::string(150, 'x') + ":1 y";
+  VW::details::structural_scanner scanner(text);
+  EXPECT_EQ(scanner.next(0), 150);
+  EXPECT_EQ(scanner.next(151), 152);
+  EXPECT_EQ(scanner.next(153), text.size());
+}
@@ -201,11 +201,55 @@ void parser::parse_namespaces(VW::workspace* all, example* ae, const Namespace*
   auto& fs = ae->feature_space[index];
 
   if (hash_found) { fs.start_ns_extent(hash); }
-  for (const auto& feature : *(ns->features()))
-  { parse_features(all, fs, feature, (all->audit || all->hash_inv) ? ns->name() : nullptr); }
+  if (flatbuffers::IsFieldPresent(ns, Namespace::VT_FEATURE_HASHES)) { parse_feature_arrays(all, fs, ns); }
+  else if (flatbuffers::IsFieldPresent(ns, Namespace::VT_FEATURES))
+  {
+    for (const auto& feature : *(ns->features()))
+    { parse_features(all, fs, feature, (all->audit || all->hash_inv) ? ns->name() : nullptr); }
+  }
   if (hash_found) { fs.end_ns_extent(); }
 }
 
+void parser::parse_feature_arrays(VW::workspace* all, features& fs, const Namespace* ns)
+{
+  const auto* hashes = ns->feature_hashes();
+  const auto* values = ns->feature_values();
+  if (values == nullptr || values->size() != hashes->size())
+  {
+    THROW("Flatbuffer namespace has " << hashes->size() << " feature hashes but "
+                                      << (values == nullptr ? 0 : values->size()) << " feature values");
+  }
+  const auto* names = ns->feature_names();
+  if (names != nullptr && names->size() != hashes->size())
+  {
+    THROW("Flatbuffer namespace has " << hashes->size() << " feature hashes but " << names->size()
+                                      << " feature names");
+  }
+
+  const size_t count = hashes->size();
+  const size_t first = fs.size();
+#if FLATBUFFERS_LITTLEENDIAN
+  // Scalars in flatbuffer vectors are stored little endian, so on these platforms both arrays can be copied as is.
+  fs.values.insert(fs.values.end(), values->data(), values->data() + count);
+  fs.indices.insert(fs.indices.end(), hashes->data(), hashes->data() + count);
+#else
+  fs.values.reserve(first + count);
+  fs.indices.reserve(first + count);
+  for (flatbuffers::uoffset_t i = 0; i < count; i++)
+  {
+    fs.values.push_back(values->Get(i));
+    fs.indices.push_back(hashes->Get(i));
+  }
+#endif
+  for (size_t i = first; i < fs.size(); i++) { fs.sum_feat_sq += fs.values[i] * fs.values[i]; }
+
+  if ((all->audit || all->hash_inv) && names != nullptr)
+  {
+    const char* ns_name = ns->name() != nullptr ? ns->name()->c_str() : "";
+    for (const auto* name : *names) { fs.space_names.push_back(audit_strings(ns_name, name->c_str())); }
+  }
+}
+
 void parser::parse_features(VW::workspace* all, features& fs, const Feature* feature, const flatbuffers::String* ns)
 {
   if (flatbuffers::IsFieldPresent(feature, Feature::VT_NAME))
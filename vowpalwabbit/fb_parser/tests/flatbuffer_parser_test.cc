@@ -141,3 +141,72 @@ TEST(flatbuffer_parser_tests, test_flatbuffer_collection)
   VW::finish_example(*all, *examples[0]);
   VW::finish(*all);
 }
+
+TEST(flatbuffer_parser_tests, test_flatbuffer_struct_of_arrays_collection)
+{
+  auto all = VW::initialize("--no_stdin --quiet --flatbuffer", nullptr, false, nullptr, nullptr);
+
+  flatbuffers::FlatBufferBuilder builder;
+
+  std::vector<flatbuffers::Offset<VW::parsers::flatbuffer::Example>> examples;
+  std::vector<flatbuffers::Offset<VW::parsers::flatbuffer::Namespace>> namespaces;
+  std::vector<uint64_t> hashes = {1, 5, 9};
+  std::vector<float> values = {2.f, 0.5f, -1.f};
+
+  auto label = get_label(builder, VW::parsers::flatbuffer::Label_SimpleLabel);
+  namespaces.push_back(VW::parsers::flatbuffer::CreateNamespaceDirect(
+      builder, nullptr, constant_namespace, nullptr, 128, &hashes, &values));
+  examples.push_back(VW::parsers::flatbuffer::CreateExampleDirect(
+      builder, &namespaces, VW::parsers::flatbuffer::Label_SimpleLabel, label));
+  auto eg_collection = VW::parsers::flatbuffer::CreateExampleCollectionDirect(builder, &examples);
+  builder.FinishSizePrefixed(CreateExampleRoot(
+      builder, VW::parsers::flatbuffer::ExampleType_ExampleCollection, eg_collection.Union()));
+
+  uint8_t* buf = builder.GetBufferPointer();
+
+  VW::multi_ex parsed;
+  parsed.push_back(&VW::get_unused_example(all));
+  io_buf unused_buffer;
+  all->flat_converter->parse_examples(all, unused_buffer, parsed, buf);
+
+  EXPECT_EQ(parsed.size(), 1);
+  EXPECT_EQ(parsed[0]->indices[0], constant_namespace);
+  const auto& fs = parsed[0]->feature_space[constant_namespace];
+  EXPECT_THAT(std::vector<uint64_t>(fs.indices.begin(), fs.indices.end()), testing::ElementsAre(1, 5, 9));
+  EXPECT_THAT(std::vector<float>(fs.values.begin(), fs.values.end()), testing::ElementsAre(2.f, 0.5f, -1.f));
+  EXPECT_FLOAT_EQ(fs.sum_feat_sq, 5.25f);
+  EXPECT_EQ(fs.namespace_extents.size(), 1);
+  EXPECT_EQ(fs.namespace_extents[0], (VW::namespace_extent{0, 3, 128}));
+
+  VW::finish_example(*all, *parsed[0]);
+  VW::finish(*all);
+}
+
+TEST(flatbuffer_parser_tests, test_flatbuffer_struct_of_arrays_size_mismatch)
+{
+  auto all = VW::initialize("--no_stdin --quiet --flatbuffer", nullptr, false, nullptr, nullptr);
+
+  flatbuffers::FlatBufferBuilder builder;
+
+  std::vector<flatbuffers::Offset<VW::parsers::flatbuffer::Namespace>> namespaces;
+  std::vector<uint64_t> hashes = {1, 5, 9};
+  std::vector<float> values = {2.f};
+
+  auto label = get_label(builder, VW::parsers::flatbuffer::Label_SimpleLabel);
+  namespaces.push_back(VW::parsers::flatbuffer::CreateNamespaceDirect(
+      builder, nullptr, constant_namespace, nullptr, 128, &hashes, &values));
+  auto example = VW::parsers::flatbuffer::CreateExampleDirect(
+      builder, &namespaces, VW::parsers::flatbuffer::Label_SimpleLabel, label);
+  builder.FinishSizePrefixed(
+      CreateExampleRoot(builder, VW::parsers::flatbuffer::ExampleType_Example, example.Union()));
+
+  uint8_t* buf = builder.GetBufferPointer();
+
+  VW::multi_ex parsed;
+  parsed.push_back(&VW::get_unused_example(all));
+  io_buf unused_buffer;
+  EXPECT_THROW(all->flat_converter->parse_examples(all, unused_buffer, parsed, buf), VW::vw_exception);
+
+  VW::finish_example(*all, *parsed[0]);
+  VW::finish(*all);
+}
@@ -6,6 +6,7 @@
 
 #include "vw/common/vw_exception.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,6 +45,21 @@ struct reader
   /// \returns the number of bytes successfully read into buffer
   virtual ssize_t read(char* buffer, size_t num_bytes) = 0;
 
+  /// Readers whose contents are already in memory can hand out the next part of it instead of copying it with read.
+  /// Consecutive views of the same reader are contiguous in memory and stay valid until the reader is destroyed. Views
+  /// and read share the same position.
+  /// \param data set to the beginning of the view
+  /// \param num_bytes set to the size of the view
+  /// \returns false if this reader does not support views or there is nothing left to read
+  virtual bool read_view(char*& /*data*/, size_t& /*num_bytes*/) { return false; }
+
+  /// Readers backed by a regular file can map part of it into memory copy-on-write. Pages which are never written to
+  /// are shared with every other process that maps the same file. Independent of the read position.
+  /// \param offset position in the file, must be a multiple of the page size
+  /// \param num_bytes length of the mapping
+  /// \returns the mapping, which the caller releases with munmap, or nullptr if this reader can not map the range
+  virtual void* map_private(uint64_t /*offset*/, size_t /*num_bytes*/) { return nullptr; }
+
   /// This function will throw if the reader does not support reseting. Users
   /// should check if this io_adapter is resetable before trying to reset.
   /// \throw VW::vw_exception if reader does not support resetting.
@@ -97,6 +113,11 @@ std::unique_ptr<writer> open_file_writer(const std::string& file_path);
 std::unique_ptr<reader> open_file_reader(const std::string& file_path);
 std::unique_ptr<writer> open_compressed_file_writer(const std::string& file_path);
 std::unique_ptr<reader> open_compressed_file_reader(const std::string& file_path);
+
+/// Maps the whole file into memory and supports read_view, so that io_buf can read from it without copying. The
+/// kernel is told the file is read sequentially and the next window is prefetched whenever a view is handed out.
+/// Falls back to a regular file reader on platforms without mmap.
+std::unique_ptr<reader> open_mmap_file_reader(const std::string& file_path);
 std::unique_ptr<reader> open_compressed_stdin();
 std::unique_ptr<writer> open_compressed_stdout();
 std::unique_ptr<reader> open_stdin();
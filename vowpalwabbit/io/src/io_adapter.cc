@@ -10,6 +10,7 @@
 #  include <io.h>
 #  include <winsock2.h>
 #else
+#  include <sys/mman.h>
 #  include <sys/socket.h>
 #  include <unistd.h>
 #endif
@@ -87,6 +88,7 @@ struct file_adapter : public writer, public reader
   ssize_t read(char* buffer, size_t num_bytes) override;
   ssize_t write(const char* buffer, size_t num_bytes) override;
   void reset() override;
+  void* map_private(uint64_t offset, size_t num_bytes) override;
 
 private:
   int _file_descriptor;
@@ -158,6 +160,24 @@ private:
   std::shared_ptr<std::vector<char>> _buffer;
 };
 
+#ifndef _WIN32
+struct mmap_file_reader : public reader
+{
+  mmap_file_reader(const char* filename);
+  ~mmap_file_reader();
+  ssize_t read(char* buffer, size_t num_bytes) override;
+  bool read_view(char*& data, size_t& num_bytes) override;
+  void reset() override;
+
+private:
+  void prefetch(size_t offset);
+
+  char* _data = nullptr;
+  size_t _len = 0;
+  size_t _read_offset = 0;
+};
+#endif
+
 struct buffer_view : public reader
 {
   buffer_view(const char* data, size_t len);
@@ -195,6 +215,15 @@ std::unique_ptr<reader> open_compressed_file_reader(const std::string& file_path
   return std::unique_ptr<reader>(new gzip_file_adapter(file_path.c_str(), file_mode::read));
 }
 
+std::unique_ptr<reader> open_mmap_file_reader(const std::string& file_path)
+{
+#ifdef _WIN32
+  return open_file_reader(file_path);
+#else
+  return std::unique_ptr<reader>(new mmap_file_reader(file_path.c_str()));
+#endif
+}
+
 std::unique_ptr<reader> open_compressed_stdin() { return std::unique_ptr<reader>(new gzip_stdio_adapter()); }
 
 std::unique_ptr<writer> open_compressed_stdout() { return std::unique_ptr<writer>(new gzip_stdio_adapter()); }
@@ -336,6 +365,26 @@ void file_adapter::reset()
 #endif
 }
 
+void* file_adapter::map_private(uint64_t offset, size_t num_bytes)
+{
+#ifdef _WIN32
+  _UNUSED(offset);
+  _UNUSED(num_bytes);
+  return nullptr;
+#else
+  if (_mode != file_mode::read || num_bytes == 0) { return nullptr; }
+
+  // Pages beyond the end of the file raise SIGBUS when touched, so only map ranges the file covers.
+  struct stat file_stat;
+  if (fstat(_file_descriptor, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) { return nullptr; }
+  if (offset + num_bytes > static_cast<uint64_t>(file_stat.st_size)) { return nullptr; }
+
+  void* mapped =
+      mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, _file_descriptor, static_cast<off_t>(offset));
+  return mapped == MAP_FAILED ? nullptr : mapped;
+#endif
+}
+
 file_adapter::~file_adapter()
 {
   if (_should_close)
@@ -445,6 +494,92 @@ ssize_t custom_func_writer::write(const char* buffer, size_t num_bytes)
   return _write_func(_context, buffer, num_bytes);
 }
 
+#ifndef _WIN32
+//
+// mmap_file_reader
+//
+
+namespace
+{
+// Size of the views handed out by mmap_file_reader. The window after the current one is prefetched.
+constexpr size_t MMAP_WINDOW_SIZE = 64 * 1024 * 1024;
+}  // namespace
+
+mmap_file_reader::mmap_file_reader(const char* filename) : reader(true /*is_resettable*/)
+{
+  const int fd = open(filename, O_RDONLY | O_LARGEFILE);
+  if (fd == -1) { THROWERRNO("can't open: " << filename); }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0)
+  {
+    close(fd);
+    THROWERRNO("can't stat: " << filename);
+  }
+
+  _len = static_cast<size_t>(file_stat.st_size);
+  if (_len > 0)
+  {
+    // A private writable mapping lets io_buf hand out mutable pointers, any writes stay local to this process.
+    void* mapped = mmap(nullptr, _len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED)
+    {
+      close(fd);
+      THROWERRNO("can't mmap: " << filename);
+    }
+    _data = static_cast<char*>(mapped);
+    madvise(_data, _len, MADV_SEQUENTIAL);
+    prefetch(0);
+  }
+  // The mapping keeps the file alive.
+  close(fd);
+}
+
+mmap_file_reader::~mmap_file_reader()
+{
+  if (_data != nullptr) { munmap(_data, _len); }
+}
+
+ssize_t mmap_file_reader::read(char* buffer, size_t num_bytes)
+{
+  num_bytes = std::min(_len - _read_offset, num_bytes);
+  if (num_bytes == 0) { return 0; }
+
+  std::memcpy(buffer, _data + _read_offset, num_bytes);
+  _read_offset += num_bytes;
+  return static_cast<ssize_t>(num_bytes);
+}
+
+bool mmap_file_reader::read_view(char*& data, size_t& num_bytes)
+{
+  if (_read_offset >= _len) { return false; }
+
+  data = _data + _read_offset;
+  num_bytes = std::min(_len - _read_offset, MMAP_WINDOW_SIZE);
+  _read_offset += num_bytes;
+  prefetch(_read_offset);
+  return true;
+}
+
+void mmap_file_reader::reset()
+{
+  // The pages of earlier passes are usually still resident, so later passes are plain memory scans.
+  _read_offset = 0;
+  prefetch(0);
+}
+
+void mmap_file_reader::prefetch(size_t offset)
+{
+  if (offset >= _len) { return; }
+
+  // madvise requires a page aligned address.
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t aligned_offset = offset - (offset % page_size);
+  const size_t length = std::min(_len - aligned_offset, MMAP_WINDOW_SIZE);
+  madvise(_data + aligned_offset, length, MADV_WILLNEED);
+}
+#endif
+
 //
 // buffer_view
 //
@@ -8,7 +8,10 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstdio>
+#include <cstring>
 #include <memory>
+#include <string>
 
 TEST(io_adapter_tests, io_adapter_vector_writer)
 {
@@ -58,3 +61,36 @@ TEST(io_adapter_tests, io_adapter_buffer_view)
     EXPECT_EQ(std::strncmp(read_buffer3, "test another", 13), 0);
   }
 }
+
+TEST(io_adapter_tests, io_adapter_mmap_file_reader)
+{
+  const std::string file_name = "io_adapter_mmap_file_reader.txt";
+  {
+    auto writer = VW::io::open_file_writer(file_name);
+    EXPECT_EQ(writer->write("header|contents", 15), 15);
+  }
+
+  {
+    auto reader = VW::io::open_mmap_file_reader(file_name);
+    char header[7];
+    EXPECT_EQ(reader->read(header, 7), 7);
+    EXPECT_EQ(std::strncmp(header, "header|", 7), 0);
+
+#ifndef _WIN32
+    // Views continue from where read stopped.
+    char* data = nullptr;
+    size_t num_bytes = 0;
+    EXPECT_TRUE(reader->read_view(data, num_bytes));
+    EXPECT_EQ(std::string(data, num_bytes), "contents");
+    EXPECT_FALSE(reader->read_view(data, num_bytes));
+#endif
+
+    EXPECT_TRUE(reader->is_resettable());
+    reader->reset();
+    char all[20];
+    EXPECT_EQ(reader->read(all, 20), 15);
+    EXPECT_EQ(std::strncmp(all, "header|contents", 15), 0);
+  }
+
+  std::remove(file_name.c_str());
+}
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "vw/common/hash.h"
+#include "vw/core/array_parameters_dense.h"
+#include "vw/core/array_parameters_quantized.h"
 #include "vw_slim_return_codes.h"
 
 #include <cctype>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -109,6 +113,8 @@ public:
     {
       T idx;
       RETURN_ON_FAIL((read<T, false>("gd.weight.index", idx)));
+      // Models saved with --page_aligned_weights hold the weight array instead of (index, weight) pairs.
+      if (idx == std::numeric_limits<T>::max()) { return read_weight_array<W>(weights, weight_length); }
       if (idx > weight_length) { return E_VW_PREDICT_ERR_WEIGHT_INDEX_OUT_OF_RANGE; }
 
       float& w = (*weights)[static_cast<size_t>(idx)];
@@ -123,7 +129,40 @@ public:
   }
 
   template <typename W>
-  int read_weights(std::unique_ptr<W>& weights, uint32_t num_bits, uint32_t stride_shift)
+  int read_weight_array(std::unique_ptr<W>& weights, uint64_t weight_length)
+  {
+    uint32_t stride_shift;
+    uint64_t padding;
+    uint64_t array_offset;
+    uint64_t num_weights;
+    RETURN_ON_FAIL((read<uint32_t, false>("gd.weight_array.stride_shift", stride_shift)));
+    RETURN_ON_FAIL((read<uint64_t, false>("gd.weight_array.padding", padding)));
+    RETURN_ON_FAIL((read<uint64_t, false>("gd.weight_array.offset", array_offset)));
+    RETURN_ON_FAIL((read<uint64_t, false>("gd.weight_array.length", num_weights)));
+    // The offset is only needed to map the array from a file.
+    ((void)(array_offset));
+    if (stride_shift >= 32 || (num_weights >> stride_shift) != weight_length)
+    { return E_VW_PREDICT_ERR_INVALID_MODEL; }
+
+    const char* data;
+    RETURN_ON_FAIL(read("gd.weight_array.padding", static_cast<size_t>(padding), &data));
+    RETURN_ON_FAIL(read("gd.weight_array.weights", static_cast<size_t>(num_weights * sizeof(float)), &data));
+
+    // Each row starts with its weight, the rest of the row is learning state which is not needed for prediction.
+    for (uint64_t row = 0; row < weight_length; row++)
+    {
+      float w;
+      // avoid alignment issues as the model buffer may not be aligned
+      memcpy(&w, data + (row << stride_shift) * sizeof(float), sizeof(float));
+      if (w != 0.f) { (*weights)[static_cast<size_t>(row)] = w; }
+    }
+
+    return S_VW_PREDICT_OK;
+  }
+
+  template <typename W>
+  int read_weights(
+      std::unique_ptr<W>& weights, uint32_t num_bits, uint32_t stride_shift, VW::weight_quantization /*quantization*/)
   {
     auto weight_length = static_cast<size_t>(uint64_t{1} << num_bits);
 
@@ -141,5 +180,16 @@ public:
 
     return S_VW_PREDICT_OK;
   }
+
+  // The float weights are only needed until they are quantized.
+  int read_weights(std::unique_ptr<VW::quantized_parameters>& weights, uint32_t num_bits, uint32_t stride_shift,
+      VW::weight_quantization quantization)
+  {
+    std::unique_ptr<dense_parameters> dense;
+    RETURN_ON_FAIL(read_weights(dense, num_bits, stride_shift, quantization));
+    weights = std::unique_ptr<VW::quantized_parameters>(
+        new VW::quantized_parameters(dense->first(), dense->mask(), 0, quantization));
+    return S_VW_PREDICT_OK;
+  }
 };
 }  // namespace vw_slim
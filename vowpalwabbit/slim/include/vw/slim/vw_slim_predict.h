@@ -11,6 +11,7 @@
 #include "model_parser.h"
 #include "opts.h"
 #include "vw/core/array_parameters_dense.h"
+#include "vw/core/array_parameters_quantized.h"
 #include "vw/core/example_predict.h"
 #include "vw/core/gd_predict.h"
 #include "vw/core/interactions.h"
@@ -92,9 +93,18 @@ class vw_predict
 
   uint32_t _stride_shift;
   bool _model_loaded;
+  VW::weight_quantization _quantization;
 
 public:
-  vw_predict() : _contains_wildcard(false), _model_loaded(false) {}
+  vw_predict() : _contains_wildcard(false), _model_loaded(false), _quantization(VW::weight_quantization::fp16) {}
+
+  /**
+   * @brief Sets how weights are stored by models loaded afterwards when W is VW::quantized_parameters. Defaults to
+   * fp16. It is ignored by the other weight types.
+   *
+   * @param quantization The storage format of the weights.
+   */
+  void set_weight_quantization(VW::weight_quantization quantization) { _quantization = quantization; }
 
   /**
    * @brief Reads the Vowpal Wabbit model from the supplied buffer (produced using vw -f <modelname>)
@@ -235,7 +245,7 @@ public:
     // read sparse weights into dense
     _stride_shift = (uint32_t)ceil_log_2(num_weights);
 
-    RETURN_ON_FAIL(mp.read_weights<W>(_weights, _num_bits, _stride_shift));
+    RETURN_ON_FAIL(mp.read_weights(_weights, _num_bits, _stride_shift, _quantization));
 
     // TODO: check that permutations is not enabled (or parse it)
 
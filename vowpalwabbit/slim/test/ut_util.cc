@@ -767,6 +767,38 @@ TYPED_TEST_P(VwSlimTest, model_corrupted)
 REGISTER_TYPED_TEST_SUITE_P(VwSlimTest, model_not_loaded, model_reduction_mismatch, model_corrupted);
 INSTANTIATE_TYPED_TEST_SUITE_P(VowpalWabbitSlim, VwSlimTest, WeightParameters, );
 
+TEST(VowpalWabbitSlim, quantized_weights)
+{
+  test_data td = get_test_data("regression_data_4");
+  vw_predict<dense_parameters> vw;
+  ASSERT_EQ(S_VW_PREDICT_OK, vw.load((const char*)td.model, td.model_len));
+
+  // 1 |a 0:1 |b 2:2 |c 3:3 |d 4:4
+  VW::example_predict ex;
+  example_predict_builder ba(&ex, "a");
+  ba.push_feature(0, 1.f);
+  example_predict_builder bb(&ex, "b");
+  bb.push_feature(2, 2.f);
+  example_predict_builder bc(&ex, "c");
+  bc.push_feature(3, 3.f);
+  example_predict_builder bd(&ex, "d");
+  bd.push_feature(4, 4.f);
+
+  float expected;
+  ASSERT_EQ(S_VW_PREDICT_OK, vw.predict(ex, expected));
+
+  for (auto quantization : {VW::weight_quantization::fp16, VW::weight_quantization::bf16, VW::weight_quantization::int8})
+  {
+    vw_predict<VW::quantized_parameters> quantized;
+    quantized.set_weight_quantization(quantization);
+    ASSERT_EQ(S_VW_PREDICT_OK, quantized.load((const char*)td.model, td.model_len));
+
+    float score;
+    ASSERT_EQ(S_VW_PREDICT_OK, quantized.predict(ex, score));
+    EXPECT_NEAR(score, expected, 0.05f * std::fabs(expected) + 1e-3f) << VW::to_string(quantization);
+  }
+}
+
 TEST(ColdStartModel, action_set_not_reordered)
 {
   std::ifstream input(VW_SLIM_TEST_DIR "data/cold_start.model", std::ios::in | std::ios::binary);